@@ -48,6 +48,7 @@
 #include "opencl/source/sharings/sharing_factory.h"
 #include "opencl/source/tracing/tracing_api.h"
 #include "opencl/source/tracing/tracing_notify.h"
+#include "opencl/source/tracing/tracing_recorder.h"
 
 #include "CL/cl.h"
 #include "config.h"
@@ -60,6 +61,7 @@ using namespace NEO;
 cl_int CL_API_CALL clGetPlatformIDs(cl_uint numEntries,
                                     cl_platform_id *platforms,
                                     cl_uint *numPlatforms) {
+    HostSideTracing::initTracingRecorder();
     TRACING_ENTER(clGetPlatformIDs, &numEntries, &platforms, &numPlatforms);
     cl_int retVal = CL_SUCCESS;
     API_ENTER(&retVal);
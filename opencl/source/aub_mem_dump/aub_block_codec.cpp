@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/aub_mem_dump/aub_block_codec.h"
+
+#include <cstring>
+
+namespace AubMemDump {
+
+constexpr uint32_t BlockFileHeader::magicValue;
+constexpr uint32_t BlockFileHeader::versionValue;
+constexpr uint32_t BlockHeader::storedFlag;
+constexpr uint32_t ZeroRunCodec::id;
+constexpr uint32_t ZeroRunCodec::zeroRunBit;
+
+namespace {
+constexpr uint32_t maxRunLength = ZeroRunCodec::zeroRunBit - 1;
+// single zero dword is cheaper to keep within literal run
+constexpr size_t minZeroRunLength = 2u;
+
+uint32_t loadDword(const uint8_t *src) {
+    uint32_t value;
+    memcpy(&value, src, sizeof(value));
+    return value;
+}
+
+void storeDword(uint8_t *dst, uint32_t value) {
+    memcpy(dst, &value, sizeof(value));
+}
+
+size_t countZeroDwords(const uint8_t *src, size_t dwordIndex, size_t numDwords) {
+    size_t count = 0u;
+    while (dwordIndex + count < numDwords && count < maxRunLength && loadDword(src + (dwordIndex + count) * sizeof(uint32_t)) == 0u) {
+        count++;
+    }
+    return count;
+}
+} // namespace
+
+size_t ZeroRunCodec::getMaxEncodedSize(size_t rawSize) const {
+    // worst case: literal dword, zero run of minimal length, literal dword, ...
+    return rawSize + (rawSize / sizeof(uint32_t) + 1) * sizeof(uint32_t);
+}
+
+size_t ZeroRunCodec::encode(const uint8_t *src, size_t rawSize, uint8_t *dst) const {
+    auto numDwords = rawSize / sizeof(uint32_t);
+    size_t encodedSize = 0u;
+    size_t dwordIndex = 0u;
+
+    while (dwordIndex < numDwords) {
+        auto zeros = countZeroDwords(src, dwordIndex, numDwords);
+        if (zeros >= minZeroRunLength) {
+            storeDword(dst + encodedSize, zeroRunBit | static_cast<uint32_t>(zeros));
+            encodedSize += sizeof(uint32_t);
+            dwordIndex += zeros;
+            continue;
+        }
+
+        auto literalsStart = dwordIndex;
+        while (dwordIndex < numDwords && dwordIndex - literalsStart < maxRunLength) {
+            if (countZeroDwords(src, dwordIndex, std::min(numDwords, dwordIndex + minZeroRunLength)) >= minZeroRunLength) {
+                break;
+            }
+            dwordIndex++;
+        }
+        auto literals = dwordIndex - literalsStart;
+        storeDword(dst + encodedSize, static_cast<uint32_t>(literals));
+        encodedSize += sizeof(uint32_t);
+        memcpy(dst + encodedSize, src + literalsStart * sizeof(uint32_t), literals * sizeof(uint32_t));
+        encodedSize += literals * sizeof(uint32_t);
+    }
+
+    auto tailSize = rawSize - numDwords * sizeof(uint32_t);
+    memcpy(dst + encodedSize, src + numDwords * sizeof(uint32_t), tailSize);
+    return encodedSize + tailSize;
+}
+
+bool ZeroRunCodec::decode(const uint8_t *src, size_t encodedSize, uint8_t *dst, size_t rawSize) const {
+    auto numDwords = rawSize / sizeof(uint32_t);
+    auto tailSize = rawSize - numDwords * sizeof(uint32_t);
+    if (encodedSize < tailSize) {
+        return false;
+    }
+    auto tokensEnd = encodedSize - tailSize;
+
+    size_t srcOffset = 0u;
+    size_t dwordIndex = 0u;
+    while (srcOffset < tokensEnd) {
+        if (tokensEnd - srcOffset < sizeof(uint32_t)) {
+            return false;
+        }
+        auto token = loadDword(src + srcOffset);
+        srcOffset += sizeof(uint32_t);
+
+        size_t runLength = token & maxRunLength;
+        if (runLength > numDwords - dwordIndex) {
+            return false;
+        }
+        if (token & zeroRunBit) {
+            memset(dst + dwordIndex * sizeof(uint32_t), 0, runLength * sizeof(uint32_t));
+        } else {
+            if (runLength * sizeof(uint32_t) > tokensEnd - srcOffset) {
+                return false;
+            }
+            memcpy(dst + dwordIndex * sizeof(uint32_t), src + srcOffset, runLength * sizeof(uint32_t));
+            srcOffset += runLength * sizeof(uint32_t);
+        }
+        dwordIndex += runLength;
+    }
+    if (dwordIndex != numDwords) {
+        return false;
+    }
+
+    memcpy(dst + numDwords * sizeof(uint32_t), src + tokensEnd, tailSize);
+    return true;
+}
+
+std::unique_ptr<BlockCodec> createBlockCodec(uint32_t codecId) {
+    if (codecId == ZeroRunCodec::id) {
+        return std::make_unique<ZeroRunCodec>();
+    }
+    return nullptr;
+}
+
+bool decodeCompressedAub(ArrayRef<const uint8_t> compressedAub, std::vector<uint8_t> &aub) {
+    BlockFileHeader fileHeader = {};
+    if (compressedAub.size() < sizeof(fileHeader)) {
+        return false;
+    }
+    memcpy(&fileHeader, compressedAub.begin(), sizeof(fileHeader));
+    if (fileHeader.magic != BlockFileHeader::magicValue || fileHeader.version != BlockFileHeader::versionValue) {
+        return false;
+    }
+    auto codec = createBlockCodec(fileHeader.codecId);
+    if (codec == nullptr) {
+        return false;
+    }
+
+    aub.clear();
+    size_t offset = sizeof(fileHeader);
+    while (offset < compressedAub.size()) {
+        BlockHeader blockHeader = {};
+        if (compressedAub.size() - offset < sizeof(blockHeader)) {
+            return false;
+        }
+        memcpy(&blockHeader, compressedAub.begin() + offset, sizeof(blockHeader));
+        offset += sizeof(blockHeader);
+        if (compressedAub.size() - offset < blockHeader.encodedSize) {
+            return false;
+        }
+
+        auto block = compressedAub.begin() + offset;
+        auto aubOffset = aub.size();
+        aub.resize(aubOffset + blockHeader.rawSize);
+        if (blockHeader.flags & BlockHeader::storedFlag) {
+            if (blockHeader.encodedSize != blockHeader.rawSize) {
+                return false;
+            }
+            memcpy(aub.data() + aubOffset, block, blockHeader.rawSize);
+        } else if (false == codec->decode(block, blockHeader.encodedSize, aub.data() + aubOffset, blockHeader.rawSize)) {
+            return false;
+        }
+        offset += blockHeader.encodedSize;
+    }
+    return true;
+}
+
+} // namespace AubMemDump
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace AubMemDump {
+
+// Compressed AUB file is a sequence of independently encoded blocks:
+// [BlockFileHeader] { [BlockHeader] [encodedSize bytes] }*
+struct BlockFileHeader {
+    static constexpr uint32_t magicValue = 0x5a425541; // "AUBZ"
+    static constexpr uint32_t versionValue = 1u;
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t codecId;
+    uint32_t reserved;
+};
+
+struct BlockHeader {
+    static constexpr uint32_t storedFlag = 1u; // block is not encoded
+
+    uint32_t rawSize;
+    uint32_t encodedSize;
+    uint32_t flags;
+    uint32_t reserved;
+};
+
+class BlockCodec {
+  public:
+    virtual ~BlockCodec() = default;
+
+    virtual uint32_t getId() const = 0;
+    virtual size_t getMaxEncodedSize(size_t rawSize) const = 0;
+    // returns encoded size
+    virtual size_t encode(const uint8_t *src, size_t rawSize, uint8_t *dst) const = 0;
+    virtual bool decode(const uint8_t *src, size_t encodedSize, uint8_t *dst, size_t rawSize) const = 0;
+};
+
+// Encodes dwords as runs of zeros and runs of literals, memory pages dumped to AUB are mostly zeros.
+// Token (uint32_t): highest bit set - number of zero dwords, otherwise number of literal dwords that follow.
+// Bytes not forming whole dword are appended as they are.
+class ZeroRunCodec : public BlockCodec {
+  public:
+    static constexpr uint32_t id = 1u;
+    static constexpr uint32_t zeroRunBit = 0x80000000u;
+
+    uint32_t getId() const override { return id; }
+    size_t getMaxEncodedSize(size_t rawSize) const override;
+    size_t encode(const uint8_t *src, size_t rawSize, uint8_t *dst) const override;
+    bool decode(const uint8_t *src, size_t encodedSize, uint8_t *dst, size_t rawSize) const override;
+};
+
+std::unique_ptr<BlockCodec> createBlockCodec(uint32_t codecId);
+
+// Restores AUB file written with compression
+bool decodeCompressedAub(ArrayRef<const uint8_t> compressedAub, std::vector<uint8_t> &aub);
+
+} // namespace AubMemDump
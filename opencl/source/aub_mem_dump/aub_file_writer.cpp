@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/aub_mem_dump/aub_file_writer.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace AubMemDump {
+
+constexpr size_t AubFileWriter::defaultChunkSize;
+
+AubFileWriter::AubFileWriter(std::ostream &output, size_t chunkSize, std::unique_ptr<BlockCodec> codec)
+    : output(output), chunkSize(std::max(chunkSize, static_cast<size_t>(1u))), codec(std::move(codec)) {
+    activeChunk.reserve(this->chunkSize);
+    pendingChunk.reserve(this->chunkSize);
+    if (this->codec) {
+        encodedChunk.resize(this->codec->getMaxEncodedSize(this->chunkSize));
+        BlockFileHeader header = {BlockFileHeader::magicValue, BlockFileHeader::versionValue, this->codec->getId(), 0u};
+        output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    }
+    writer = NEO::Thread::create(writerThread, reinterpret_cast<void *>(this));
+}
+
+AubFileWriter::~AubFileWriter() {
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopWriter = true;
+    }
+    condition.notify_all();
+    writer->join();
+    writer.reset();
+}
+
+void AubFileWriter::write(const char *data, size_t size) {
+    while (size > 0) {
+        auto bytesToCopy = std::min(size, chunkSize - activeChunk.size());
+        activeChunk.insert(activeChunk.end(), data, data + bytesToCopy);
+        data += bytesToCopy;
+        size -= bytesToCopy;
+        if (activeChunk.size() == chunkSize) {
+            submitActiveChunk();
+        }
+    }
+}
+
+void AubFileWriter::flush() {
+    if (!activeChunk.empty()) {
+        submitActiveChunk();
+    }
+}
+
+void AubFileWriter::drain() {
+    flush();
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [this]() { return !pendingChunkReady; });
+}
+
+uint64_t AubFileWriter::getWrittenChunksCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return writtenChunksCount;
+}
+
+void AubFileWriter::submitActiveChunk() {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this]() { return !pendingChunkReady; });
+        activeChunk.swap(pendingChunk);
+        pendingChunkReady = true;
+    }
+    condition.notify_all();
+    activeChunk.clear();
+}
+
+void AubFileWriter::writeChunk(const std::vector<char> &chunk) {
+    if (codec == nullptr) {
+        output.write(chunk.data(), chunk.size());
+    } else {
+        BlockHeader header = {static_cast<uint32_t>(chunk.size()), 0u, 0u, 0u};
+        header.encodedSize = static_cast<uint32_t>(codec->encode(reinterpret_cast<const uint8_t *>(chunk.data()), chunk.size(), encodedChunk.data()));
+        const char *block = reinterpret_cast<const char *>(encodedChunk.data());
+        if (header.encodedSize >= header.rawSize) {
+            header.encodedSize = header.rawSize;
+            header.flags = BlockHeader::storedFlag;
+            block = chunk.data();
+        }
+        output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        output.write(block, header.encodedSize);
+    }
+    output.flush();
+}
+
+void *AubFileWriter::writerThread(void *arg) {
+    auto self = reinterpret_cast<AubFileWriter *>(arg);
+    std::unique_lock<std::mutex> lock(self->mutex);
+    while (true) {
+        self->condition.wait(lock, [self]() { return self->pendingChunkReady || self->stopWriter; });
+        if (!self->pendingChunkReady) {
+            break;
+        }
+        lock.unlock();
+        self->writeChunk(self->pendingChunk);
+        lock.lock();
+        self->pendingChunk.clear();
+        self->pendingChunkReady = false;
+        self->writtenChunksCount++;
+        self->condition.notify_all();
+    }
+    return nullptr;
+}
+
+} // namespace AubMemDump
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "opencl/source/aub_mem_dump/aub_block_codec.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace NEO {
+class Thread;
+}
+
+namespace AubMemDump {
+
+// Collects AUB stream into chunks written to the output by a background thread.
+// While one chunk is written (and optionally encoded), the next one is filled.
+// write() and flush() are not thread safe, callers serialize them with AubFileStream lock.
+class AubFileWriter {
+  public:
+    static constexpr size_t defaultChunkSize = 4 * 1024 * 1024;
+
+    AubFileWriter(std::ostream &output, size_t chunkSize, std::unique_ptr<BlockCodec> codec);
+    MOCKABLE_VIRTUAL ~AubFileWriter();
+
+    AubFileWriter(const AubFileWriter &) = delete;
+    AubFileWriter &operator=(const AubFileWriter &) = delete;
+
+    void write(const char *data, size_t size);
+    // hands over collected data to the writer thread, blocks only when previous chunk is still being written
+    void flush();
+    // waits until all collected data reaches the output
+    void drain();
+
+    size_t getChunkSize() const { return chunkSize; }
+    uint64_t getWrittenChunksCount() const;
+
+  protected:
+    void submitActiveChunk();
+    MOCKABLE_VIRTUAL void writeChunk(const std::vector<char> &chunk);
+    static void *writerThread(void *arg);
+
+    std::ostream &output;
+    const size_t chunkSize;
+    std::unique_ptr<BlockCodec> codec;
+
+    std::vector<char> activeChunk;  // filled by producer
+    std::vector<char> pendingChunk; // written by writer thread
+    std::vector<uint8_t> encodedChunk;
+
+    mutable std::mutex mutex;
+    std::condition_variable condition;
+    bool pendingChunkReady = false;
+    bool stopWriter = false;
+    uint64_t writtenChunksCount = 0u;
+    std::unique_ptr<NEO::Thread> writer;
+};
+
+} // namespace AubMemDump
@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
 
@@ -25,6 +26,8 @@ class AubHelper;
 namespace AubMemDump {
 #include "aub_services.h"
 
+class AubFileWriter;
+
 constexpr uint32_t rcsRegisterBase = 0x2000;
 
 inline uint32_t computeRegisterOffset(uint32_t mmioBase, uint32_t rcsRegisterOffset) {
@@ -122,6 +125,9 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    AubFileStream();
+    ~AubFileStream() override;
+
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -143,6 +149,7 @@ struct AubFileStream : public AubStream {
     MOCKABLE_VIRTUAL std::unique_lock<std::mutex> lockStream();
 
     std::ofstream fileHandle;
+    std::unique_ptr<AubFileWriter> writer; // when set, stream is written asynchronously to fileHandle
     std::string fileName;
     std::mutex mutex;
 };
@@ -124,8 +124,18 @@ void AubDump<Traits>::reserveAddressGGTTAndWriteMmeory(typename Traits::Stream &
                                                        uint64_t additionalBits, const NEO::AubHelper &aubHelper) {
     auto vmAddr = (gfxAddress + offset) & ~(MemoryConstants::pageSize - 1);
     auto pAddr = physAddress & ~(MemoryConstants::pageSize - 1);
+    // range may span multiple pages contiguous in physical memory
+    auto vmEnd = (gfxAddress + offset + size + MemoryConstants::pageSize - 1) & ~(MemoryConstants::pageSize - 1);
+    size_t blockSize = std::max(static_cast<size_t>(vmEnd - vmAddr), MemoryConstants::pageSize);
 
-    AubDump<Traits>::reserveAddressPPGTT(stream, vmAddr, MemoryConstants::pageSize, pAddr, additionalBits, aubHelper);
+    // PT entries of each part are written under one memory write header, which holds at most g_dwordCountMax dwords
+    auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - sizeof(CmdServicesMemTraceMemoryWrite::data);
+    auto entriesPerHeaderMax = (g_dwordCountMax * sizeof(uint32_t) - sizeMemoryWriteHeader) / sizeof(uint64_t);
+    auto blockSizeMax = entriesPerHeaderMax * MemoryConstants::pageSize;
+    for (size_t blockOffset = 0; blockOffset < blockSize; blockOffset += blockSizeMax) {
+        AubDump<Traits>::reserveAddressPPGTT(stream, vmAddr + blockOffset, std::min(blockSizeMax, blockSize - blockOffset),
+                                             pAddr + blockOffset, additionalBits, aubHelper);
+    }
 
     int hint = NEO::AubHelper::getMemTrace(additionalBits);
 
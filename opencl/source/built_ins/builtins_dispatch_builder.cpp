@@ -40,6 +40,8 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispatchInfoBui
                  "",
                  "CopyBufferToBufferLeftLeftover", kernLeftLeftover,
                  "CopyBufferToBufferMiddle", kernMiddle,
+                 "CopyBufferToBufferMiddleWide", kernMiddleWide,
+                 "CopyBufferToBufferMiddleMisaligned", kernMiddleMisaligned,
                  "CopyBufferToBufferRightLeftover", kernRightLeftover);
     }
     template <typename OffsetType>
@@ -60,17 +62,20 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispatchInfoBui
 
         uintptr_t middleSizeBytes = operationParams.size.x - leftSize - rightSize; // calc middle size
 
+        auto middleKernel = kernMiddle;
         if (!isAligned<4>(reinterpret_cast<uintptr_t>(operationParams.srcPtr) + operationParams.srcOffset.x + leftSize)) {
-            //corner case - src relative to dst does not have DWORD alignment
-            leftSize += middleSizeBytes;
-            middleSizeBytes = 0;
+            //corner case - src relative to dst does not have DWORD alignment, middle is read byte-wise
+            middleKernel = kernMiddleMisaligned;
+        } else if (middleSizeBytes >= wideMiddleMinSize) {
+            middleKernel = kernMiddleWide;
+            middleElSize = sizeof(uint32_t) * 8;
         }
 
         auto middleSizeEls = middleSizeBytes / middleElSize; // num work items in middle walker
 
         // Set-up ISA
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Left, kernLeftLeftover);
-        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, kernMiddle);
+        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, middleKernel);
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Right, kernRightLeftover);
 
         // Set-up common kernel args
@@ -118,6 +123,8 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispatchInfoBui
   protected:
     Kernel *kernLeftLeftover = nullptr;
     Kernel *kernMiddle = nullptr;
+    Kernel *kernMiddleWide = nullptr;
+    Kernel *kernMiddleMisaligned = nullptr;
     Kernel *kernRightLeftover = nullptr;
     BuiltInOp(BuiltIns &kernelsLib)
         : BuiltinDispatchInfoBuilder(kernelsLib) {
@@ -134,6 +141,8 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBufferStateless> : public BuiltInOp<EBu
                  CompilerOptions::greaterThan4gbBuffersRequired,
                  "CopyBufferToBufferLeftLeftover", kernLeftLeftover,
                  "CopyBufferToBufferMiddle", kernMiddle,
+                 "CopyBufferToBufferMiddleWide", kernMiddleWide,
+                 "CopyBufferToBufferMiddleMisaligned", kernMiddleMisaligned,
                  "CopyBufferToBufferRightLeftover", kernRightLeftover);
     }
 
@@ -273,6 +282,7 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
                  "",
                  "FillBufferLeftLeftover", kernLeftLeftover,
                  "FillBufferMiddle", kernMiddle,
+                 "FillBufferMiddleWide", kernMiddleWide,
                  "FillBufferRightLeftover", kernRightLeftover);
     }
 
@@ -294,11 +304,19 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
 
         uintptr_t middleSizeBytes = operationParams.size.x - leftSize - rightSize; // calc middle size
 
-        auto middleSizeEls = middleSizeBytes / middleElSize; // num work items in middle walker
+        // wide middle kernel replicates pattern, so work item stores 4 elements
+        auto middleKernel = kernMiddle;
+        size_t middleElsPerWorkItem = 1;
+        if (middleSizeBytes >= wideMiddleMinSize) {
+            middleKernel = kernMiddleWide;
+            middleElsPerWorkItem = 4;
+        }
+
+        auto middleSizeEls = middleSizeBytes / (middleElSize * middleElsPerWorkItem); // num work items in middle walker
 
         // Set-up ISA
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Left, kernLeftLeftover);
-        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, kernMiddle);
+        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, middleKernel);
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Right, kernRightLeftover);
 
         DEBUG_BREAK_IF((operationParams.srcMemObj == nullptr) || (operationParams.srcOffset != 0));
@@ -341,6 +359,7 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
   protected:
     Kernel *kernLeftLeftover = nullptr;
     Kernel *kernMiddle = nullptr;
+    Kernel *kernMiddleWide = nullptr;
     Kernel *kernRightLeftover = nullptr;
 
     BuiltInOp(BuiltIns &kernelsLib) : BuiltinDispatchInfoBuilder(kernelsLib) {}
@@ -355,6 +374,7 @@ class BuiltInOp<EBuiltInOps::FillBufferStateless> : public BuiltInOp<EBuiltInOps
                  CompilerOptions::greaterThan4gbBuffersRequired,
                  "FillBufferLeftLeftover", kernLeftLeftover,
                  "FillBufferMiddle", kernMiddle,
+                 "FillBufferMiddleWide", kernMiddleWide,
                  "FillBufferRightLeftover", kernRightLeftover);
     }
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/helpers/vec.h"
+#include "shared/source/memory_manager/memory_constants.h"
 
 #include "opencl/source/kernel/kernel.h"
 
@@ -32,6 +33,9 @@ class MemObj;
 struct MultiDispatchInfo;
 class Program;
 
+// middle region size from which buffer copy and fill builders switch to kernels storing more bytes per work item
+constexpr size_t wideMiddleMinSize = 64 * MemoryConstants::kiloByte;
+
 struct BuiltinOpParams {
     void *srcPtr = nullptr;
     void *dstPtr = nullptr;
@@ -96,6 +100,14 @@ class BuiltinDispatchInfoBuilder {
 
     cl_int grabKernels() { return CL_SUCCESS; }
 
+    template <typename KernelNameT, typename KernelDstT, typename... KernelsDescArgsT>
+    static void getKernelNames(std::vector<std::string> &kernelNames, KernelNameT &&kernelName, KernelDstT &&kernelDst, KernelsDescArgsT &&... kernelsDesc) {
+        kernelNames.push_back(kernelName);
+        getKernelNames(kernelNames, std::forward<KernelsDescArgsT>(kernelsDesc)...);
+    }
+
+    static void getKernelNames(std::vector<std::string> &kernelNames) {}
+
     std::unique_ptr<Program> prog;
     std::vector<std::unique_ptr<Kernel>> usedKernels;
     BuiltIns &kernelsLib;
@@ -10,6 +10,9 @@ template <typename... KernelsDescArgsT>
 void BuiltinDispatchInfoBuilder::populate(Device &device, EBuiltInOps::Type op, const char *options, KernelsDescArgsT &&... desc) {
     auto src = kernelsLib.getBuiltinsLib().getBuiltinCode(op, BuiltinCode::ECodeType::Any, device);
     prog.reset(BuiltinsLib::createProgramFromCode(src, device).release());
+    std::vector<std::string> kernelNames;
+    getKernelNames(kernelNames, desc...);
+    prog->setKernelsToLoad(std::move(kernelNames));
     prog->build(0, nullptr, options, nullptr, nullptr, kernelsLib.isCacheingEnabled());
     grabKernels(std::forward<KernelsDescArgsT>(desc)...);
 }
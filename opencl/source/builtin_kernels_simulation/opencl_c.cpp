@@ -133,4 +133,35 @@ ushort convert_ushort_sat(uint c) {
     return (ushort)c;
 }
 
+uint4 vload4(size_t offset, const uint *p) {
+    p += offset * 4;
+    return uint4(p[0], p[1], p[2], p[3]);
+}
+
+uint8 vload8(size_t offset, const uint *p) {
+    uint8 data;
+    memcpy_s(&data, sizeof(data), p + offset * 8, sizeof(data));
+    return data;
+}
+
+uchar16 vload16(size_t offset, const uchar *p) {
+    uchar16 data;
+    memcpy_s(&data, sizeof(data), p + offset * 16, sizeof(data));
+    return data;
+}
+
+void vstore4(uint4 data, size_t offset, uint *p) {
+    memcpy_s(p + offset * 4, sizeof(data), &data, sizeof(data));
+}
+
+void vstore8(uint8 data, size_t offset, uint *p) {
+    memcpy_s(p + offset * 8, sizeof(data), &data, sizeof(data));
+}
+
+uint4 as_uint4(uchar16 data) {
+    uint4 ret(0, 0, 0, 0);
+    memcpy_s(&ret, sizeof(ret), &data, sizeof(data));
+    return ret;
+}
+
 } // namespace BuiltinKernelsSimulation
@@ -165,6 +165,14 @@ typedef struct tagushort16 {
     unsigned short xxx[16];
 } ushort16;
 
+typedef struct taguchar16 {
+    uchar xxx[16];
+} uchar16;
+
+typedef struct taguint8 {
+    uint xxx[8];
+} uint8;
+
 uint4 operator+(uint4 const &a, uint4 const &b);
 int4 operator+(int4 const &a, int4 const &b);
 
@@ -232,6 +240,12 @@ uint4 read_imageui(image *im, int4 coord);
 uint4 write_imageui(image *im, uint4 coord, uint4 color);
 uchar convert_uchar_sat(uint c);
 ushort convert_ushort_sat(uint c);
+uint4 vload4(size_t offset, const uint *p);
+uint8 vload8(size_t offset, const uint *p);
+uchar16 vload16(size_t offset, const uchar *p);
+void vstore4(uint4 data, size_t offset, uint *p);
+void vstore8(uint8 data, size_t offset, uint *p);
+uint4 as_uint4(uchar16 data);
 
 #define EMULATION_ENTER_FUNCTION() \
     uint __LOCAL_ID__ = 0;         \
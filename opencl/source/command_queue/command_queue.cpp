@@ -8,6 +8,7 @@
 #include "opencl/source/command_queue/command_queue.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/array_count.h"
 #include "shared/source/helpers/engine_node_helper.h"
@@ -620,11 +621,64 @@ bool CommandQueue::blitEnqueueAllowed(cl_command_type cmdType) const {
     }
 
     bool commandAllowed = (CL_COMMAND_READ_BUFFER == cmdType) || (CL_COMMAND_WRITE_BUFFER == cmdType) ||
-                          (CL_COMMAND_COPY_BUFFER == cmdType);
+                          (CL_COMMAND_COPY_BUFFER == cmdType) || (CL_COMMAND_READ_BUFFER_RECT == cmdType) ||
+                          (CL_COMMAND_WRITE_BUFFER_RECT == cmdType) || (CL_COMMAND_COPY_BUFFER_RECT == cmdType) ||
+                          (CL_COMMAND_READ_IMAGE == cmdType) || (CL_COMMAND_WRITE_IMAGE == cmdType);
 
     return commandAllowed && blitAllowed;
 }
 
+bool CommandQueue::splitBlitEnqueueAllowed(cl_command_type cmdType, size_t size) const {
+    bool splitAllowed = false;
+    size_t minSize = static_cast<size_t>(BlitterConstants::minSplitCopySize);
+
+    if (DebugManager.flags.SplitBcsCopy.get() != -1) {
+        splitAllowed = !!DebugManager.flags.SplitBcsCopy.get();
+    }
+    if (DebugManager.flags.SplitBcsCopyMinSize.get() != -1) {
+        minSize = static_cast<size_t>(DebugManager.flags.SplitBcsCopyMinSize.get());
+    }
+
+    bool commandAllowed = (CL_COMMAND_READ_BUFFER == cmdType) || (CL_COMMAND_COPY_BUFFER == cmdType);
+
+    // builtin kernels copy at least one page
+    bool kernelCopyNotEmpty = alignDown(size / 2, MemoryConstants::pageSize) > 0;
+
+    return splitAllowed && commandAllowed && (size >= minSize) && kernelCopyNotEmpty && blitEnqueueAllowed(cmdType);
+}
+
+void CommandQueue::buildBuiltinDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinDispatchInfoBuilder &builder,
+                                             const BuiltinOpParams &operationParams, cl_command_type cmdType) const {
+    if (!splitBlitEnqueueAllowed(cmdType, operationParams.size.x)) {
+        builder.buildDispatchInfos(multiDispatchInfo, operationParams);
+        return;
+    }
+    auto kernelCopySize = alignDown(operationParams.size.x / 2, MemoryConstants::pageSize);
+
+    // builtin kernels copy beginning of the range on gpgpu engine, blitter copies remaining part concurrently
+    BuiltinOpParams kernelOperationParams = operationParams;
+    kernelOperationParams.size.x = kernelCopySize;
+    builder.buildDispatchInfos(multiDispatchInfo, kernelOperationParams);
+
+    BuiltinOpParams blitOperationParams = operationParams;
+    blitOperationParams.srcOffset.x += kernelCopySize;
+    blitOperationParams.dstOffset.x += kernelCopySize;
+    blitOperationParams.size.x -= kernelCopySize;
+    multiDispatchInfo.setBuiltinOpParams(blitOperationParams);
+    multiDispatchInfo.setSplitBlitEnqueue(true);
+}
+
+bool CommandQueue::blitEnqueueImageAllowed(const Image &image) {
+    // blitter copies rows of linear memory, other images are transferred with builtin kernels
+    auto imageType = image.getImageDesc().image_type;
+    bool imageTypeAllowed = (CL_MEM_OBJECT_IMAGE1D == imageType) || (CL_MEM_OBJECT_IMAGE2D == imageType) ||
+                            (CL_MEM_OBJECT_IMAGE2D_ARRAY == imageType) || (CL_MEM_OBJECT_IMAGE3D == imageType);
+    auto gmm = image.getGraphicsAllocation()->getDefaultGmm();
+
+    return imageTypeAllowed && !image.isTiledAllocation() && !isMipMapped(&image) && !(gmm && gmm->isRenderCompressed) &&
+           !image.peekSharingHandler() && !image.isImageFromBuffer() && !image.isImageFromImage();
+}
+
 bool CommandQueue::isBlockedCommandStreamRequired(uint32_t commandType, const EventsRequest &eventsRequest, bool blockedQueue) const {
     if (!blockedQueue) {
         return false;
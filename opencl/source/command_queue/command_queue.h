@@ -451,6 +451,10 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     void providePerformanceHint(TransferProperties &transferProperties);
     bool queueDependenciesClearRequired() const;
     bool blitEnqueueAllowed(cl_command_type cmdType) const;
+    bool splitBlitEnqueueAllowed(cl_command_type cmdType, size_t size) const;
+    void buildBuiltinDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinDispatchInfoBuilder &builder,
+                                   const BuiltinOpParams &operationParams, cl_command_type cmdType) const;
+    static bool blitEnqueueImageAllowed(const Image &image);
     void aubCaptureHook(bool &blocking, bool &clearAllDependencies, const MultiDispatchInfo &multiDispatchInfo);
 
     Context *context = nullptr;
@@ -8,6 +8,7 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/helpers/ptr_math.h"
 
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
@@ -18,6 +19,22 @@
 #include "opencl/source/mem_obj/image.h"
 
 namespace NEO {
+namespace {
+// simulation CSRs upload only written pages when range lies within the allocation
+void setSimulationWritable(GraphicsAllocation &graphicsAllocation, const void *writtenPtr, size_t writtenSize) {
+    auto allocationPtr = graphicsAllocation.getUnderlyingBuffer();
+    if (allocationPtr && writtenPtr >= allocationPtr &&
+        ptrDiff(writtenPtr, allocationPtr) + writtenSize <= graphicsAllocation.getUnderlyingBufferSize()) {
+        auto offset = ptrDiff(writtenPtr, allocationPtr);
+        graphicsAllocation.setAubWritableRange(offset, writtenSize, GraphicsAllocation::defaultBank);
+        graphicsAllocation.setTbxWritableRange(offset, writtenSize, GraphicsAllocation::defaultBank);
+    } else {
+        graphicsAllocation.setAubWritable(true, GraphicsAllocation::defaultBank);
+        graphicsAllocation.setTbxWritable(true, GraphicsAllocation::defaultBank);
+    }
+}
+} // namespace
+
 void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &retVal) {
     MapInfo unmapInfo;
     Event *outEventObj = nullptr;
@@ -155,8 +172,14 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
         }
         if (modifySimulationFlags) {
             auto graphicsAllocation = transferProperties.memObj->getGraphicsAllocation();
-            graphicsAllocation->setAubWritable(true, GraphicsAllocation::defaultBank);
-            graphicsAllocation->setTbxWritable(true, GraphicsAllocation::defaultBank);
+            if (transferProperties.cmdType == CL_COMMAND_WRITE_BUFFER) {
+                setSimulationWritable(*graphicsAllocation, transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            } else if (transferProperties.memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER) {
+                setSimulationWritable(*graphicsAllocation, ptrOffset(transferProperties.memObj->getCpuAddressForMemoryTransfer(), unmapInfo.offset[0]), unmapInfo.size[0]);
+            } else {
+                graphicsAllocation->setAubWritable(true, GraphicsAllocation::defaultBank);
+                graphicsAllocation->setTbxWritable(true, GraphicsAllocation::defaultBank);
+            }
         }
     }
 
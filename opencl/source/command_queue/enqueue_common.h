@@ -176,7 +176,13 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
     auto blockQueue = false;
     auto taskLevel = 0u;
     obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, commandType);
-    bool blitEnqueue = blitEnqueueAllowed(commandType);
+    bool splitBlitEnqueue = multiDispatchInfo.isSplitBlitEnqueue();
+    bool blitEnqueue = !splitBlitEnqueue && blitEnqueueAllowed(commandType);
+    if (blitEnqueue && (CL_COMMAND_READ_IMAGE == commandType || CL_COMMAND_WRITE_IMAGE == commandType)) {
+        auto &builtinOpParams = multiDispatchInfo.peekBuiltinOpParams();
+        auto image = castToObject<Image>(CL_COMMAND_READ_IMAGE == commandType ? builtinOpParams.srcMemObj : builtinOpParams.dstMemObj);
+        blitEnqueue = image && blitEnqueueImageAllowed(*image);
+    }
 
     DBG_LOG(EventsDebugEnable, "blockQueue", blockQueue, "virtualEvent", virtualEvent, "taskLevel", taskLevel);
 
@@ -206,9 +212,13 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
             nodesCount = 1;
         } else if (!multiDispatchInfo.empty()) {
             nodesCount = estimateTimestampPacketNodesCount(multiDispatchInfo);
+            if (splitBlitEnqueue) {
+                // last node is written by blitter, kernels keep their dispatch indices
+                nodesCount++;
+            }
         }
 
-        if (blitEnqueue) {
+        if (blitEnqueue || splitBlitEnqueue) {
             auto allocator = getGpgpuCommandStreamReceiver().getTimestampPacketAllocator();
 
             if (isCacheFlushForBcsRequired()) {
@@ -245,9 +255,17 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         blitPropertiesContainer.push_back(processDispatchForBlitEnqueue(multiDispatchInfo, timestampPacketDependencies,
                                                                         eventsRequest, commandStream, commandType, blockQueue));
     } else if (multiDispatchInfo.empty() == false) {
+        if (splitBlitEnqueue) {
+            blitPropertiesContainer.push_back(processDispatchForBlitEnqueue(multiDispatchInfo, timestampPacketDependencies,
+                                                                            eventsRequest, commandStream, commandType, blockQueue));
+        }
         processDispatchForKernels<commandType>(multiDispatchInfo, printfHandler, eventBuilder.getEvent(),
                                                hwTimeStamps, blockQueue, devQueueHw, csrDeps, blockedCommandsData.get(),
                                                timestampPacketDependencies);
+        if (splitBlitEnqueue) {
+            // kernels run concurrently with blitter, enqueue completes when both parts are done
+            TimestampPacketHelper::programSemaphoreWithImplicitDependency<GfxFamily>(commandStream, *blitPropertiesContainer.back().outputTimestampPacket);
+        }
     } else if (isCacheFlushCommand(commandType)) {
         processDispatchForCacheFlush(surfacesForResidency, numSurfaceForResidency, &commandStream, csrDeps);
     } else if (getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
@@ -461,8 +479,11 @@ BlitProperties CommandQueueHw<GfxFamily>::processDispatchForBlitEnqueue(const Mu
 
     auto blitCommandStreamReceiver = getBcsCommandStreamReceiver();
 
-    auto blitProperties = ClBlitProperties::constructProperties(blitDirection, *blitCommandStreamReceiver,
-                                                                multiDispatchInfo.peekBuiltinOpParams());
+    auto blitProperties = ClBlitProperties::isCopyRegionCommand(commandType)
+                              ? ClBlitProperties::constructPropertiesForCopyRegion(blitDirection, *blitCommandStreamReceiver,
+                                                                                   multiDispatchInfo.peekBuiltinOpParams())
+                              : ClBlitProperties::constructProperties(blitDirection, *blitCommandStreamReceiver,
+                                                                      multiDispatchInfo.peekBuiltinOpParams());
     if (!queueBlocked) {
         eventsRequest.fillCsrDependencies(blitProperties.csrDependencies, *blitCommandStreamReceiver,
                                           CsrDependencies::DependenciesType::All);
@@ -472,7 +493,7 @@ BlitProperties CommandQueueHw<GfxFamily>::processDispatchForBlitEnqueue(const Mu
         blitProperties.csrDependencies.push_back(&timestampPacketDependencies.barrierNodes);
     }
 
-    auto currentTimestampPacketNode = timestampPacketContainer->peekNodes().at(0);
+    auto currentTimestampPacketNode = timestampPacketContainer->peekNodes().back();
     blitProperties.outputTimestampPacket = currentTimestampPacketNode;
 
     if (isCacheFlushForBcsRequired()) {
@@ -484,7 +505,9 @@ BlitProperties CommandQueueHw<GfxFamily>::processDispatchForBlitEnqueue(const Mu
             cacheFlushTimestampPacketGpuAddress, 0, true, device->getHardwareInfo());
     }
 
-    TimestampPacketHelper::programSemaphoreWithImplicitDependency<GfxFamily>(commandStream, *currentTimestampPacketNode);
+    if (!multiDispatchInfo.isSplitBlitEnqueue()) {
+        TimestampPacketHelper::programSemaphoreWithImplicitDependency<GfxFamily>(commandStream, *currentTimestampPacketNode);
+    }
 
     return blitProperties;
 }
@@ -864,6 +887,7 @@ void CommandQueueHw<GfxFamily>::enqueueBlocked(
         if (enqueueProperties.blitPropertiesContainer) {
             blockedCommandsData->blitPropertiesContainer = *enqueueProperties.blitPropertiesContainer;
             blockedCommandsData->blitEnqueue = true;
+            blockedCommandsData->splitBlitEnqueue = multiDispatchInfo.isSplitBlitEnqueue();
         }
 
         storeTimestampPackets = (timestampPacketContainer != nullptr);
@@ -48,7 +48,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBuffer(
     dc.srcOffset = {srcOffset, 0, 0};
     dc.dstOffset = {dstOffset, 0, 0};
     dc.size = {size, 0, 0};
-    builder.buildDispatchInfos(dispatchInfo, dc);
+    buildBuiltinDispatchInfos(dispatchInfo, builder, dc, CL_COMMAND_COPY_BUFFER);
 
     MemObjSurface s1(srcBuffer);
     MemObjSurface s2(dstBuffer);
@@ -96,7 +96,9 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
     } else {
         surfaces[1] = &hostPtrSurf;
         if (size != 0) {
-            auto &csr = blitEnqueueAllowed(cmdType) ? *getBcsCommandStreamReceiver() : getGpgpuCommandStreamReceiver();
+            // split transfer is written by both engines and completes on gpgpu engine, which waits for the blitter part
+            bool bcsOnlyTransfer = blitEnqueueAllowed(cmdType) && !splitBlitEnqueueAllowed(cmdType, size);
+            auto &csr = bcsOnlyTransfer ? *getBcsCommandStreamReceiver() : getGpgpuCommandStreamReceiver();
             bool status = csr.createAllocationForHostSurface(hostPtrSurf, true);
             if (!status) {
                 return CL_OUT_OF_RESOURCES;
@@ -116,7 +118,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
     dc.transferAllocation = mapAllocation ? mapAllocation : hostPtrSurf.getAllocation();
 
     MultiDispatchInfo dispatchInfo;
-    builder.buildDispatchInfos(dispatchInfo, dc);
+    buildBuiltinDispatchInfos(dispatchInfo, builder, dc, cmdType);
 
     if (context->isProvidingPerformanceHints()) {
         context->providePerformanceHintForMemoryTransfer(CL_COMMAND_READ_BUFFER, true, static_cast<cl_mem>(buffer), ptr);
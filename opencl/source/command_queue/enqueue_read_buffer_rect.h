@@ -65,7 +65,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBufferRect(
     if (region[0] != 0 &&
         region[1] != 0 &&
         region[2] != 0) {
-        bool status = getGpgpuCommandStreamReceiver().createAllocationForHostSurface(hostPtrSurf, true);
+        auto &csr = blitEnqueueAllowed(CL_COMMAND_READ_BUFFER_RECT) ? *getBcsCommandStreamReceiver() : getGpgpuCommandStreamReceiver();
+        bool status = csr.createAllocationForHostSurface(hostPtrSurf, true);
         if (!status) {
             return CL_OUT_OF_RESOURCES;
         }
@@ -86,6 +87,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBufferRect(
     dc.srcSlicePitch = bufferSlicePitch;
     dc.dstRowPitch = hostRowPitch;
     dc.dstSlicePitch = hostSlicePitch;
+    dc.transferAllocation = hostPtrSurf.getAllocation();
 
     MultiDispatchInfo dispatchInfo;
     builder.buildDispatchInfos(dispatchInfo, dc);
@@ -79,7 +79,9 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadImage(
         if (region[0] != 0 &&
             region[1] != 0 &&
             region[2] != 0) {
-            bool status = getGpgpuCommandStreamReceiver().createAllocationForHostSurface(hostPtrSurf, true);
+            bool blitEnqueue = blitEnqueueAllowed(CL_COMMAND_READ_IMAGE) && blitEnqueueImageAllowed(*srcImage);
+            auto &csr = blitEnqueue ? *getBcsCommandStreamReceiver() : getGpgpuCommandStreamReceiver();
+            bool status = csr.createAllocationForHostSurface(hostPtrSurf, true);
             if (!status) {
                 return CL_OUT_OF_RESOURCES;
             }
@@ -98,6 +100,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadImage(
     dc.size = region;
     dc.srcRowPitch = (srcImage->getImageDesc().image_type == CL_MEM_OBJECT_IMAGE1D_ARRAY) ? inputSlicePitch : inputRowPitch;
     dc.srcSlicePitch = inputSlicePitch;
+    dc.transferAllocation = mapAllocation ? mapAllocation : hostPtrSurf.getAllocation();
     if (srcImage->getImageDesc().num_mip_levels > 0) {
         dc.srcMipLevel = findMipLevel(srcImage->getImageDesc().image_type, origin);
     }
@@ -196,8 +196,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMUnmap(void *svmPtr,
             return CL_SUCCESS;
         }
 
-        svmData->gpuAllocation->setAubWritable(true, GraphicsAllocation::defaultBank);
-        svmData->gpuAllocation->setTbxWritable(true, GraphicsAllocation::defaultBank);
+        svmData->gpuAllocation->setAubWritableRange(svmOperation->offset, svmOperation->regionSize, GraphicsAllocation::defaultBank);
+        svmData->gpuAllocation->setTbxWritableRange(svmOperation->offset, svmOperation->regionSize, GraphicsAllocation::defaultBank);
 
         MultiDispatchInfo dispatchInfo;
         auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer,
@@ -64,7 +64,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBufferRect(
     if (region[0] != 0 &&
         region[1] != 0 &&
         region[2] != 0) {
-        bool status = getGpgpuCommandStreamReceiver().createAllocationForHostSurface(hostPtrSurf, false);
+        auto &csr = blitEnqueueAllowed(CL_COMMAND_WRITE_BUFFER_RECT) ? *getBcsCommandStreamReceiver() : getGpgpuCommandStreamReceiver();
+        bool status = csr.createAllocationForHostSurface(hostPtrSurf, false);
         if (!status) {
             return CL_OUT_OF_RESOURCES;
         }
@@ -85,6 +86,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBufferRect(
     dc.srcSlicePitch = hostSlicePitch;
     dc.dstRowPitch = bufferRowPitch;
     dc.dstSlicePitch = bufferSlicePitch;
+    dc.transferAllocation = hostPtrSurf.getAllocation();
 
     MultiDispatchInfo dispatchInfo;
     builder.buildDispatchInfos(dispatchInfo, dc);
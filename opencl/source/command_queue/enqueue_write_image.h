@@ -70,7 +70,9 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteImage(
         if (region[0] != 0 &&
             region[1] != 0 &&
             region[2] != 0) {
-            bool status = getGpgpuCommandStreamReceiver().createAllocationForHostSurface(hostPtrSurf, false);
+            bool blitEnqueue = blitEnqueueAllowed(CL_COMMAND_WRITE_IMAGE) && blitEnqueueImageAllowed(*dstImage);
+            auto &csr = blitEnqueue ? *getBcsCommandStreamReceiver() : getGpgpuCommandStreamReceiver();
+            bool status = csr.createAllocationForHostSurface(hostPtrSurf, false);
             if (!status) {
                 return CL_OUT_OF_RESOURCES;
             }
@@ -89,6 +91,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteImage(
     dc.size = region;
     dc.dstRowPitch = ((dstImage->getImageDesc().image_type == CL_MEM_OBJECT_IMAGE1D_ARRAY) && (inputSlicePitch > inputRowPitch)) ? inputSlicePitch : inputRowPitch;
     dc.dstSlicePitch = inputSlicePitch;
+    dc.transferAllocation = mapAllocation ? mapAllocation : hostPtrSurf.getAllocation();
     if (dstImage->getImageDesc().num_mip_levels > 0) {
         dc.dstMipLevel = findMipLevel(dstImage->getImageDesc().image_type, origin);
     }
@@ -170,6 +170,7 @@ struct EnqueueOperation {
   private:
     static size_t getSizeRequiredCSKernel(bool reserveProfilingCmdsSpace, bool reservePerfCounters, CommandQueue &commandQueue, const Kernel *pKernel);
     static size_t getSizeRequiredCSNonKernel(bool reserveProfilingCmdsSpace, bool reservePerfCounters, CommandQueue &commandQueue);
+    static size_t getSizeRequiredCSForBlitEnqueue(CommandQueue &commandQueue);
 };
 
 template <typename GfxFamily, uint32_t eventType>
@@ -213,15 +213,7 @@ size_t EnqueueOperation<GfxFamily>::getTotalSizeRequiredCS(uint32_t eventType, c
     size_t expectedSizeCS = 0;
 
     if (blitEnqueue) {
-        auto &hwInfo = commandQueue.getDevice().getHardwareInfo();
-        auto &commandQueueHw = static_cast<CommandQueueHw<GfxFamily> &>(commandQueue);
-
-        size_t expectedSizeCS = TimestampPacketHelper::getRequiredCmdStreamSizeForNodeDependencyWithBlitEnqueue<GfxFamily>();
-        if (commandQueueHw.isCacheFlushForBcsRequired()) {
-            expectedSizeCS += MemorySynchronizationCommands<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(hwInfo);
-        }
-
-        return expectedSizeCS;
+        return EnqueueOperation<GfxFamily>::getSizeRequiredCSForBlitEnqueue(commandQueue);
     }
 
     Kernel *parentKernel = multiDispatchInfo.peekParentKernel();
@@ -239,6 +231,22 @@ size_t EnqueueOperation<GfxFamily>::getTotalSizeRequiredCS(uint32_t eventType, c
         expectedSizeCS += TimestampPacketHelper::getRequiredCmdStreamSize<GfxFamily>(csrDeps);
         expectedSizeCS += EnqueueOperation<GfxFamily>::getSizeRequiredForTimestampPacketWrite();
     }
+    if (multiDispatchInfo.isSplitBlitEnqueue()) {
+        expectedSizeCS += EnqueueOperation<GfxFamily>::getSizeRequiredCSForBlitEnqueue(commandQueue);
+    }
+    return expectedSizeCS;
+}
+
+template <typename GfxFamily>
+size_t EnqueueOperation<GfxFamily>::getSizeRequiredCSForBlitEnqueue(CommandQueue &commandQueue) {
+    auto &hwInfo = commandQueue.getDevice().getHardwareInfo();
+    auto &commandQueueHw = static_cast<CommandQueueHw<GfxFamily> &>(commandQueue);
+
+    size_t expectedSizeCS = TimestampPacketHelper::getRequiredCmdStreamSizeForNodeDependencyWithBlitEnqueue<GfxFamily>();
+    if (commandQueueHw.isCacheFlushForBcsRequired()) {
+        expectedSizeCS += MemorySynchronizationCommands<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(hwInfo);
+    }
+
     return expectedSizeCS;
 }
 
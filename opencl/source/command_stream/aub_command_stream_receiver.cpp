@@ -9,11 +9,13 @@
 
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/options.h"
 
+#include "opencl/source/aub_mem_dump/aub_file_writer.h"
 #include "opencl/source/memory_manager/os_agnostic_memory_manager.h"
 #include "opencl/source/os_interface/os_inc_base.h"
 
@@ -79,21 +81,49 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 
 extern const size_t g_dwordCountMax;
 
+AubFileStream::AubFileStream() = default;
+
+AubFileStream::~AubFileStream() = default;
+
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    // stream is written synchronously by default, so that AUB is complete up to the last flush when application crashes
+    size_t chunkSize = 0u;
+    if (NEO::DebugManager.flags.AUBDumpWriterChunkSize.get() > 0) {
+        chunkSize = static_cast<size_t>(NEO::DebugManager.flags.AUBDumpWriterChunkSize.get()) * KB;
+    } else if (NEO::DebugManager.flags.AUBDumpWriterChunkSize.get() == -1 && NEO::DebugManager.flags.AUBDumpCompression.get()) {
+        chunkSize = AubFileWriter::defaultChunkSize;
+    }
+    if (fileHandle.is_open() && chunkSize > 0) {
+        std::unique_ptr<BlockCodec> codec;
+        if (NEO::DebugManager.flags.AUBDumpCompression.get()) {
+            codec = std::make_unique<ZeroRunCodec>();
+        }
+        writer = std::make_unique<AubFileWriter>(fileHandle, chunkSize, std::move(codec));
+    }
 }
 
 void AubFileStream::close() {
+    writer.reset();
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    if (writer) {
+        writer->write(data, size);
+        return;
+    }
     fileHandle.write(data, size);
 }
 
 void AubFileStream::flush() {
+    if (writer) {
+        writer->flush();
+        return;
+    }
     fileHandle.flush();
 }
 
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/helpers/array_count.h"
+#include "shared/source/helpers/hash128.h"
 #include "shared/source/utilities/spinlock.h"
 
 #include "opencl/source/aub/aub_center.h"
@@ -18,6 +19,8 @@
 
 #include "command_stream_receiver_simulated_hw.h"
 
+#include <unordered_map>
+
 namespace NEO {
 
 class AubSubCaptureManager;
@@ -106,10 +109,17 @@ class AUBCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
 
   protected:
     constexpr static uint32_t getMaskAndValueForPollForCompletion();
+    bool isContentAlreadyDumped(uint64_t gpuAddress, const void *cpuAddress, size_t size);
 
     bool dumpAubNonWritable = false;
     ExternalAllocationsContainer externalAllocations;
 
+    struct DumpedContent {
+        size_t size = 0u;
+        Hash128Value hash = {};
+    };
+    std::unordered_map<uint64_t, DumpedContent> dumpedContents;
+
     uint32_t pollForCompletionTaskCount = 0u;
     SpinLock pollForCompletionLock;
 };
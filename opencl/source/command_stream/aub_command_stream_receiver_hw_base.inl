@@ -111,6 +111,7 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::reopenFile(const std::string &fileNa
     }
     if (!isFileOpen()) {
         initFile(fileName);
+        dumpedContents.clear();
         return true;
     }
     return false;
@@ -638,27 +639,46 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
         return false;
     }
 
-    auto streamLocked = getAubStream()->lockStream();
-
-    if (aubManager) {
-        this->writeMemoryWithAubManager(gfxAllocation);
-    } else {
-        writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+    bool oneTimeWritable = AubHelper::isOneTimeAubWritableAllocationType(gfxAllocation.getAllocationType());
+    if (oneTimeWritable) {
+        // before taking dirty pages, so pages marked meanwhile make the allocation writable again
+        this->setAubWritable(false, gfxAllocation);
     }
 
-    streamLocked.unlock();
+    bool skipDump = DebugManager.flags.AUBDumpSkipUnchangedAllocations.get() && !dumpAubNonWritable &&
+                    isContentAlreadyDumped(gpuAddress, cpuAddress, size);
 
-    if (gfxAllocation.isLocked() && ownsLock) {
-        this->getMemoryManager()->unlockResource(&gfxAllocation);
+    if (!skipDump) {
+        auto streamLocked = getAubStream()->lockStream();
+
+        if (aubManager) {
+            this->writeMemoryWithAubManager(gfxAllocation);
+        } else if (oneTimeWritable && size == gfxAllocation.getUnderlyingBufferSize()) {
+            this->writeDirtyMemory(gfxAllocation.getAubDirtyPages(), gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        } else {
+            writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        }
     }
 
-    if (AubHelper::isOneTimeAubWritableAllocationType(gfxAllocation.getAllocationType())) {
-        this->setAubWritable(false, gfxAllocation);
+    if (gfxAllocation.isLocked() && ownsLock) {
+        this->getMemoryManager()->unlockResource(&gfxAllocation);
     }
 
     return true;
 }
 
+template <typename GfxFamily>
+bool AUBCommandStreamReceiverHw<GfxFamily>::isContentAlreadyDumped(uint64_t gpuAddress, const void *cpuAddress, size_t size) {
+    auto hash = Hash128::hash(reinterpret_cast<const char *>(cpuAddress), size);
+    auto &dumpedContent = dumpedContents[gpuAddress];
+    if (dumpedContent.size == size && dumpedContent.hash == hash) {
+        return true;
+    }
+    dumpedContent.size = size;
+    dumpedContent.hash = hash;
+    return false;
+}
+
 template <typename GfxFamily>
 bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(AllocationView &allocationView) {
     GraphicsAllocation gfxAllocation(this->rootDeviceIndex, GraphicsAllocation::AllocationType::UNKNOWN, reinterpret_cast<void *>(allocationView.first), allocationView.first, 0llu, allocationView.second, MemoryPool::MemoryNull);
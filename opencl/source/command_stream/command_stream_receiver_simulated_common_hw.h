@@ -20,6 +20,7 @@ struct AubStream;
 
 namespace NEO {
 class AddressMapper;
+class DirtyPageTracker;
 class GraphicsAllocation;
 class HardwareContextController;
 template <typename GfxFamily>
@@ -55,6 +56,9 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     virtual bool writeMemory(GraphicsAllocation &gfxAllocation) = 0;
     virtual void writeMemory(uint64_t gpuAddress, void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits) = 0;
     virtual void writeMemoryWithAubManager(GraphicsAllocation &graphicsAllocation) = 0;
+    void writeDirtyMemory(DirtyPageTracker &dirtyPages, uint64_t gpuAddress, void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits);
+    uint64_t getUploadedBytes() const { return uploadedBytes; }
+    uint64_t getSkippedBytes() const { return skippedBytes; }
 
     virtual void setAubWritable(bool writable, GraphicsAllocation &graphicsAllocation) = 0;
     virtual bool isAubWritable(GraphicsAllocation &graphicsAllocation) const = 0;
@@ -78,5 +82,9 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     } engineInfo = {};
 
     AubMemDump::AubStream *stream;
+
+  protected:
+    uint64_t uploadedBytes = 0u;
+    uint64_t skippedBytes = 0u; // clean pages of allocations uploaded partially
 };
 } // namespace NEO
@@ -9,6 +9,7 @@
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/gmm_helper/resource_info.h"
+#include "shared/source/memory_manager/dirty_page_tracker.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
@@ -97,5 +98,23 @@ uint32_t CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getDeviceIndex() con
 template <typename GfxFamily>
 CommandStreamReceiverSimulatedCommonHw<GfxFamily>::CommandStreamReceiverSimulatedCommonHw(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex) : CommandStreamReceiverHw<GfxFamily>(executionEnvironment, rootDeviceIndex) {}
 template <typename GfxFamily>
-CommandStreamReceiverSimulatedCommonHw<GfxFamily>::~CommandStreamReceiverSimulatedCommonHw() = default;
+CommandStreamReceiverSimulatedCommonHw<GfxFamily>::~CommandStreamReceiverSimulatedCommonHw() {
+    if (uploadedBytes + skippedBytes > 0u) {
+        printDebugString(DebugManager.flags.PrintDebugMessages.get(), stdout,
+                         "Simulation memory uploads: %llu bytes uploaded, %llu bytes skipped\n",
+                         static_cast<unsigned long long>(uploadedBytes), static_cast<unsigned long long>(skippedBytes));
+    }
+}
+
+template <typename GfxFamily>
+void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::writeDirtyMemory(DirtyPageTracker &dirtyPages, uint64_t gpuAddress, void *cpuAddress, size_t size,
+                                                                          uint32_t memoryBank, uint64_t entryBits) {
+    size_t dirtySize = 0u;
+    dirtyPages.takeDirtyRanges(size, [&](size_t offset, size_t rangeSize) {
+        writeMemory(gpuAddress + offset, ptrOffset(cpuAddress, offset), rangeSize, memoryBank, entryBits);
+        dirtySize += rangeSize;
+    });
+    uploadedBytes += dirtySize;
+    skippedBytes += size - dirtySize;
+}
 } // namespace NEO
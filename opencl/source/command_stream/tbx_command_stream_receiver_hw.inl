@@ -370,6 +370,9 @@ void TbxCommandStreamReceiverHw<GfxFamily>::submitBatchBuffer(uint64_t batchBuff
 
         this->submitLRCA(contextDescriptor);
     }
+
+    // send batched writes so that server starts executing without waiting for the next read
+    tbxStream.flush();
 }
 
 template <typename GfxFamily>
@@ -419,16 +422,20 @@ bool TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
         return false;
     }
 
+    bool oneTimeWritable = AubHelper::isOneTimeAubWritableAllocationType(gfxAllocation.getAllocationType());
+    if (oneTimeWritable) {
+        // before taking dirty pages, so pages marked meanwhile make the allocation writable again
+        this->setTbxWritable(false, gfxAllocation);
+    }
+
     if (aubManager) {
         this->writeMemoryWithAubManager(gfxAllocation);
+    } else if (oneTimeWritable && size == gfxAllocation.getUnderlyingBufferSize()) {
+        this->writeDirtyMemory(gfxAllocation.getTbxDirtyPages(), gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
     } else {
         writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
     }
 
-    if (AubHelper::isOneTimeAubWritableAllocationType(gfxAllocation.getAllocationType())) {
-        this->setTbxWritable(false, gfxAllocation);
-    }
-
     return true;
 }
 
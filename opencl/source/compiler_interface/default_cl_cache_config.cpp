@@ -7,6 +7,7 @@
 
 #include "default_cl_cache_config.h"
 
+#include "shared/source/memory_manager/memory_constants.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 
 #include "opencl/source/os_interface/ocl_reg_path.h"
@@ -28,6 +29,15 @@ CompilerCacheConfig getDefaultClCompilerCacheConfig() {
 
     ret.cacheFileExtension = ".cl_cache";
 
+    keyName = oclRegPath;
+    keyName += "cl_cache_max_size_mb";
+    auto maxSizeInMb = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), defaultClCacheMaxSizeInMb);
+    ret.cacheSize = maxSizeInMb > 0 ? static_cast<size_t>(maxSizeInMb) * MemoryConstants::megaByte : 0u;
+
+    keyName = oclRegPath;
+    keyName += "cl_cache_map_binaries";
+    ret.mapCachedBinaries = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), false);
+
     return ret;
 }
 } // namespace NEO
@@ -10,6 +10,7 @@
 #include "shared/source/compiler_interface/compiler_cache.h"
 
 namespace NEO {
+constexpr int32_t defaultClCacheMaxSizeInMb = 1024;
 
 CompilerCacheConfig getDefaultClCompilerCacheConfig();
 }
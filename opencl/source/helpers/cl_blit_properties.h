@@ -9,6 +9,7 @@
 #include "shared/source/helpers/blit_commands_helper.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
+#include "opencl/source/mem_obj/image.h"
 
 #include "CL/cl.h"
 
@@ -83,16 +84,72 @@ struct ClBlitProperties {
                                                                      hostPtrOffset, copyOffset, builtinOpParams.size.x);
     }
 
+    static BlitProperties constructPropertiesForCopyRegion(BlitterConstants::BlitDirection blitDirection,
+                                                           CommandStreamReceiver &commandStreamReceiver,
+                                                           const BuiltinOpParams &builtinOpParams) {
+        Vec3<size_t> copyRegion = builtinOpParams.size;
+        Vec3<size_t> dstOrigin = builtinOpParams.dstOffset;
+        Vec3<size_t> srcOrigin = builtinOpParams.srcOffset;
+        size_t dstRowPitch = builtinOpParams.dstRowPitch;
+        size_t dstSlicePitch = builtinOpParams.dstSlicePitch;
+        size_t srcRowPitch = builtinOpParams.srcRowPitch;
+        size_t srcSlicePitch = builtinOpParams.srcSlicePitch;
+
+        bool readImage = (BlitterConstants::BlitDirection::BufferToHostPtr == blitDirection);
+        auto image = castToObject<Image>(readImage ? builtinOpParams.srcMemObj : builtinOpParams.dstMemObj);
+        if (image) {
+            // image region and origin are given in pixels and pitches of image operation params describe host memory
+            auto bytesPerPixel = image->getSurfaceFormatInfo().surfaceFormat.ImageElementSizeInBytes;
+            auto hostRowPitch = readImage ? builtinOpParams.srcRowPitch : builtinOpParams.dstRowPitch;
+            auto hostSlicePitch = readImage ? builtinOpParams.srcSlicePitch : builtinOpParams.dstSlicePitch;
+            hostRowPitch = hostRowPitch ? hostRowPitch : copyRegion.x * bytesPerPixel;
+            hostSlicePitch = hostSlicePitch ? hostSlicePitch : copyRegion.y * hostRowPitch;
+            copyRegion.x *= bytesPerPixel;
+
+            if (readImage) {
+                srcOrigin.x *= bytesPerPixel;
+                srcRowPitch = image->getImageDesc().image_row_pitch;
+                srcSlicePitch = image->getImageDesc().image_slice_pitch;
+                dstRowPitch = hostRowPitch;
+                dstSlicePitch = hostSlicePitch;
+            } else {
+                dstOrigin.x *= bytesPerPixel;
+                dstRowPitch = image->getImageDesc().image_row_pitch;
+                dstSlicePitch = image->getImageDesc().image_slice_pitch;
+                srcRowPitch = hostRowPitch;
+                srcSlicePitch = hostSlicePitch;
+            }
+        }
+
+        BuiltinOpParams linearParams = builtinOpParams;
+        linearParams.dstOffset = {dstOrigin.z * dstSlicePitch + dstOrigin.y * dstRowPitch + dstOrigin.x, 0, 0};
+        linearParams.srcOffset = {srcOrigin.z * srcSlicePitch + srcOrigin.y * srcRowPitch + srcOrigin.x, 0, 0};
+        linearParams.size = {copyRegion.x * copyRegion.y * copyRegion.z, 0, 0};
+
+        auto blitProperties = constructProperties(blitDirection, commandStreamReceiver, linearParams);
+        BlitProperties::setupCopyRegion(blitProperties, copyRegion, dstRowPitch, dstSlicePitch, srcRowPitch, srcSlicePitch);
+
+        return blitProperties;
+    }
+
     static BlitterConstants::BlitDirection obtainBlitDirection(uint32_t commandType) {
-        if (CL_COMMAND_WRITE_BUFFER == commandType) {
+        if (CL_COMMAND_WRITE_BUFFER == commandType || CL_COMMAND_WRITE_BUFFER_RECT == commandType ||
+            CL_COMMAND_WRITE_IMAGE == commandType) {
             return BlitterConstants::BlitDirection::HostPtrToBuffer;
-        } else if (CL_COMMAND_READ_BUFFER == commandType) {
+        } else if (CL_COMMAND_READ_BUFFER == commandType || CL_COMMAND_READ_BUFFER_RECT == commandType ||
+                   CL_COMMAND_READ_IMAGE == commandType) {
             return BlitterConstants::BlitDirection::BufferToHostPtr;
         } else {
-            UNRECOVERABLE_IF(CL_COMMAND_COPY_BUFFER != commandType);
+            UNRECOVERABLE_IF(CL_COMMAND_COPY_BUFFER != commandType && CL_COMMAND_COPY_BUFFER_RECT != commandType);
             return BlitterConstants::BlitDirection::BufferToBuffer;
         }
     }
+
+    static bool isCopyRegionCommand(uint32_t commandType) {
+        return (CL_COMMAND_READ_BUFFER_RECT == commandType) || (CL_COMMAND_WRITE_BUFFER_RECT == commandType) ||
+               (CL_COMMAND_COPY_BUFFER_RECT == commandType) || (CL_COMMAND_READ_IMAGE == commandType) ||
+               (CL_COMMAND_WRITE_IMAGE == commandType);
+    }
 };
 
 } // namespace NEO
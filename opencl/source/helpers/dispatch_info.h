@@ -195,6 +195,15 @@ struct MultiDispatchInfo {
         return builtinOpParams;
     }
 
+    // builtin kernels cover only part of the transfer, remaining part described by builtinOpParams is copied by blitter
+    void setSplitBlitEnqueue(bool splitBlitEnqueue) {
+        this->splitBlitEnqueue = splitBlitEnqueue;
+    }
+
+    bool isSplitBlitEnqueue() const {
+        return splitBlitEnqueue;
+    }
+
     void setMemObjsForAuxTranslation(const MemObjsForAuxTranslation &memObjsForAuxTranslation) {
         this->memObjsForAuxTranslation = &memObjsForAuxTranslation;
     }
@@ -209,5 +218,6 @@ struct MultiDispatchInfo {
     StackVec<MemObj *, 2> redescribedSurfaces;
     const MemObjsForAuxTranslation *memObjsForAuxTranslation = nullptr;
     Kernel *mainKernel = nullptr;
+    bool splitBlitEnqueue = false;
 };
 } // namespace NEO
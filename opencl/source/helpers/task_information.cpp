@@ -197,12 +197,25 @@ CompletionStamp &CommandComputeKernel::submit(uint32_t taskLevel, bool terminate
 
     if (kernelOperation->blitPropertiesContainer.size() > 0) {
         auto &bcsCsr = *commandQueue.getBcsCommandStreamReceiver();
-        CsrDependencies csrDeps;
-        eventsRequest.fillCsrDependencies(csrDeps, bcsCsr, CsrDependencies::DependenciesType::All);
 
-        BlitProperties::setupDependenciesForAuxTranslation(kernelOperation->blitPropertiesContainer, *timestampPacketDependencies,
-                                                           *currentTimestampPacketNodes, csrDeps,
-                                                           commandQueue.getGpgpuCommandStreamReceiver(), bcsCsr);
+        if (kernelOperation->splitBlitEnqueue) {
+            if (commandStreamReceiver.isStallingPipeControlOnNextFlushRequired()) {
+                timestampPacketDependencies->barrierNodes.add(commandStreamReceiver.getTimestampPacketAllocator()->getTag());
+            }
+
+            auto &blitProperties = *kernelOperation->blitPropertiesContainer.begin();
+            eventsRequest.fillCsrDependencies(blitProperties.csrDependencies, bcsCsr, CsrDependencies::DependenciesType::All);
+            blitProperties.csrDependencies.push_back(&timestampPacketDependencies->cacheFlushNodes);
+            blitProperties.csrDependencies.push_back(&timestampPacketDependencies->previousEnqueueNodes);
+            blitProperties.csrDependencies.push_back(&timestampPacketDependencies->barrierNodes);
+        } else {
+            CsrDependencies csrDeps;
+            eventsRequest.fillCsrDependencies(csrDeps, bcsCsr, CsrDependencies::DependenciesType::All);
+
+            BlitProperties::setupDependenciesForAuxTranslation(kernelOperation->blitPropertiesContainer, *timestampPacketDependencies,
+                                                               *currentTimestampPacketNodes, csrDeps,
+                                                               commandQueue.getGpgpuCommandStreamReceiver(), bcsCsr);
+        }
 
         auto bcsTaskCount = bcsCsr.blitBuffer(kernelOperation->blitPropertiesContainer, false);
         commandQueue.updateBcsTaskCount(bcsTaskCount);
@@ -78,6 +78,7 @@ struct KernelOperation {
 
     BlitPropertiesContainer blitPropertiesContainer;
     bool blitEnqueue = false;
+    bool splitBlitEnqueue = false;
     size_t surfaceStateHeapSizeEM = 0;
 };
 
@@ -15,6 +15,7 @@
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/pitched_copy.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -97,18 +98,11 @@ void Image::transferData(void *dest, size_t destRowPitch, size_t destSlicePitch,
         std::swap(copyRegion[1], copyRegion[2]);
     }
 
-    for (size_t slice = copyOrigin[2]; slice < (copyOrigin[2] + copyRegion[2]); slice++) {
-        auto srcSliceOffset = ptrOffset(src, srcSlicePitch * slice);
-        auto dstSliceOffset = ptrOffset(dest, destSlicePitch * slice);
+    auto srcOrigin = ptrOffset(src, srcSlicePitch * copyOrigin[2] + srcRowPitch * copyOrigin[1] + copyOrigin[0] * pixelSize);
+    auto dstOrigin = ptrOffset(dest, destSlicePitch * copyOrigin[2] + destRowPitch * copyOrigin[1] + copyOrigin[0] * pixelSize);
 
-        for (size_t height = copyOrigin[1]; height < (copyOrigin[1] + copyRegion[1]); height++) {
-            auto srcRowOffset = ptrOffset(srcSliceOffset, srcRowPitch * height);
-            auto dstRowOffset = ptrOffset(dstSliceOffset, destRowPitch * height);
-
-            memcpy_s(ptrOffset(dstRowOffset, copyOrigin[0] * pixelSize), lineWidth,
-                     ptrOffset(srcRowOffset, copyOrigin[0] * pixelSize), lineWidth);
-        }
-    }
+    PitchedCopy::copy(dstOrigin, destRowPitch, destSlicePitch, srcOrigin, srcRowPitch, srcSlicePitch,
+                      lineWidth, copyRegion[1], copyRegion[2]);
 }
 
 Image::~Image() = default;
@@ -18,17 +18,11 @@ uintptr_t PTE::map(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memor
     size_t indexStart = (vm >> shift) & mask;
     size_t indexEnd = ((vm + size - 1) >> shift) & mask;
     uintptr_t res = -1;
-    bool updateEntryBits = entryBits != PageTableEntry::nonValidBits;
     uint64_t newEntryBits = entryBits & MemoryConstants::pageMask;
     newEntryBits |= 0x1;
 
+    mapEntries(indexStart, indexEnd, entryBits, memoryBank);
     for (size_t index = indexStart; index <= indexEnd; index++) {
-        if (entries[index] == 0x0) {
-            uint64_t tmp = allocator->reserve4kPage(memoryBank);
-            entries[index] = reinterpret_cast<void *>(tmp | newEntryBits);
-        } else if (updateEntryBits) {
-            entries[index] = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask) | newEntryBits);
-        }
         res = std::min(reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask, res);
     }
     return (res & ~newEntryBits) + (vm & (pageSize - 1));
@@ -42,25 +36,56 @@ void PTE::pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits,
     size_t indexEnd = ((vm + size - 1) >> shift) & mask;
     uint64_t res = -1;
     uintptr_t rem = vm & (pageSize - 1);
-    bool updateEntryBits = entryBits != PageTableEntry::nonValidBits;
-    uint64_t newEntryBits = entryBits & MemoryConstants::pageMask;
-    newEntryBits |= 0x1;
 
-    for (size_t index = indexStart; index <= indexEnd; index++) {
-        if (entries[index] == 0x0) {
-            uint64_t tmp = allocator->reserve4kPage(memoryBank);
-            entries[index] = reinterpret_cast<void *>(tmp | newEntryBits);
-        } else if (updateEntryBits) {
-            entries[index] = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask) | newEntryBits);
+    mapEntries(indexStart, indexEnd, entryBits, memoryBank);
+
+    PageWalkRunMerger runMerger(pageWalker);
+    size_t index = indexStart;
+    while (index <= indexEnd) {
+        auto entry = reinterpret_cast<uintptr_t>(entries[index]);
+        res = entry & MemoryConstants::page4kEntryMask;
+
+        // following entries with the same bits pointing to following physical pages belong to the same run
+        size_t runEnd = index;
+        while (runEnd < indexEnd && reinterpret_cast<uintptr_t>(entries[runEnd + 1]) == entry + (runEnd + 1 - index) * pageSize) {
+            runEnd++;
         }
-        res = reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask;
 
-        size_t lSize = std::min(pageSize - rem, size);
-        pageWalker((res & ~0x1) + rem, lSize, offset, reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::pageMask);
+        size_t lSize = std::min((runEnd - index + 1) * pageSize - rem, size);
+        runMerger.add((res & ~0x1) + rem, lSize, offset, entry & MemoryConstants::pageMask);
 
         size -= lSize;
         offset += lSize;
         rem = 0;
+        index = runEnd + 1;
+    }
+    runMerger.flush();
+}
+
+void PTE::mapEntries(size_t indexStart, size_t indexEnd, uint64_t entryBits, uint32_t memoryBank) {
+    bool updateEntryBits = entryBits != PageTableEntry::nonValidBits;
+    uint64_t newEntryBits = entryBits & MemoryConstants::pageMask;
+    newEntryBits |= 0x1;
+
+    size_t index = indexStart;
+    while (index <= indexEnd) {
+        if (entries[index] == 0x0) {
+            // reserve physical memory for the whole run of unmapped pages at once
+            size_t runEnd = index;
+            while (runEnd < indexEnd && entries[runEnd + 1] == 0x0) {
+                runEnd++;
+            }
+            uint64_t tmp = allocator->reservePage(memoryBank, (runEnd - index + 1) * pageSize, pageSize);
+            for (; index <= runEnd; index++) {
+                entries[index] = reinterpret_cast<void *>(tmp | newEntryBits);
+                tmp += pageSize;
+            }
+            continue;
+        }
+        if (updateEntryBits) {
+            entries[index] = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask) | newEntryBits);
+        }
+        index++;
     }
 }
 
@@ -22,6 +22,40 @@ namespace NEO {
 class GraphicsAllocation;
 
 typedef std::function<void(uint64_t addr, size_t size, size_t offset, uint64_t entryBits)> PageWalker;
+
+// Joins ranges visited during page walk into runs of contiguous physical memory with the same entry bits,
+// so the page walker is called once per run instead of once per page.
+class PageWalkRunMerger {
+  public:
+    PageWalkRunMerger(PageWalker &pageWalker) : pageWalker(pageWalker) {}
+
+    void add(uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        if (runSize != 0 && physAddress == runPhysAddress + runSize && offset == runOffset + runSize && entryBits == runEntryBits) {
+            runSize += size;
+            return;
+        }
+        flush();
+        runPhysAddress = physAddress;
+        runSize = size;
+        runOffset = offset;
+        runEntryBits = entryBits;
+    }
+
+    void flush() {
+        if (runSize != 0) {
+            pageWalker(runPhysAddress, runSize, runOffset, runEntryBits);
+            runSize = 0;
+        }
+    }
+
+  protected:
+    PageWalker &pageWalker;
+    uint64_t runPhysAddress = 0;
+    size_t runSize = 0;
+    size_t runOffset = 0;
+    uint64_t runEntryBits = 0;
+};
+
 template <class T, uint32_t level, uint32_t bits = 9>
 class PageTable {
   public:
@@ -60,6 +94,9 @@ class PTE : public PageTable<void, 0u> {
 
     static const uint32_t level = 0;
     static const uint32_t bits = 9;
+
+  protected:
+    void mapEntries(size_t indexStart, size_t indexEnd, uint64_t entryBits, uint32_t memoryBank);
 };
 
 class PDE : public PageTable<class PTE, 1> {
@@ -54,6 +54,12 @@ inline void PageTable<T, level, bits>::pageWalk(uintptr_t vm, size_t size, size_
     uintptr_t vmMask = (uintptr_t(-1) >> (sizeof(void *) * 8 - shift - bits));
     auto maskedVm = vm & vmMask;
 
+    // runs contiguous in physical memory may span multiple child tables
+    PageWalkRunMerger runMerger(pageWalker);
+    PageWalker mergingWalker = [&runMerger](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        runMerger.add(physAddress, size, offset, entryBits);
+    };
+
     for (size_t index = indexStart; index <= indexEnd; index++) {
         uintptr_t vmStart = (uintptr_t(1) << shift) * index;
         vmStart = std::max(vmStart, maskedVm);
@@ -63,9 +69,10 @@ inline void PageTable<T, level, bits>::pageWalk(uintptr_t vm, size_t size, size_
         if (entries[index] == nullptr) {
             entries[index] = new T(allocator);
         }
-        entries[index]->pageWalk(vmStart, vmEnd - vmStart + 1, offset, entryBits, pageWalker, memoryBank);
+        entries[index]->pageWalk(vmStart, vmEnd - vmStart + 1, offset, entryBits, mergingWalker, memoryBank);
 
         offset += (vmEnd - vmStart + 1);
     }
+    runMerger.flush();
 }
 } // namespace NEO
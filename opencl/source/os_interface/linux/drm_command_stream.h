@@ -56,8 +56,17 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
     void flushInternal(const BatchBuffer &batchBuffer, const ResidencyContainer &allocationsForResidency);
     void exec(const BatchBuffer &batchBuffer, uint32_t drmContextId);
 
+    void fillExecObjects(uint32_t drmContextId);
+
     std::vector<BufferObject *> residency;
     std::vector<drm_i915_gem_exec_object2> execObjectsStorage;
+    // BO whose exec object is kept at the same index of execObjectsStorage from previous submissions
+    std::vector<const BufferObject *> execObjectsOwners;
+    // set by makeResident when residency differs from execObjectsOwners, exec objects are reused as a whole otherwise
+    bool residencyChanged = true;
+    size_t filledResidencyCount = 0u;
+    uint32_t filledDrmContextId = 0u;
+    uint64_t filledBufferObjectsDestroyedCount = 0u;
     Drm *drm;
     gemCloseWorkerMode gemCloseWorkerOperationMode;
 };
@@ -35,6 +35,7 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
     this->drm = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->osInterface->get()->getDrm();
     residency.reserve(512);
     execObjectsStorage.reserve(512);
+    execObjectsOwners.reserve(512);
 }
 
 template <typename GfxFamily>
@@ -73,23 +74,45 @@ void DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, u
 
     auto engineFlag = static_cast<OsContextLinux *>(osContext)->getEngineFlag();
 
-    // Residency hold all allocation except command buffer, hence + 1
-    auto requiredSize = this->residency.size() + 1;
-    if (requiredSize > this->execObjectsStorage.size()) {
-        this->execObjectsStorage.resize(requiredSize);
-    }
+    this->fillExecObjects(drmContextId);
 
     int err = bb->exec(static_cast<uint32_t>(alignUp(batchBuffer.usedSize - batchBuffer.startOffset, 8)),
                        batchBuffer.startOffset, engineFlag | I915_EXEC_NO_RELOC,
                        batchBuffer.requiresCoherency,
                        drmContextId,
-                       this->residency.data(), this->residency.size(),
+                       this->residency.size(),
                        this->execObjectsStorage.data());
     UNRECOVERABLE_IF(err != 0);
 
     this->residency.clear();
 }
 
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::fillExecObjects(uint32_t drmContextId) {
+    auto bufferObjectsDestroyedCount = BufferObject::getDestroyedCount();
+    if (!this->residencyChanged && this->residency.size() == this->filledResidencyCount &&
+        drmContextId == this->filledDrmContextId && bufferObjectsDestroyedCount == this->filledBufferObjectsDestroyedCount) {
+        return;
+    }
+
+    // Residency hold all allocation except command buffer, hence + 1
+    auto requiredSize = this->residency.size() + 1;
+    if (requiredSize > this->execObjectsStorage.size()) {
+        this->execObjectsStorage.resize(requiredSize);
+    }
+    this->execObjectsOwners.resize(this->execObjectsStorage.size(), nullptr);
+
+    // Submissions mostly repeat the same residency, so only exec objects of changed entries are filled
+    BufferObject::fillExecObjects(this->residency.data(), this->residency.size(), this->execObjectsOwners.data(), this->execObjectsStorage.data(), drmContextId);
+    // command buffer's exec object is filled by exec
+    this->execObjectsOwners[this->residency.size()] = nullptr;
+
+    this->residencyChanged = false;
+    this->filledResidencyCount = this->residency.size();
+    this->filledDrmContextId = drmContextId;
+    this->filledBufferObjectsDestroyedCount = bufferObjectsDestroyedCount;
+}
+
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::makeResident(BufferObject *bo) {
     if (bo) {
@@ -101,6 +124,10 @@ void DrmCommandStreamReceiver<GfxFamily>::makeResident(BufferObject *bo) {
             }
         }
 
+        auto index = residency.size();
+        if (index >= execObjectsOwners.size() || execObjectsOwners[index] != bo) {
+            residencyChanged = true;
+        }
         residency.push_back(bo);
     }
 }
@@ -131,6 +158,7 @@ void DrmCommandStreamReceiver<GfxFamily>::makeNonResident(GraphicsAllocation &gf
     if (gfxAllocation.isResident(this->osContext->getContextId())) {
         if (this->residency.size() != 0) {
             this->residency.clear();
+            this->residencyChanged = true;
         }
         for (auto fragmentId = 0u; fragmentId < gfxAllocation.fragmentsStorage.fragmentCount; fragmentId++) {
             gfxAllocation.fragmentsStorage.fragmentStorageData[fragmentId].residency->resident[osContext->getContextId()] = false;
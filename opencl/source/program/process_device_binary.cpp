@@ -121,7 +121,8 @@ cl_int Program::linkBinary() {
 }
 
 cl_int Program::processGenBinary() {
-    if (nullptr == this->unpackedDeviceBinary) {
+    auto blob = this->getUnpackedDeviceBinary();
+    if (blob.empty()) {
         return CL_INVALID_BINARY;
     }
 
@@ -134,7 +135,6 @@ cl_int Program::processGenBinary() {
     }
 
     ProgramInfo programInfo;
-    auto blob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
     SingleDeviceBinary binary = {};
     binary.deviceBinary = blob;
     std::string decodeErrors;
@@ -174,6 +174,16 @@ cl_int Program::processProgramInfo(ProgramInfo &src) {
 
     this->linkerInput = std::move(src.linkerInput);
     this->kernelInfoArray = std::move(src.kernelInfos);
+    if (!kernelsToLoad.empty() && linkerInput == nullptr && !isKernelDebugEnabled()) {
+        // relocations and debug data refer to kernels by their index, so kernels are discarded only when neither is used
+        for (auto &kernelInfo : this->kernelInfoArray) {
+            if (std::find(kernelsToLoad.begin(), kernelsToLoad.end(), kernelInfo->name) == kernelsToLoad.end()) {
+                delete kernelInfo;
+                kernelInfo = nullptr;
+            }
+        }
+        this->kernelInfoArray.erase(std::remove(this->kernelInfoArray.begin(), this->kernelInfoArray.end(), nullptr), this->kernelInfoArray.end());
+    }
     auto svmAllocsManager = context ? context->getSVMAllocsManager() : nullptr;
     if (src.globalConstants.size != 0) {
         UNRECOVERABLE_IF(nullptr == pDevice);
@@ -143,6 +143,7 @@ cl_int Program::createProgramFromBinary(
     this->isSpirV = false;
     this->unpackedDeviceBinary.reset();
     this->unpackedDeviceBinarySize = 0U;
+    this->mappedUnpackedDeviceBinary.reset();
     this->packedDeviceBinary.reset();
     this->packedDeviceBinarySize = 0U;
     this->createdFrom = CreatedFrom::BINARY;
@@ -418,6 +419,7 @@ void Program::updateNonUniformFlag(const Program **inputPrograms, size_t numInpu
 }
 
 void Program::replaceDeviceBinary(std::unique_ptr<char[]> newBinary, size_t newBinarySize) {
+    this->mappedUnpackedDeviceBinary.reset();
     if (isAnyPackedDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<uint8_t *>(newBinary.get()), newBinarySize))) {
         this->packedDeviceBinary = std::move(newBinary);
         this->packedDeviceBinarySize = newBinarySize;
@@ -431,6 +433,30 @@ void Program::replaceDeviceBinary(std::unique_ptr<char[]> newBinary, size_t newB
     }
 }
 
+void Program::replaceDeviceBinaryWithMappedFile(std::unique_ptr<OsMappedFile> mappedBinary) {
+    auto binary = mappedBinary->getData();
+    if (isAnyPackedDeviceBinaryFormat(ArrayRef<const uint8_t>::fromAny(binary.begin(), binary.size()))) {
+        replaceDeviceBinary(makeCopy(binary.begin(), binary.size()), binary.size());
+        return;
+    }
+    this->packedDeviceBinary.reset();
+    this->packedDeviceBinarySize = 0U;
+    this->unpackedDeviceBinary.reset();
+    this->unpackedDeviceBinarySize = 0U;
+    this->mappedUnpackedDeviceBinary = std::move(mappedBinary);
+}
+
+ArrayRef<const uint8_t> Program::getUnpackedDeviceBinary() const {
+    if (nullptr != this->mappedUnpackedDeviceBinary) {
+        auto binary = this->mappedUnpackedDeviceBinary->getData();
+        return ArrayRef<const uint8_t>::fromAny(binary.begin(), binary.size());
+    }
+    if (nullptr == this->unpackedDeviceBinary) {
+        return {};
+    }
+    return ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
+}
+
 cl_int Program::packDeviceBinary() {
     if (nullptr != packedDeviceBinary) {
         return CL_SUCCESS;
@@ -439,12 +465,12 @@ cl_int Program::packDeviceBinary() {
     auto gfxCore = pDevice->getHardwareInfo().platform.eRenderCoreFamily;
     auto stepping = pDevice->getHardwareInfo().platform.usRevId;
 
-    if (nullptr != this->unpackedDeviceBinary.get()) {
+    if (false == this->getUnpackedDeviceBinary().empty()) {
         SingleDeviceBinary singleDeviceBinary;
         singleDeviceBinary.buildOptions = this->options;
         singleDeviceBinary.targetDevice.coreFamily = gfxCore;
         singleDeviceBinary.targetDevice.stepping = stepping;
-        singleDeviceBinary.deviceBinary = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
+        singleDeviceBinary.deviceBinary = this->getUnpackedDeviceBinary();
         singleDeviceBinary.intermediateRepresentation = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->irBinary.get()), this->irBinarySize);
         std::string packWarnings;
         std::string packErrors;
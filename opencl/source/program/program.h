@@ -238,6 +238,11 @@ class Program : public BaseObject<_cl_program> {
         kernelDebugEnabled = true;
     }
 
+    // when set, kernels not listed are discarded before their ISA is allocated
+    void setKernelsToLoad(std::vector<std::string> kernelNames) {
+        kernelsToLoad = std::move(kernelNames);
+    }
+
     bool isKernelDebugEnabled() {
         return kernelDebugEnabled;
     }
@@ -259,6 +264,8 @@ class Program : public BaseObject<_cl_program> {
     }
 
     MOCKABLE_VIRTUAL void replaceDeviceBinary(std::unique_ptr<char[]> newBinary, size_t newBinarySize);
+    void replaceDeviceBinaryWithMappedFile(std::unique_ptr<OsMappedFile> mappedBinary);
+    ArrayRef<const uint8_t> getUnpackedDeviceBinary() const;
 
   protected:
     Program(ExecutionEnvironment &executionEnvironment);
@@ -292,6 +299,7 @@ class Program : public BaseObject<_cl_program> {
 
     std::unique_ptr<char[]> unpackedDeviceBinary;
     size_t unpackedDeviceBinarySize = 0U;
+    std::unique_ptr<OsMappedFile> mappedUnpackedDeviceBinary; // used instead of unpackedDeviceBinary for binaries mapped from compiler cache
 
     std::unique_ptr<char[]> packedDeviceBinary;
     size_t packedDeviceBinarySize = 0U;
@@ -304,6 +312,7 @@ class Program : public BaseObject<_cl_program> {
     std::vector<KernelInfo *> kernelInfoArray;
     std::vector<KernelInfo *> parentKernelInfoArray;
     std::vector<KernelInfo *> subgroupKernelInfoArray;
+    std::vector<std::string> kernelsToLoad;
 
     GraphicsAllocation *constantSurface = nullptr;
     GraphicsAllocation *globalSurface = nullptr;
@@ -27,6 +27,9 @@ class TbxSockets {
     virtual bool readMMIO(uint32_t offset, uint32_t *value) = 0;
     virtual bool writeMMIO(uint32_t offset, uint32_t value) = 0;
 
+    // sends all writes collected so far to the server
+    virtual bool flush() = 0;
+
     static TbxSockets *create();
 };
 } // namespace NEO
@@ -7,6 +7,8 @@
 
 #include "opencl/source/tbx/tbx_sockets_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 
@@ -18,6 +20,7 @@ typedef int socklen_t;
 #else
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <netinet/tcp.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
@@ -32,12 +35,20 @@ typedef struct sockaddr SOCKADDR;
 
 namespace NEO {
 
+constexpr size_t TbxSocketsImp::defaultSendBatchSize;
+constexpr size_t TbxSocketsImp::invalidOffset;
+
 TbxSocketsImp::TbxSocketsImp(std::ostream &err)
     : cerrStream(err) {
+    if (DebugManager.flags.TbxSendBatchSize.get() != -1) {
+        sendBatchSize = static_cast<size_t>(DebugManager.flags.TbxSendBatchSize.get()) * KB;
+    }
+    sendBuffer.reserve(sendBatchSize);
 }
 
 void TbxSocketsImp::close() {
     if (0 != m_socket) {
+        flush();
 #ifdef WIN32
         ::shutdown(m_socket, 0x02 /*SD_BOTH*/);
 
@@ -97,6 +108,12 @@ bool TbxSocketsImp::init(const std::string &hostNameOrIp, uint16_t port) {
         cmd.u.control_req.has = 1;
 
         sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+
+        if (isBatchingEnabled()) {
+            // batches are sent on reads, don't let small read requests wait for acknowledgment of preceding batch
+            int noDelay = 1;
+            ::setsockopt(m_socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char *>(&noDelay), sizeof(noDelay));
+        }
     } while (false);
 
     return m_socket != INVALID_SOCKET;
@@ -146,7 +163,7 @@ bool TbxSocketsImp::readMMIO(uint32_t offset, uint32_t *data) {
         cmd.u.mmio_req.msg_type = MSG_TYPE_MMIO;
         cmd.u.mmio_req.size = sizeof(uint32_t);
 
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+        success = queueData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size) && flush();
         if (!success) {
             break;
         }
@@ -183,7 +200,7 @@ bool TbxSocketsImp::writeMMIO(uint32_t offset, uint32_t value) {
     cmd.u.mmio_req.write = 1;
     cmd.u.mmio_req.size = sizeof(uint32_t);
 
-    return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+    return queueData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
 }
 
 bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
@@ -202,7 +219,7 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
 
     bool success;
     do {
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ));
+        success = queueData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ)) && flush();
         if (!success) {
             break;
         }
@@ -227,6 +244,22 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
 }
 
 bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size, uint32_t type) {
+    auto messageSize = sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ);
+    if (pendingWriteOffset != invalidOffset && pendingWriteEndAddress == physAddr && pendingWriteType == type &&
+        sendBuffer.size() + size <= sendBatchSize) {
+        // extend previous write message in place
+        HAS_WRITE_DATA_REQ writeReq;
+        auto writeReqData = &sendBuffer[pendingWriteOffset + sizeof(HAS_HDR)];
+        memcpy_s(&writeReq, sizeof(writeReq), writeReqData, sizeof(writeReq));
+        writeReq.size += static_cast<uint32_t>(size);
+        memcpy_s(writeReqData, sizeof(writeReq), &writeReq, sizeof(writeReq));
+
+        auto dataBuffer = reinterpret_cast<const char *>(data);
+        sendBuffer.insert(sendBuffer.end(), dataBuffer, dataBuffer + size);
+        pendingWriteEndAddress += size;
+        return true;
+    }
+
     HAS_MSG cmd;
     memset(&cmd, 0, sizeof(cmd));
     cmd.hdr.msg_type = HAS_WRITE_DATA_REQ_TYPE;
@@ -242,9 +275,29 @@ bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size
     cmd.u.write_req.cacheline_disable = cmd.u.write_req.frontdoor;
     cmd.u.write_req.memory_type = type;
 
+    if (isBatchingEnabled() && messageSize + size <= sendBatchSize) {
+        if (sendBuffer.size() + messageSize + size > sendBatchSize && !flush()) {
+            return false;
+        }
+        auto writeOffset = sendBuffer.size();
+        auto dataBuffer = reinterpret_cast<const char *>(data);
+        sendBuffer.insert(sendBuffer.end(), reinterpret_cast<const char *>(&cmd), reinterpret_cast<const char *>(&cmd) + messageSize);
+        sendBuffer.insert(sendBuffer.end(), dataBuffer, dataBuffer + size);
+
+        pendingWriteOffset = writeOffset;
+        pendingWriteEndAddress = physAddr + size;
+        pendingWriteType = type;
+        return true;
+    }
+
     bool success;
     do {
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ));
+        success = flush();
+        if (!success) {
+            break;
+        }
+
+        success = sendWriteData(&cmd, messageSize);
         if (!success) {
             break;
         }
@@ -271,7 +324,30 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     cmd.u.gtt64_req.data = static_cast<uint32_t>(entry & 0xffffffff);
     cmd.u.gtt64_req.data_h = static_cast<uint32_t>(entry >> 32);
 
-    return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+    return queueData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+}
+
+bool TbxSocketsImp::flush() {
+    pendingWriteOffset = invalidOffset;
+    if (sendBuffer.empty()) {
+        return true;
+    }
+    auto success = sendWriteData(sendBuffer.data(), sendBuffer.size());
+    sendBuffer.clear();
+    return success;
+}
+
+bool TbxSocketsImp::queueData(const void *buffer, size_t sizeInBytes) {
+    if (!isBatchingEnabled()) {
+        return sendWriteData(buffer, sizeInBytes);
+    }
+    if (sendBuffer.size() + sizeInBytes > sendBatchSize && !flush()) {
+        return false;
+    }
+    pendingWriteOffset = invalidOffset;
+    auto dataBuffer = reinterpret_cast<const char *>(buffer);
+    sendBuffer.insert(sendBuffer.end(), dataBuffer, dataBuffer + sizeInBytes);
+    return true;
 }
 
 bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
@@ -11,11 +11,17 @@
 #include "os_socket.h"
 
 #include <iostream>
+#include <vector>
 
 namespace NEO {
 
+// Write messages (memory, MMIO, GTT) are collected in a send buffer and sent together,
+// consecutive memory writes to contiguous addresses are merged into a single message.
+// The buffer is sent before each read, so reads observe all preceding writes.
 class TbxSocketsImp : public TbxSockets {
   public:
+    static constexpr size_t defaultSendBatchSize = 1024 * 1024;
+
     TbxSocketsImp(std::ostream &err = std::cerr);
     ~TbxSocketsImp() override = default;
 
@@ -30,6 +36,8 @@ class TbxSocketsImp : public TbxSockets {
     bool readMMIO(uint32_t offset, uint32_t *data) override;
     bool writeMMIO(uint32_t offset, uint32_t data) override;
 
+    bool flush() override;
+
   protected:
     std::ostream &cerrStream;
     SOCKET m_socket = 0;
@@ -37,11 +45,22 @@ class TbxSocketsImp : public TbxSockets {
     bool connectToServer(const std::string &hostNameOrIp, uint16_t port);
     bool sendWriteData(const void *buffer, size_t sizeInBytes);
     bool getResponseData(void *buffer, size_t sizeInBytes);
+    bool queueData(const void *buffer, size_t sizeInBytes);
+    bool isBatchingEnabled() const { return sendBatchSize > 0; }
 
     inline uint32_t getNextTransID() { return transID++; }
 
     void logErrorInfo(const char *tag);
 
     uint32_t transID = 0;
+
+    size_t sendBatchSize = defaultSendBatchSize;
+    std::vector<char> sendBuffer;
+
+    // last memory write in sendBuffer, extended by following writes to contiguous addresses
+    static constexpr size_t invalidOffset = static_cast<size_t>(-1);
+    size_t pendingWriteOffset = invalidOffset;
+    uint64_t pendingWriteEndAddress = 0;
+    uint32_t pendingWriteType = 0;
 };
 } // namespace NEO
@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/tracing/tracing_recorder.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include "opencl/source/tracing/tracing_api.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+namespace HostSideTracing {
+
+namespace {
+std::atomic<uint64_t> nextRecorderId{1u};
+
+uint64_t getTimeNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+} // namespace
+
+constexpr size_t TracingRecorder::defaultRecordsPerThread;
+constexpr size_t TracingRecorder::recordsPerChunk;
+
+thread_local TracingRecorder::ThreadBuffers TracingRecorder::currentThreadBuffers;
+
+TracingRecorder::ThreadBuffers::~ThreadBuffers() {
+    for (auto &weakThreadBuffer : threadBuffers) {
+        if (auto threadBuffer = weakThreadBuffer.lock()) {
+            threadBuffer->ownerExited.store(true, std::memory_order_release);
+        }
+    }
+}
+
+TracingRecorder::TracingRecorder(const std::string &outputFileName, size_t recordsPerThread)
+    : outputFileName(outputFileName), recordsPerThread(Math::nextPowerOfTwo(std::max(recordsPerThread, static_cast<size_t>(1u)))),
+      recorderId(nextRecorderId++), tracingHandle(callback, this) {
+    for (uint32_t fid = 0; fid < CL_FUNCTION_COUNT; fid++) {
+        tracingHandle.setTracingPoint(static_cast<cl_function_id>(fid), true);
+    }
+    clTracingHandle.handle = &tracingHandle;
+    startTimestamp = NEO::CpuIntrinsics::rdtsc();
+    startTimeNs = getTimeNs();
+}
+
+TracingRecorder::~TracingRecorder() {
+    if (enabled) {
+        disable();
+        exportToFile();
+    }
+}
+
+bool TracingRecorder::enable() {
+    if (enabled) {
+        return true;
+    }
+    enabled = (CL_SUCCESS == clEnableTracingINTEL(&clTracingHandle));
+    return enabled;
+}
+
+void TracingRecorder::disable() {
+    if (enabled) {
+        // waits for all api calls being traced to finish
+        clDisableTracingINTEL(&clTracingHandle);
+        enabled = false;
+    }
+}
+
+void TracingRecorder::callback(cl_function_id, cl_callback_data *callbackData, void *userData) {
+    if (callbackData->site == CL_CALLBACK_SITE_ENTER) {
+        *callbackData->correlationData = NEO::CpuIntrinsics::rdtsc();
+    } else {
+        reinterpret_cast<TracingRecorder *>(userData)->record(*callbackData);
+    }
+}
+
+TracingRecorder::ThreadBuffer &TracingRecorder::getThreadBuffer() {
+    auto &threadLocalBuffers = currentThreadBuffers;
+    if (threadLocalBuffers.cachedRecorderId == recorderId) {
+        return *threadLocalBuffers.cachedThreadBuffer;
+    }
+
+    std::shared_ptr<ThreadBuffer> threadBuffer;
+    {
+        std::lock_guard<std::mutex> lock(threadBuffersMutex);
+        auto exitedOwnerBuffer = std::find_if(threadBuffers.begin(), threadBuffers.end(), [](const std::shared_ptr<ThreadBuffer> &buffer) {
+            return buffer->ownerExited.load(std::memory_order_acquire);
+        });
+        if (exitedOwnerBuffer != threadBuffers.end()) {
+            // records of exited thread are kept until overwritten by the new owner
+            threadBuffer = *exitedOwnerBuffer;
+            threadBuffer->ownerExited = false;
+        } else {
+            threadBuffer = std::make_shared<ThreadBuffer>(recordsPerThread);
+            threadBuffers.push_back(threadBuffer);
+        }
+        threadBuffer->threadId = ++threadsCount;
+    }
+
+    auto &weakThreadBuffers = threadLocalBuffers.threadBuffers;
+    weakThreadBuffers.erase(std::remove_if(weakThreadBuffers.begin(), weakThreadBuffers.end(), [](const std::weak_ptr<ThreadBuffer> &weakThreadBuffer) { return weakThreadBuffer.expired(); }),
+                            weakThreadBuffers.end());
+    weakThreadBuffers.push_back(threadBuffer);
+    threadLocalBuffers.cachedRecorderId = recorderId;
+    threadLocalBuffers.cachedThreadBuffer = threadBuffer.get();
+    return *threadBuffer;
+}
+
+void TracingRecorder::record(const cl_callback_data &callbackData) {
+    auto exitTimestamp = NEO::CpuIntrinsics::rdtsc();
+    auto &threadBuffer = getThreadBuffer();
+
+    auto position = static_cast<size_t>(threadBuffer.count & (threadBuffer.capacity - 1));
+    if (position / threadBuffer.chunkSize == threadBuffer.chunks.size()) {
+        threadBuffer.chunks.emplace_back(new TracingRecord[threadBuffer.chunkSize]);
+    }
+    auto &record = threadBuffer.getRecord(threadBuffer.count);
+    record.enterTimestamp = *callbackData.correlationData;
+    record.exitTimestamp = exitTimestamp;
+    record.functionName = callbackData.functionName;
+    record.correlationId = callbackData.correlationId;
+    record.threadId = threadBuffer.threadId;
+    threadBuffer.count++;
+}
+
+uint64_t TracingRecorder::getRecordsCount() const {
+    std::lock_guard<std::mutex> lock(threadBuffersMutex);
+    uint64_t recordsCount = 0u;
+    for (auto &threadBuffer : threadBuffers) {
+        recordsCount += std::min(threadBuffer->count, static_cast<uint64_t>(threadBuffer->capacity));
+    }
+    return recordsCount;
+}
+
+uint64_t TracingRecorder::getDroppedRecordsCount() const {
+    std::lock_guard<std::mutex> lock(threadBuffersMutex);
+    uint64_t droppedRecordsCount = 0u;
+    for (auto &threadBuffer : threadBuffers) {
+        if (threadBuffer->count > threadBuffer->capacity) {
+            droppedRecordsCount += threadBuffer->count - threadBuffer->capacity;
+        }
+    }
+    return droppedRecordsCount;
+}
+
+std::string TracingRecorder::exportChromeTrace() const {
+    // TSC frequency is calibrated against steady clock over whole recording
+    auto ticks = NEO::CpuIntrinsics::rdtsc() - startTimestamp;
+    auto timeNs = getTimeNs() - startTimeNs;
+    double usPerTick = (ticks > 0u) ? static_cast<double>(timeNs) / 1000.0 / static_cast<double>(ticks) : 0.0;
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "{\"traceEvents\":[";
+
+    bool first = true;
+    std::lock_guard<std::mutex> lock(threadBuffersMutex);
+    for (auto &threadBuffer : threadBuffers) {
+        auto recordsCount = std::min(threadBuffer->count, static_cast<uint64_t>(threadBuffer->capacity));
+        for (auto i = threadBuffer->count - recordsCount; i < threadBuffer->count; i++) {
+            auto &record = threadBuffer->getRecord(i);
+            auto enter = record.enterTimestamp - startTimestamp;
+            auto duration = record.exitTimestamp - record.enterTimestamp;
+
+            ss << (first ? "\n" : ",\n");
+            ss << "{\"name\":\"" << record.functionName << "\",\"cat\":\"api\",\"ph\":\"X\""
+               << ",\"ts\":" << enter * usPerTick << ",\"dur\":" << duration * usPerTick
+               << ",\"pid\":0,\"tid\":" << record.threadId
+               << ",\"args\":{\"correlationId\":" << record.correlationId << "}}";
+            first = false;
+        }
+    }
+    ss << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    return ss.str();
+}
+
+bool TracingRecorder::exportToFile() const {
+    auto trace = exportChromeTrace();
+    return trace.size() == writeDataToFile(outputFileName.c_str(), trace.c_str(), trace.size());
+}
+
+void initTracingRecorder() {
+    static std::once_flag recorderCreated;
+    static std::unique_ptr<TracingRecorder> recorder;
+    std::call_once(recorderCreated, []() {
+        auto outputFileName = NEO::DebugManager.flags.HostSideTracingRecorderFile.get();
+        if (outputFileName == "unk") {
+            return;
+        }
+        size_t recordsPerThread = TracingRecorder::defaultRecordsPerThread;
+        if (NEO::DebugManager.flags.HostSideTracingRecorderBufferSize.get() > 0) {
+            recordsPerThread = static_cast<size_t>(NEO::DebugManager.flags.HostSideTracingRecorderBufferSize.get());
+        }
+        recorder = std::make_unique<TracingRecorder>(outputFileName, recordsPerThread);
+        recorder->enable();
+    });
+}
+
+} // namespace HostSideTracing
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "opencl/source/tracing/tracing_handle.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace HostSideTracing {
+
+struct TracingRecord {
+    uint64_t enterTimestamp; // TSC ticks
+    uint64_t exitTimestamp;  // TSC ticks
+    const char *functionName;
+    uint32_t correlationId;
+    uint32_t threadId;
+};
+static_assert(sizeof(TracingRecord) == 32, "");
+
+// Built-in tracing client, records every api call to per thread buffers
+// and exports them in Chrome trace (also accepted by Perfetto) format.
+// When thread buffer is full, the oldest records are overwritten.
+// Buffers grow in chunks as records are written and are reused by new threads once their thread exits.
+class TracingRecorder {
+  public:
+    static constexpr size_t defaultRecordsPerThread = 64 * 1024;
+    static constexpr size_t recordsPerChunk = 1024;
+
+    TracingRecorder(const std::string &outputFileName, size_t recordsPerThread);
+    MOCKABLE_VIRTUAL ~TracingRecorder();
+
+    TracingRecorder(const TracingRecorder &) = delete;
+    TracingRecorder &operator=(const TracingRecorder &) = delete;
+
+    bool enable();
+    void disable();
+    bool isEnabled() const { return enabled; }
+
+    // must not be called while recording is enabled
+    std::string exportChromeTrace() const;
+    MOCKABLE_VIRTUAL bool exportToFile() const;
+
+    uint64_t getRecordsCount() const;
+    uint64_t getDroppedRecordsCount() const;
+
+    static void callback(cl_function_id fid, cl_callback_data *callbackData, void *userData);
+
+  protected:
+    struct ThreadBuffer {
+        ThreadBuffer(size_t capacity) : capacity(capacity), chunkSize(std::min(capacity, recordsPerChunk)) {}
+        TracingRecord &getRecord(uint64_t index) {
+            auto position = static_cast<size_t>(index & (capacity - 1));
+            return chunks[position / chunkSize][position % chunkSize];
+        }
+        std::vector<std::unique_ptr<TracingRecord[]>> chunks;
+        const size_t capacity;  // power of 2
+        const size_t chunkSize; // power of 2
+        uint32_t threadId = 0u;
+        uint64_t count = 0u;                  // written by owning thread only
+        std::atomic<bool> ownerExited{false}; // set by owning thread on exit
+    };
+
+    // buffers used by the current thread, marked as free for new threads when the thread ends
+    struct ThreadBuffers {
+        ~ThreadBuffers();
+        uint64_t cachedRecorderId = 0u;
+        ThreadBuffer *cachedThreadBuffer = nullptr;
+        std::vector<std::weak_ptr<ThreadBuffer>> threadBuffers;
+    };
+    static thread_local ThreadBuffers currentThreadBuffers;
+
+    ThreadBuffer &getThreadBuffer();
+    void record(const cl_callback_data &callbackData);
+
+    const std::string outputFileName;
+    const size_t recordsPerThread;
+    const uint64_t recorderId;
+
+    uint64_t startTimestamp = 0u;
+    uint64_t startTimeNs = 0u;
+
+    TracingHandle tracingHandle;
+    _cl_tracing_handle clTracingHandle = {};
+    bool enabled = false;
+
+    mutable std::mutex threadBuffersMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers;
+    uint32_t threadsCount = 0u;
+};
+
+// Creates global recorder when HostSideTracingRecorderFile debug variable is set
+void initTracingRecorder();
+
+} // namespace HostSideTracing
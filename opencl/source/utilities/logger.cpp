@@ -15,6 +15,7 @@
 #include "opencl/source/kernel/kernel.h"
 #include "opencl/source/mem_obj/mem_obj.h"
 
+#include <cstring>
 #include <memory>
 #include <string>
 
@@ -34,6 +35,10 @@ FileLogger<DebugLevel>::FileLogger(std::string filename, const DebugVariables &f
     dumpKernelArgsEnabled = flags.DumpKernelArgs.get();
     logApiCalls = flags.LogApiCalls.get();
     logAllocationMemoryPool = flags.LogAllocationMemoryPool.get();
+
+    if (enabled() && flags.LogToBinaryFile.get()) {
+        binaryLogWriter = std::make_unique<BinaryLogWriter>(logFileName + ".bin");
+    }
 }
 
 template <DebugFunctionalityLevel DebugLevel>
@@ -48,6 +53,16 @@ void FileLogger<DebugLevel>::writeToFile(std::string filename, const char *str,
     }
 }
 
+template <DebugFunctionalityLevel DebugLevel>
+void FileLogger<DebugLevel>::appendToLog(const std::string &str) {
+    if (binaryLogWriter) {
+        binaryLogWriter->write(BinaryLog::RecordType::Text, 0, str.c_str(), str.size());
+        return;
+    }
+    std::unique_lock<std::mutex> theLock(mtx);
+    writeToFile(logFileName, str.c_str(), str.size(), std::ios::app);
+}
+
 template <DebugFunctionalityLevel DebugLevel>
 void FileLogger<DebugLevel>::dumpKernel(const std::string &name, const std::string &src) {
     if (false == enabled()) {
@@ -67,6 +82,12 @@ void FileLogger<DebugLevel>::logApiCall(const char *function, bool enter, int32_
     }
 
     if (logApiCalls) {
+        if (binaryLogWriter) {
+            binaryLogWriter->write(enter ? BinaryLog::RecordType::ApiEnter : BinaryLog::RecordType::ApiLeave,
+                                   errorCode, function, strlen(function));
+            return;
+        }
+
         std::unique_lock<std::mutex> theLock(mtx);
         std::thread::id thisThread = std::this_thread::get_id();
 
@@ -99,10 +120,7 @@ void FileLogger<DebugLevel>::logAllocation(GraphicsAllocation const *graphicsAll
         ss << graphicsAllocation->getAllocationInfoString();
         ss << std::endl;
 
-        auto str = ss.str();
-
-        std::unique_lock<std::mutex> theLock(mtx);
-        writeToFile(logFileName, str.c_str(), str.size(), std::ios::app);
+        appendToLog(ss.str());
     }
 }
 
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/utilities/binary_log.h"
 
 #include <cinttypes>
 #include <cstddef>
@@ -96,13 +97,12 @@ class FileLogger {
     void logInputs(Types &&... params) {
         if (enabled()) {
             if (logApiCalls) {
-                std::unique_lock<std::mutex> theLock(mtx);
                 std::thread::id thisThread = std::this_thread::get_id();
                 std::stringstream ss;
                 ss << "------------------------------\n";
                 printInputs(ss, "ThreadID", thisThread, params...);
                 ss << "------------------------------" << std::endl;
-                writeToFile(logFileName, ss.str().c_str(), ss.str().length(), std::ios::app);
+                appendToLog(ss.str());
             }
         }
     }
@@ -120,11 +120,10 @@ class FileLogger {
     void log(bool enableLog, Types... params) {
         if (enabled()) {
             if (enableLog) {
-                std::unique_lock<std::mutex> theLock(mtx);
                 std::thread::id thisThread = std::this_thread::get_id();
                 std::stringstream ss;
                 print(ss, "ThreadID", thisThread, params...);
-                writeToFile(logFileName, ss.str().c_str(), ss.str().length(), std::ios::app);
+                appendToLog(ss.str());
             }
         }
     }
@@ -139,9 +138,13 @@ class FileLogger {
 
     const char *getAllocationTypeString(GraphicsAllocation const *graphicsAllocation);
     bool peekLogApiCalls() { return logApiCalls; }
+    BinaryLogWriter *peekBinaryLogWriter() { return binaryLogWriter.get(); }
 
   protected:
+    void appendToLog(const std::string &str);
+
     std::mutex mtx;
+    std::unique_ptr<BinaryLogWriter> binaryLogWriter;
     std::string logFileName;
     bool dumpKernels = false;
     bool dumpKernelArgsEnabled = false;
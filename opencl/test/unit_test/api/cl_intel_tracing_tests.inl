@@ -5,10 +5,15 @@
  *
  */
 
+#include "shared/source/helpers/file_io.h"
+
 #include "opencl/source/tracing/tracing_api.h"
 #include "opencl/source/tracing/tracing_notify.h"
+#include "opencl/source/tracing/tracing_recorder.h"
 #include "opencl/test/unit_test/api/cl_api_tests.h"
 
+#include <thread>
+
 using namespace NEO;
 
 namespace ULT {
@@ -860,4 +865,106 @@ TEST_F(IntelClGetDeviceInfoTwoHandlesTracingCollectTest, GeneralTracingCollectio
     EXPECT_EQ(2u, exitCount);
 }
 
+struct IntelTracingRecorderTest : public api_tests {
+    void callGetDeviceInfo(size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            size_t paramValueSizeRet = 0;
+            clGetDeviceInfo(devices[testedRootDeviceIndex], CL_DEVICE_VENDOR, 0, nullptr, &paramValueSizeRet);
+        }
+    }
+
+    std::string fileName = "tracing_recorder_test.json";
+};
+
+struct MockTracingRecorder : public HostSideTracing::TracingRecorder {
+    using TracingRecorder::TracingRecorder;
+    using TracingRecorder::threadBuffers;
+};
+
+TEST_F(IntelTracingRecorderTest, GivenEnabledRecorderWhenApiIsCalledThenCallIsExportedAsCompleteEvent) {
+    HostSideTracing::TracingRecorder recorder(fileName, 16);
+    ASSERT_TRUE(recorder.enable());
+    EXPECT_TRUE(recorder.isEnabled());
+
+    callGetDeviceInfo(1);
+    recorder.disable();
+    callGetDeviceInfo(1);
+
+    EXPECT_FALSE(recorder.isEnabled());
+    EXPECT_EQ(1u, recorder.getRecordsCount());
+    EXPECT_EQ(0u, recorder.getDroppedRecordsCount());
+
+    auto trace = recorder.exportChromeTrace();
+    EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"clGetDeviceInfo\",\"cat\":\"api\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, trace.find("\"tid\":1,\"args\":{\"correlationId\":"));
+}
+
+TEST_F(IntelTracingRecorderTest, GivenFullThreadBufferWhenApiIsCalledThenOldestRecordsAreOverwritten) {
+    HostSideTracing::TracingRecorder recorder(fileName, 4);
+    ASSERT_TRUE(recorder.enable());
+    callGetDeviceInfo(10);
+    recorder.disable();
+
+    EXPECT_EQ(4u, recorder.getRecordsCount());
+    EXPECT_EQ(6u, recorder.getDroppedRecordsCount());
+
+    auto trace = recorder.exportChromeTrace();
+    size_t eventsCount = 0;
+    for (auto pos = trace.find("clGetDeviceInfo"); pos != std::string::npos; pos = trace.find("clGetDeviceInfo", pos + 1)) {
+        eventsCount++;
+    }
+    EXPECT_EQ(4u, eventsCount);
+}
+
+TEST_F(IntelTracingRecorderTest, GivenEnabledRecorderWhenApiIsCalledThenThreadBufferGrowsByChunks) {
+    MockTracingRecorder recorder(fileName, 4 * HostSideTracing::TracingRecorder::recordsPerChunk);
+    ASSERT_TRUE(recorder.enable());
+    callGetDeviceInfo(1);
+    ASSERT_EQ(1u, recorder.threadBuffers.size());
+    EXPECT_EQ(1u, recorder.threadBuffers[0]->chunks.size());
+
+    callGetDeviceInfo(HostSideTracing::TracingRecorder::recordsPerChunk);
+    recorder.disable();
+    EXPECT_EQ(2u, recorder.threadBuffers[0]->chunks.size());
+    EXPECT_EQ(HostSideTracing::TracingRecorder::recordsPerChunk + 1, recorder.getRecordsCount());
+}
+
+TEST_F(IntelTracingRecorderTest, GivenThreadWhichRecordedCallsWhenItExitsThenItsBufferIsReusedByNextThreadAndRecordsAreKept) {
+    MockTracingRecorder recorder(fileName, 16);
+    ASSERT_TRUE(recorder.enable());
+    std::thread([this]() { callGetDeviceInfo(1); }).join();
+    std::thread([this]() { callGetDeviceInfo(1); }).join();
+    recorder.disable();
+
+    EXPECT_EQ(1u, recorder.threadBuffers.size());
+    EXPECT_EQ(2u, recorder.getRecordsCount());
+    auto trace = recorder.exportChromeTrace();
+    EXPECT_NE(std::string::npos, trace.find("\"tid\":1,\"args\":{\"correlationId\":"));
+    EXPECT_NE(std::string::npos, trace.find("\"tid\":2,\"args\":{\"correlationId\":"));
+}
+
+TEST_F(IntelTracingRecorderTest, GivenEnabledRecorderWhenItIsDestroyedThenTraceIsExportedToFile) {
+    {
+        HostSideTracing::TracingRecorder recorder(fileName, 16);
+        ASSERT_TRUE(recorder.enable());
+        callGetDeviceInfo(2);
+    }
+
+    size_t traceSize = 0u;
+    auto trace = loadDataFromFile(fileName.c_str(), traceSize);
+    std::remove(fileName.c_str());
+    ASSERT_NE(nullptr, trace);
+    EXPECT_NE(std::string::npos, std::string(trace.get(), traceSize).find("clGetDeviceInfo"));
+}
+
+TEST_F(IntelTracingRecorderTest, GivenRecorderWhichWasNotEnabledWhenItIsDestroyedThenTraceIsNotExported) {
+    {
+        HostSideTracing::TracingRecorder recorder(fileName, 16);
+        callGetDeviceInfo(1);
+        EXPECT_EQ(0u, recorder.getRecordsCount());
+    }
+    EXPECT_FALSE(fileExists(fileName));
+}
+
 } // namespace ULT
@@ -0,0 +1,244 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/aub_mem_dump/aub_block_codec.h"
+#include "opencl/source/aub_mem_dump/aub_file_writer.h"
+#include "opencl/source/aub_mem_dump/aub_mem_dump.h"
+#include "test.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+using namespace AubMemDump;
+
+namespace {
+std::vector<char> createAubLikeData(size_t size) {
+    std::vector<char> data(size, 0);
+    for (size_t i = 0; i < size; i++) {
+        // literal runs, single zero dwords, long zero runs
+        if ((i / 64) % 3 == 0 && (i / 4) % 5 != 0) {
+            data[i] = static_cast<char>(i * 7 + 1);
+        }
+    }
+    return data;
+}
+
+std::vector<uint8_t> toBytes(const std::string &str) {
+    return std::vector<uint8_t>(str.begin(), str.end());
+}
+} // namespace
+
+TEST(ZeroRunCodecTest, givenDataWithZeroAndLiteralRunsWhenEncodedAndDecodedThenDataIsRestoredAndCompressed) {
+    ZeroRunCodec codec;
+    for (size_t size : {0u, 3u, 4u, 7u, 64u, 4097u}) {
+        auto data = createAubLikeData(size);
+        std::vector<uint8_t> encoded(codec.getMaxEncodedSize(size));
+        auto encodedSize = codec.encode(reinterpret_cast<const uint8_t *>(data.data()), size, encoded.data());
+        EXPECT_LE(encodedSize, encoded.size());
+
+        std::vector<char> decoded(size);
+        EXPECT_TRUE(codec.decode(encoded.data(), encodedSize, reinterpret_cast<uint8_t *>(decoded.data()), size));
+        EXPECT_EQ(data, decoded);
+    }
+
+    std::vector<uint8_t> zeroPage(4096, 0);
+    std::vector<uint8_t> encoded(codec.getMaxEncodedSize(zeroPage.size()));
+    EXPECT_EQ(sizeof(uint32_t), codec.encode(zeroPage.data(), zeroPage.size(), encoded.data()));
+}
+
+TEST(ZeroRunCodecTest, givenCorruptedDataWhenDecodingThenFailureIsReturned) {
+    ZeroRunCodec codec;
+    auto data = createAubLikeData(256);
+    std::vector<uint8_t> encoded(codec.getMaxEncodedSize(data.size()));
+    auto encodedSize = codec.encode(reinterpret_cast<const uint8_t *>(data.data()), data.size(), encoded.data());
+
+    std::vector<uint8_t> decoded(data.size());
+    EXPECT_FALSE(codec.decode(encoded.data(), encodedSize - 1, decoded.data(), decoded.size()));
+    EXPECT_FALSE(codec.decode(encoded.data(), encodedSize, decoded.data(), decoded.size() - 4));
+    EXPECT_FALSE(codec.decode(encoded.data(), encodedSize, decoded.data(), decoded.size() + 4));
+}
+
+TEST(BlockCodecTest, whenCreatingBlockCodecThenOnlyKnownCodecsAreReturned) {
+    auto codec = createBlockCodec(ZeroRunCodec::id);
+    ASSERT_NE(nullptr, codec);
+    EXPECT_EQ(ZeroRunCodec::id, codec->getId());
+    EXPECT_EQ(nullptr, createBlockCodec(0u));
+}
+
+TEST(AubFileWriterTest, givenWritesLargerThanChunkWhenWriterIsDestroyedThenAllDataIsWrittenInOrder) {
+    std::ostringstream output;
+    auto data = createAubLikeData(10000);
+    {
+        AubFileWriter writer(output, 1024, nullptr);
+        writer.write(data.data(), 10);
+        writer.write(data.data() + 10, 5000);
+        writer.flush();
+        writer.write(data.data() + 5010, data.size() - 5010);
+    }
+    auto written = output.str();
+    EXPECT_EQ(std::string(data.begin(), data.end()), written);
+}
+
+TEST(AubFileWriterTest, givenFlushedDataWhenDrainIsCalledThenDataIsWrittenToOutput) {
+    std::ostringstream output;
+    AubFileWriter writer(output, 4096, nullptr);
+    writer.write("aub", 3);
+    writer.flush();
+    writer.flush();
+    writer.drain();
+
+    EXPECT_EQ("aub", output.str());
+    EXPECT_EQ(1u, writer.getWrittenChunksCount());
+
+    writer.write("file", 4);
+    writer.drain();
+    EXPECT_EQ("aubfile", output.str());
+    EXPECT_EQ(2u, writer.getWrittenChunksCount());
+}
+
+TEST(AubFileWriterTest, givenCodecWhenDataIsWrittenThenOutputDecodesToOriginalData) {
+    std::ostringstream output;
+    auto data = createAubLikeData(20000);
+    {
+        AubFileWriter writer(output, 4096, std::make_unique<ZeroRunCodec>());
+        writer.write(data.data(), data.size());
+    }
+    auto compressed = toBytes(output.str());
+    EXPECT_LT(compressed.size(), data.size());
+
+    std::vector<uint8_t> decoded;
+    EXPECT_TRUE(decodeCompressedAub(ArrayRef<const uint8_t>(compressed.data(), compressed.size()), decoded));
+    EXPECT_EQ(std::vector<uint8_t>(data.begin(), data.end()), decoded);
+}
+
+TEST(AubFileWriterTest, givenCodecWhenChunkDoesNotCompressThenItIsStored) {
+    std::ostringstream output;
+    std::vector<char> data(100);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i + 1);
+    }
+    {
+        AubFileWriter writer(output, 4096, std::make_unique<ZeroRunCodec>());
+        writer.write(data.data(), data.size());
+    }
+    auto compressed = toBytes(output.str());
+    ASSERT_EQ(sizeof(BlockFileHeader) + sizeof(BlockHeader) + data.size(), compressed.size());
+
+    auto blockHeader = reinterpret_cast<const BlockHeader *>(compressed.data() + sizeof(BlockFileHeader));
+    EXPECT_EQ(BlockHeader::storedFlag, blockHeader->flags);
+
+    std::vector<uint8_t> decoded;
+    EXPECT_TRUE(decodeCompressedAub(ArrayRef<const uint8_t>(compressed.data(), compressed.size()), decoded));
+    EXPECT_EQ(std::vector<uint8_t>(data.begin(), data.end()), decoded);
+}
+
+TEST(AubFileWriterTest, givenInvalidCompressedFileWhenDecodingThenFailureIsReturned) {
+    std::vector<uint8_t> decoded;
+    std::vector<uint8_t> notCompressed(64, 1);
+    EXPECT_FALSE(decodeCompressedAub(ArrayRef<const uint8_t>(notCompressed.data(), notCompressed.size()), decoded));
+
+    std::ostringstream output;
+    {
+        AubFileWriter writer(output, 4096, std::make_unique<ZeroRunCodec>());
+        writer.write("truncated", 9);
+    }
+    auto compressed = toBytes(output.str());
+    EXPECT_FALSE(decodeCompressedAub(ArrayRef<const uint8_t>(compressed.data(), compressed.size() - 1), decoded));
+}
+
+TEST(AubFileStreamWriterTest, givenDefaultSettingsWhenFileIsOpenedThenItIsWrittenSynchronously) {
+    const char *fileName = "aub_file_writer_test_default.aub";
+    AubFileStream aubFile;
+    aubFile.open(fileName);
+    ASSERT_TRUE(aubFile.isOpen());
+    EXPECT_EQ(nullptr, aubFile.writer);
+
+    aubFile.write("aubdata", 7);
+    aubFile.flush();
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    EXPECT_EQ("aubdata", content);
+
+    aubFile.close();
+    std::remove(fileName);
+}
+
+TEST(AubFileStreamWriterTest, givenWriterChunkSizeWhenFileIsOpenedThenItIsWrittenByAubFileWriter) {
+    DebugManagerStateRestore restore;
+    NEO::DebugManager.flags.AUBDumpWriterChunkSize.set(4);
+
+    const char *fileName = "aub_file_writer_test.aub";
+    AubFileStream aubFile;
+    aubFile.open(fileName);
+    ASSERT_TRUE(aubFile.isOpen());
+    EXPECT_NE(nullptr, aubFile.writer);
+
+    aubFile.write("aubdata", 7);
+    aubFile.flush();
+    aubFile.close();
+    EXPECT_EQ(nullptr, aubFile.writer);
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    EXPECT_EQ("aubdata", content);
+    std::remove(fileName);
+}
+
+TEST(AubFileStreamWriterTest, givenZeroWriterChunkSizeWhenFileIsOpenedThenItIsWrittenSynchronously) {
+    DebugManagerStateRestore restore;
+    NEO::DebugManager.flags.AUBDumpWriterChunkSize.set(0);
+
+    const char *fileName = "aub_file_writer_test_sync.aub";
+    AubFileStream aubFile;
+    aubFile.open(fileName);
+    ASSERT_TRUE(aubFile.isOpen());
+    EXPECT_EQ(nullptr, aubFile.writer);
+    aubFile.close();
+    std::remove(fileName);
+}
+
+TEST(AubFileStreamWriterTest, givenCompressionEnabledWhenFileIsOpenedThenItIsWrittenByAubFileWriter) {
+    DebugManagerStateRestore restore;
+    NEO::DebugManager.flags.AUBDumpCompression.set(true);
+
+    const char *fileName = "aub_file_writer_test_compressed_writer.aub";
+    AubFileStream aubFile;
+    aubFile.open(fileName);
+    ASSERT_TRUE(aubFile.isOpen());
+    EXPECT_NE(nullptr, aubFile.writer);
+    aubFile.close();
+    std::remove(fileName);
+}
+
+TEST(AubFileStreamWriterTest, givenCompressionEnabledWhenFileIsWrittenThenItDecodesToOriginalStream) {
+    DebugManagerStateRestore restore;
+    NEO::DebugManager.flags.AUBDumpCompression.set(true);
+
+    const char *fileName = "aub_file_writer_test_compressed.aub";
+    auto data = createAubLikeData(8192);
+    AubFileStream aubFile;
+    aubFile.open(fileName);
+    ASSERT_TRUE(aubFile.isOpen());
+    aubFile.write(data.data(), data.size());
+    aubFile.close();
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<uint8_t> compressed((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(fileName);
+
+    std::vector<uint8_t> decoded;
+    EXPECT_TRUE(decodeCompressedAub(ArrayRef<const uint8_t>(compressed.data(), compressed.size()), decoded));
+    EXPECT_EQ(std::vector<uint8_t>(data.begin(), data.end()), decoded);
+}
@@ -9,6 +9,9 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace BuiltinKernelsSimulation {
 
 __kernel void CopyImage3dToBuffer16Bytes(__read_only image3d_t input,
@@ -118,4 +121,114 @@ TEST(BuiltInKernelTests, WhenBuiltInCopiesImageThenDataIsWrittenIntoCorrectMemor
     EXPECT_EQ(0, memcmp(ptrDst.get(), ptrZero.get(), 64)) << "Data written before passed ptr!\n";
     EXPECT_EQ(0, memcmp(ptrDst.get() + size + 64, ptrZero.get(), 64)) << "Data written after passed ptr!\n";
 }
+
+__kernel void CopyBufferToBufferMiddleWide(
+    const __global uint *pSrc,
+    __global uint *pDst,
+    uint srcOffsetInBytes,
+    uint dstOffsetInBytes) {
+    unsigned int gid = get_global_id(0);
+    pDst += dstOffsetInBytes >> 2;
+    pSrc += srcOffsetInBytes >> 2;
+    uint8 loaded = vload8(gid, pSrc);
+    vstore8(loaded, gid, pDst);
+}
+
+__kernel void CopyBufferToBufferMiddleMisaligned(
+    const __global uchar *pSrc,
+    __global uint *pDst,
+    uint srcOffsetInBytes,
+    uint dstOffsetInBytes) {
+    unsigned int gid = get_global_id(0);
+    pDst += dstOffsetInBytes >> 2;
+    pSrc += srcOffsetInBytes;
+    uchar16 loaded = vload16(gid, pSrc);
+    vstore4(as_uint4(loaded), gid, pDst);
+}
+
+__kernel void FillBufferMiddleWide(
+    __global uchar *pDst,
+    uint dstOffsetInBytes,
+    const __global uint *pPattern,
+    const uint patternSizeInEls) {
+    uint gid = get_global_id(0);
+    uint patternIndex = gid * 4;
+    uint4 data(pPattern[patternIndex & (patternSizeInEls - 1)],
+               pPattern[(patternIndex + 1) & (patternSizeInEls - 1)],
+               pPattern[(patternIndex + 2) & (patternSizeInEls - 1)],
+               pPattern[(patternIndex + 3) & (patternSizeInEls - 1)]);
+    vstore4(data, gid, (__global uint *)(pDst + dstOffsetInBytes));
+}
+
+TEST(BuiltInKernelTests, WhenWideMiddleCopyBuiltInIsRunThenDataIsCopiedIntoCorrectMemory) {
+    const uint size = 256;
+    const uint srcOffset = 64;
+    const uint dstOffset = 128;
+    std::vector<uint> src((srcOffset + size) / sizeof(uint));
+    std::vector<uint> dst((dstOffset + size + 64) / sizeof(uint), 0u);
+    auto srcBytes = reinterpret_cast<uchar *>(src.data());
+    auto dstBytes = reinterpret_cast<uchar *>(dst.data());
+    for (uint i = 0; i < srcOffset + size; i++) {
+        srcBytes[i] = static_cast<uchar>(i * 3 + 1);
+    }
+
+    memset(globalID, 0, sizeof(globalID));
+    for (globalID[0] = 0; globalID[0] < size / 32; globalID[0]++) {
+        CopyBufferToBufferMiddleWide(src.data(), dst.data(), srcOffset, dstOffset);
+    }
+
+    EXPECT_EQ(0, memcmp(srcBytes + srcOffset, dstBytes + dstOffset, size));
+    std::vector<uchar> zeros(64, 0u);
+    EXPECT_EQ(0, memcmp(dstBytes, zeros.data(), zeros.size())) << "Data written before passed offset!\n";
+    EXPECT_EQ(0, memcmp(dstBytes + dstOffset + size, zeros.data(), zeros.size())) << "Data written after passed size!\n";
+}
+
+TEST(BuiltInKernelTests, WhenMisalignedMiddleCopyBuiltInIsRunThenDataIsCopiedIntoCorrectMemory) {
+    const uint size = 128;
+    const uint dstOffset = 64;
+    std::vector<uchar> src(size + 16);
+    std::vector<uint> dst((dstOffset + size + 64) / sizeof(uint), 0u);
+    auto dstBytes = reinterpret_cast<uchar *>(dst.data());
+    for (uint i = 0; i < src.size(); i++) {
+        src[i] = static_cast<uchar>(i * 7 + 5);
+    }
+
+    for (uint srcOffset : {1u, 2u, 3u, 5u}) {
+        std::fill(dst.begin(), dst.end(), 0u);
+        memset(globalID, 0, sizeof(globalID));
+        for (globalID[0] = 0; globalID[0] < size / 16; globalID[0]++) {
+            CopyBufferToBufferMiddleMisaligned(src.data(), dst.data(), srcOffset, dstOffset);
+        }
+
+        EXPECT_EQ(0, memcmp(src.data() + srcOffset, dstBytes + dstOffset, size)) << "srcOffset: " << srcOffset;
+        std::vector<uchar> zeros(64, 0u);
+        EXPECT_EQ(0, memcmp(dstBytes + dstOffset + size, zeros.data(), zeros.size())) << "Data written after passed size!\n";
+    }
+}
+
+TEST(BuiltInKernelTests, WhenWideMiddleFillBuiltInIsRunThenPatternIsReplicatedIntoCorrectMemory) {
+    const uint size = 256;
+    const uint dstOffset = 64;
+    std::vector<uchar> dst(dstOffset + size + 64);
+
+    for (uint patternSize : {4u, 8u, 16u, 32u, 128u}) {
+        std::vector<uint> pattern(patternSize / sizeof(uint));
+        auto patternBytes = reinterpret_cast<uchar *>(pattern.data());
+        for (uint i = 0; i < patternSize; i++) {
+            patternBytes[i] = static_cast<uchar>(i + 1);
+        }
+        std::fill(dst.begin(), dst.end(), 0u);
+
+        memset(globalID, 0, sizeof(globalID));
+        for (globalID[0] = 0; globalID[0] < size / 16; globalID[0]++) {
+            FillBufferMiddleWide(dst.data(), dstOffset, pattern.data(), patternSize / sizeof(uint));
+        }
+
+        for (uint i = 0; i < size; i++) {
+            EXPECT_EQ(patternBytes[i % patternSize], dst[dstOffset + i]) << "patternSize: " << patternSize << " byte: " << i;
+        }
+        EXPECT_EQ(0u, dst[dstOffset - 1]);
+        EXPECT_EQ(0u, dst[dstOffset + size]);
+    }
+}
 } // namespace BuiltinKernelsSimulation
@@ -819,11 +819,70 @@ TEST_F(BuiltInTests, BuiltinDispatchInfoBuilderCopyBufferToBufferWithSourceOffse
 
     const DispatchInfo *dispatchInfo = multiDispatchInfo.begin();
 
-    EXPECT_EQ(dispatchInfo->getKernel()->getKernelInfo().name, "CopyBufferToBufferLeftLeftover");
+    EXPECT_EQ(dispatchInfo->getKernel()->getKernelInfo().name, "CopyBufferToBufferMiddleMisaligned");
+    EXPECT_EQ(Vec3<size_t>(src.getSize() / (sizeof(uint32_t) * 4), 1, 1), dispatchInfo->getGWS());
 
     EXPECT_TRUE(compareBuiltinOpParams(multiDispatchInfo.peekBuiltinOpParams(), builtinOpsParams));
 }
 
+TEST_F(BuiltInTests, givenMiddleRegionNotSmallerThanWideMiddleMinSizeWhenBuildingCopyBufferToBufferThenWideMiddleKernelIsUsed) {
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pDevice);
+
+    MockBuffer src;
+    src.size = 2 * wideMiddleMinSize;
+    MockBuffer dst;
+    dst.size = 2 * wideMiddleMinSize;
+
+    BuiltinOpParams builtinOpsParams;
+    builtinOpsParams.srcMemObj = &src;
+    builtinOpsParams.dstMemObj = &dst;
+
+    for (auto size : {wideMiddleMinSize, wideMiddleMinSize - MemoryConstants::cacheLineSize}) {
+        MultiDispatchInfo multiDispatchInfo;
+        builtinOpsParams.size = {size, 0, 0};
+        ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo, builtinOpsParams));
+        ASSERT_EQ(1u, multiDispatchInfo.size());
+
+        auto dispatchInfo = multiDispatchInfo.begin();
+        if (size >= wideMiddleMinSize) {
+            EXPECT_EQ("CopyBufferToBufferMiddleWide", dispatchInfo->getKernel()->getKernelInfo().name);
+            EXPECT_EQ(Vec3<size_t>(size / (sizeof(uint32_t) * 8), 1, 1), dispatchInfo->getGWS());
+        } else {
+            EXPECT_EQ("CopyBufferToBufferMiddle", dispatchInfo->getKernel()->getKernelInfo().name);
+            EXPECT_EQ(Vec3<size_t>(size / (sizeof(uint32_t) * 4), 1, 1), dispatchInfo->getGWS());
+        }
+    }
+}
+
+TEST_F(BuiltInTests, givenMiddleRegionNotSmallerThanWideMiddleMinSizeWhenBuildingFillBufferThenWideMiddleKernelIsUsed) {
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer, *pDevice);
+
+    MockBuffer pattern;
+    pattern.size = 8;
+    MockBuffer dst;
+    dst.size = 2 * wideMiddleMinSize;
+
+    BuiltinOpParams builtinOpsParams;
+    builtinOpsParams.srcMemObj = &pattern;
+    builtinOpsParams.dstMemObj = &dst;
+
+    for (auto size : {wideMiddleMinSize, wideMiddleMinSize - MemoryConstants::cacheLineSize}) {
+        MultiDispatchInfo multiDispatchInfo;
+        builtinOpsParams.size = {size, 0, 0};
+        ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo, builtinOpsParams));
+        ASSERT_EQ(1u, multiDispatchInfo.size());
+
+        auto dispatchInfo = multiDispatchInfo.begin();
+        if (size >= wideMiddleMinSize) {
+            EXPECT_EQ("FillBufferMiddleWide", dispatchInfo->getKernel()->getKernelInfo().name);
+            EXPECT_EQ(Vec3<size_t>(size / (sizeof(uint32_t) * 4), 1, 1), dispatchInfo->getGWS());
+        } else {
+            EXPECT_EQ("FillBufferMiddle", dispatchInfo->getKernel()->getKernelInfo().name);
+            EXPECT_EQ(Vec3<size_t>(size / sizeof(uint32_t), 1, 1), dispatchInfo->getGWS());
+        }
+    }
+}
+
 TEST_F(BuiltInTests, BuiltinDispatchInfoBuilderReadBufferAligned) {
     BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pDevice);
 
@@ -957,6 +1016,21 @@ TEST_F(BuiltInTests, GeivenDefaultBuiltinDispatchInfoBuilderWhendValidateDispatc
     EXPECT_EQ(CL_SUCCESS, ret);
 }
 
+TEST_F(BuiltInTests, givenCopyBufferToBufferBuilderWhenItIsCreatedThenOnlyKernelsUsedByBuilderAreLoaded) {
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pDevice);
+    auto &usedKernels = builder.peekUsedKernels();
+    ASSERT_EQ(5u, usedKernels.size());
+
+    auto program = usedKernels[0]->getProgram();
+    EXPECT_EQ(5u, program->getNumKernels());
+    EXPECT_NE(nullptr, program->getKernelInfo("CopyBufferToBufferLeftLeftover"));
+    EXPECT_NE(nullptr, program->getKernelInfo("CopyBufferToBufferMiddle"));
+    EXPECT_NE(nullptr, program->getKernelInfo("CopyBufferToBufferMiddleWide"));
+    EXPECT_NE(nullptr, program->getKernelInfo("CopyBufferToBufferMiddleMisaligned"));
+    EXPECT_NE(nullptr, program->getKernelInfo("CopyBufferToBufferRightLeftover"));
+    EXPECT_EQ(nullptr, program->getKernelInfo("CopyBufferToBufferBytes"));
+}
+
 TEST_F(BuiltInTests, BuiltinDispatchInfoBuilderReturnTrueIfExplicitKernelArgNotTakenCareOfInBuiltinDispatchBInfoBuilder) {
     auto &bs = *pDevice->getExecutionEnvironment()->getBuiltIns();
     BuiltinDispatchInfoBuilder bdib{bs};
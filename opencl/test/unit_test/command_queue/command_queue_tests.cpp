@@ -219,6 +219,21 @@ TEST(CommandQueue, givenDeviceNotSupportingBlitOperationsWhenQueueIsCreatedThenD
     EXPECT_EQ(nullptr, cmdQ.getBcsCommandStreamReceiver());
 }
 
+TEST(CommandQueue, givenImagesWhenCheckingIfBlitEnqueueIsAllowedThenAllowOnlyLinearImagesWithoutMipMaps) {
+    MockContext context;
+
+    std::unique_ptr<Image> image1d(Image1dHelper<>::create(&context));
+    EXPECT_TRUE(MockCommandQueue::blitEnqueueImageAllowed(*image1d));
+
+    std::unique_ptr<Image> image1dArray(Image1dArrayHelper<>::create(&context));
+    EXPECT_FALSE(MockCommandQueue::blitEnqueueImageAllowed(*image1dArray));
+
+    cl_image_desc mipMappedImageDesc = Image1dDefaults::imageDesc;
+    mipMappedImageDesc.num_mip_levels = 2;
+    std::unique_ptr<Image> mipMappedImage(Image1dHelper<>::create(&context, &mipMappedImageDesc));
+    EXPECT_FALSE(MockCommandQueue::blitEnqueueImageAllowed(*mipMappedImage));
+}
+
 using CommandQueueWithSubDevicesTest = ::testing::Test;
 HWTEST_F(CommandQueueWithSubDevicesTest, givenDeviceWithSubDevicesSupportingBlitOperationsWhenQueueIsCreatedThenBcsIsTakenFromFirstSubDevice) {
     DebugManagerStateRestore restorer;
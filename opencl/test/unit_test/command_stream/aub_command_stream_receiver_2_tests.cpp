@@ -8,6 +8,7 @@
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
+#include "opencl/source/aub/aub_helper.h"
 #include "opencl/source/aub_mem_dump/aub_alloc_dump.h"
 #include "opencl/source/aub_mem_dump/page_table_entry_bits.h"
 #include "opencl/source/helpers/hardware_context_controller.h"
@@ -20,6 +21,7 @@
 #include "opencl/test/unit_test/mocks/mock_aub_csr.h"
 #include "opencl/test/unit_test/mocks/mock_aub_file_stream.h"
 #include "opencl/test/unit_test/mocks/mock_aub_manager.h"
+#include "opencl/test/unit_test/mocks/mock_aub_stream.h"
 #include "opencl/test/unit_test/mocks/mock_aub_subcapture_manager.h"
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_csr.h"
@@ -545,6 +547,40 @@ HWTEST_F(AubCommandStreamReceiverTests, givenPhysicalAddressWhenSetGttEntryIsCal
     EXPECT_FALSE(entry.pageConfig.LocalMemory);
 }
 
+HWTEST_F(AubCommandStreamReceiverTests, givenPhysicallyContiguousRangeLargerThanOneMemoryWriteWhenReservingAndWritingMemoryThenPageTableEntriesAreSplitIntoValidHeaders) {
+    typedef typename AUBFamilyMapper<FamilyType>::AUB AUB;
+
+    struct MemoryWriteHeadersStream : MockAubStreamMockMmioWrite {
+        void writeMemoryWriteHeader(uint64_t physAddress, size_t size, uint32_t addressSpace, uint32_t hint) override {
+            headers.push_back({physAddress, size});
+        }
+        std::vector<std::pair<uint64_t, size_t>> headers;
+    };
+    MemoryWriteHeadersStream stream;
+    AubHelperHw<FamilyType> aubHelperHw(false);
+
+    size_t size = 256 * MemoryConstants::megaByte + 3 * MemoryConstants::pageSize;
+    uintptr_t gpuAddress = 0x100000000ull;
+    uint64_t physAddress = 0x40000000ull;
+    AUB::reserveAddressGGTTAndWriteMmeory(stream, gpuAddress, reinterpret_cast<void *>(0x1000), physAddress, size, 0, 3, aubHelperHw);
+
+    auto sizeMemoryWriteHeader = sizeof(AubMemDump::CmdServicesMemTraceMemoryWrite) - sizeof(AubMemDump::CmdServicesMemTraceMemoryWrite::data);
+    size_t ptEntriesWritten = 0;
+    size_t ptHeaders = 0;
+    auto firstPtEntryAddress = AUB::getPTEAddress(gpuAddress / MemoryConstants::pageSize);
+    auto endPtEntryAddress = AUB::getPTEAddress((gpuAddress + size) / MemoryConstants::pageSize);
+    for (auto &header : stream.headers) {
+        auto dwordCount = (sizeMemoryWriteHeader + alignUp(header.second, sizeof(uint32_t))) / sizeof(uint32_t);
+        EXPECT_LE(dwordCount, AubMemDump::g_dwordCountMax);
+        if (header.first >= firstPtEntryAddress && header.first < endPtEntryAddress) {
+            ptEntriesWritten += header.second / sizeof(uint64_t);
+            ptHeaders++;
+        }
+    }
+    EXPECT_LT(1u, ptHeaders);
+    EXPECT_EQ(size / MemoryConstants::pageSize, ptEntriesWritten);
+}
+
 HWTEST_F(AubCommandStreamReceiverTests, whenGetMemoryBankForGttIsCalledThenCorrectBankIsReturned) {
     std::unique_ptr<MockAubCsr<FamilyType>> aubCsr(new MockAubCsr<FamilyType>("", true, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex()));
     aubCsr->localMemoryEnabled = false;
@@ -219,6 +219,46 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWhenWriteMemoryIsCalle
     EXPECT_TRUE(mockAubFileStream->lockStreamCalled);
 }
 
+HWTEST_F(AubFileStreamTests, givenSkipUnchangedAllocationsWhenWriteMemoryIsCalledWithUnchangedContentThenAllocationIsNotDumpedAgain) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpSkipUnchangedAllocations.set(true);
+    auto mockAubFileStream = std::make_unique<MockAubFileStream>();
+    auto aubExecutionEnvironment = getEnvironment<AUBCommandStreamReceiverHw<FamilyType>>(true, true, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<AUBCommandStreamReceiverHw<FamilyType>>();
+
+    aubCsr->stream = static_cast<MockAubFileStream *>(mockAubFileStream.get());
+
+    uint32_t memory[64] = {1, 2, 3};
+    MockGraphicsAllocation allocation(memory, sizeof(memory));
+
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_TRUE(mockAubFileStream->lockStreamCalled);
+
+    mockAubFileStream->lockStreamCalled = false;
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_FALSE(mockAubFileStream->lockStreamCalled);
+
+    memory[10] = 10;
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_TRUE(mockAubFileStream->lockStreamCalled);
+}
+
+HWTEST_F(AubFileStreamTests, givenSkipUnchangedAllocationsDisabledWhenWriteMemoryIsCalledWithUnchangedContentThenAllocationIsDumpedAgain) {
+    auto mockAubFileStream = std::make_unique<MockAubFileStream>();
+    auto aubExecutionEnvironment = getEnvironment<AUBCommandStreamReceiverHw<FamilyType>>(true, true, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<AUBCommandStreamReceiverHw<FamilyType>>();
+
+    aubCsr->stream = static_cast<MockAubFileStream *>(mockAubFileStream.get());
+
+    uint32_t memory[64] = {1, 2, 3};
+    MockGraphicsAllocation allocation(memory, sizeof(memory));
+
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    mockAubFileStream->lockStreamCalled = false;
+    EXPECT_TRUE(aubCsr->writeMemory(allocation));
+    EXPECT_TRUE(mockAubFileStream->lockStreamCalled);
+}
+
 HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWhenPollForCompletionIsCalledThenFileStreamShouldBeLocked) {
     auto mockAubFileStream = std::make_unique<MockAubFileStream>();
     auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(true, true, true);
@@ -32,6 +32,7 @@
 #include "opencl/source/mem_obj/mem_obj_helper.h"
 #include "opencl/test/unit_test/fixtures/built_in_fixture.h"
 #include "opencl/test/unit_test/fixtures/device_fixture.h"
+#include "opencl/test/unit_test/fixtures/image_fixture.h"
 #include "opencl/test/unit_test/fixtures/ult_command_stream_receiver_fixture.h"
 #include "opencl/test/unit_test/helpers/dispatch_flags_helper.h"
 #include "opencl/test/unit_test/helpers/hw_parse.h"
@@ -892,6 +893,128 @@ HWTEST_F(BcsTests, givenBufferWhenBlitOperationCalledThenProgramCorrectGpuAddres
     }
 }
 
+HWTEST_F(BcsTests, givenCopyRegionWhenEstimatingCommandsSizeThenCountPitchedBlitsPerSliceOrLinearBlitsPerRow) {
+    BlitProperties blitProperties;
+
+    BlitProperties::setupCopyRegion(blitProperties, {64, static_cast<size_t>(BlitterConstants::maxBlitHeight + 1), 2}, 128, 0x100000, 256, 0x200000);
+    EXPECT_TRUE(BlitCommandsHelper<FamilyType>::isPitchedCopySupported(blitProperties));
+    EXPECT_EQ(4u, BlitCommandsHelper<FamilyType>::getNumberOfBlitsForCopy(blitProperties));
+    EXPECT_EQ(4 * sizeof(typename FamilyType::XY_COPY_BLT), BlitCommandsHelper<FamilyType>::estimateBlitCommandsSize(blitProperties));
+
+    const size_t wideRow = static_cast<size_t>(BlitterConstants::maxBlitWidth + 1);
+    BlitProperties::setupCopyRegion(blitProperties, {wideRow, 3, 2}, 2 * wideRow, 6 * wideRow, 2 * wideRow, 6 * wideRow);
+    EXPECT_FALSE(BlitCommandsHelper<FamilyType>::isPitchedCopySupported(blitProperties));
+    EXPECT_EQ(12u, BlitCommandsHelper<FamilyType>::getNumberOfBlitsForCopy(blitProperties));
+    EXPECT_EQ(12 * sizeof(typename FamilyType::XY_COPY_BLT), BlitCommandsHelper<FamilyType>::estimateBlitCommandsSize(blitProperties));
+}
+
+HWTEST_F(BcsTests, givenCopyBufferRectWhenDispatchedThenProgramPitchedBlitForEachSlice) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    cl_int retVal = CL_SUCCESS;
+    auto srcBuffer = clUniquePtr<Buffer>(Buffer::create(context.get(), CL_MEM_READ_WRITE, 1024, nullptr, retVal));
+    auto dstBuffer = clUniquePtr<Buffer>(Buffer::create(context.get(), CL_MEM_READ_WRITE, 1024, nullptr, retVal));
+
+    BuiltinOpParams builtinOpParams = {};
+    builtinOpParams.srcMemObj = srcBuffer.get();
+    builtinOpParams.dstMemObj = dstBuffer.get();
+    builtinOpParams.srcOffset = {1, 2, 1};
+    builtinOpParams.dstOffset = {3, 0, 0};
+    builtinOpParams.size = {16, 4, 2};
+    builtinOpParams.srcRowPitch = 32;
+    builtinOpParams.srcSlicePitch = 256;
+    builtinOpParams.dstRowPitch = 64;
+    builtinOpParams.dstSlicePitch = 256;
+
+    auto blitProperties = ClBlitProperties::constructPropertiesForCopyRegion(BlitterConstants::BlitDirection::BufferToBuffer, csr, builtinOpParams);
+    EXPECT_TRUE(blitProperties.isRegionCopy());
+    EXPECT_EQ(128u, blitProperties.copySize);
+    EXPECT_EQ(256u + 2 * 32 + 1, blitProperties.srcOffset);
+    EXPECT_EQ(3u, blitProperties.dstOffset);
+
+    blitBuffer(&csr, blitProperties, true);
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(csr.commandStream);
+    auto bltCmds = findAll<typename FamilyType::XY_COPY_BLT *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_EQ(2u, bltCmds.size());
+
+    for (uint32_t slice = 0; slice < 2; slice++) {
+        auto bltCmd = genCmdCast<typename FamilyType::XY_COPY_BLT *>(*bltCmds[slice]);
+        EXPECT_EQ(16u, bltCmd->getTransferWidth());
+        EXPECT_EQ(4u, bltCmd->getTransferHeight());
+        EXPECT_EQ(64u, bltCmd->getDestinationPitch());
+        EXPECT_EQ(32u, bltCmd->getSourcePitch());
+        EXPECT_EQ(dstBuffer->getGraphicsAllocation()->getGpuAddress() + 3 + slice * 256, bltCmd->getDestinationBaseAddress());
+        EXPECT_EQ(srcBuffer->getGraphicsAllocation()->getGpuAddress() + 256 + 2 * 32 + 1 + slice * 256, bltCmd->getSourceBaseAddress());
+    }
+}
+
+HWTEST_F(BcsTests, givenCopyRegionWithRowPitchNotSupportedByBlitterWhenDispatchedThenProgramBlitForEachRow) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    const size_t rowPitch = static_cast<size_t>(BlitterConstants::maxBlitPitch + 1);
+    cl_int retVal = CL_SUCCESS;
+    auto srcBuffer = clUniquePtr<Buffer>(Buffer::create(context.get(), CL_MEM_READ_WRITE, 2 * rowPitch, nullptr, retVal));
+    auto dstBuffer = clUniquePtr<Buffer>(Buffer::create(context.get(), CL_MEM_READ_WRITE, 2 * rowPitch, nullptr, retVal));
+
+    BuiltinOpParams builtinOpParams = {};
+    builtinOpParams.srcMemObj = srcBuffer.get();
+    builtinOpParams.dstMemObj = dstBuffer.get();
+    builtinOpParams.size = {16, 2, 1};
+    builtinOpParams.srcRowPitch = rowPitch;
+    builtinOpParams.srcSlicePitch = 2 * rowPitch;
+    builtinOpParams.dstRowPitch = 16;
+    builtinOpParams.dstSlicePitch = 32;
+
+    auto blitProperties = ClBlitProperties::constructPropertiesForCopyRegion(BlitterConstants::BlitDirection::BufferToBuffer, csr, builtinOpParams);
+    blitBuffer(&csr, blitProperties, true);
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(csr.commandStream);
+    auto bltCmds = findAll<typename FamilyType::XY_COPY_BLT *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_EQ(2u, bltCmds.size());
+
+    for (uint32_t row = 0; row < 2; row++) {
+        auto bltCmd = genCmdCast<typename FamilyType::XY_COPY_BLT *>(*bltCmds[row]);
+        EXPECT_EQ(16u, bltCmd->getTransferWidth());
+        EXPECT_EQ(1u, bltCmd->getTransferHeight());
+        EXPECT_EQ(dstBuffer->getGraphicsAllocation()->getGpuAddress() + row * 16, bltCmd->getDestinationBaseAddress());
+        EXPECT_EQ(srcBuffer->getGraphicsAllocation()->getGpuAddress() + row * rowPitch, bltCmd->getSourceBaseAddress());
+    }
+}
+
+HWTEST_F(BcsTests, givenReadImageParamsWhenConstructingCopyRegionPropertiesThenConvertPixelsToBytesAndUseImagePitches) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto memoryManager = csr.getMemoryManager();
+
+    std::unique_ptr<Image> image(Image1dHelper<>::create(context.get()));
+    auto bytesPerPixel = image->getSurfaceFormatInfo().surfaceFormat.ImageElementSizeInBytes;
+
+    AllocationProperties properties{csr.getRootDeviceIndex(), false, 1234, GraphicsAllocation::AllocationType::MAP_ALLOCATION, false};
+    GraphicsAllocation *hostAllocation = memoryManager->allocateGraphicsMemoryWithProperties(properties, reinterpret_cast<void *>(0x12340000));
+
+    BuiltinOpParams builtinOpParams = {};
+    builtinOpParams.srcMemObj = image.get();
+    builtinOpParams.dstPtr = reinterpret_cast<void *>(hostAllocation->getGpuAddress());
+    builtinOpParams.transferAllocation = hostAllocation;
+    builtinOpParams.srcOffset = {2, 0, 0};
+    builtinOpParams.size = {3, 1, 1};
+
+    auto blitProperties = ClBlitProperties::constructPropertiesForCopyRegion(BlitterConstants::BlitDirection::BufferToHostPtr, csr, builtinOpParams);
+
+    EXPECT_EQ(hostAllocation, blitProperties.dstAllocation);
+    EXPECT_EQ(image->getGraphicsAllocation(), blitProperties.srcAllocation);
+    EXPECT_EQ(3u * bytesPerPixel, blitProperties.copyRegion.x);
+    EXPECT_EQ(3u * bytesPerPixel, blitProperties.copySize);
+    EXPECT_EQ(2u * bytesPerPixel, blitProperties.srcOffset);
+    EXPECT_EQ(0u, blitProperties.dstOffset);
+    EXPECT_EQ(image->getImageDesc().image_row_pitch, blitProperties.srcRowPitch);
+    EXPECT_EQ(3u * bytesPerPixel, blitProperties.dstRowPitch);
+
+    memoryManager->freeGraphicsMemory(hostAllocation);
+}
+
 HWTEST_F(BcsTests, givenMapAllocationWhenDispatchReadWriteOperationThenSetValidGpuAddress) {
     auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
     auto memoryManager = csr.getMemoryManager();
@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_context.h"
@@ -85,6 +86,17 @@ struct MockTbxCsrToTestDumpTbxNonWritable : public TbxCommandStreamReceiverHw<Gf
     }
 };
 
+template <typename GfxFamily>
+struct MockTbxCsrRecordingMemoryWrites : public TbxCommandStreamReceiverHw<GfxFamily> {
+    using TbxCommandStreamReceiverHw<GfxFamily>::TbxCommandStreamReceiverHw;
+    using TbxCommandStreamReceiverHw<GfxFamily>::writeMemory;
+
+    void writeMemory(uint64_t gpuAddress, void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits) override {
+        writtenRanges.push_back({gpuAddress, size});
+    }
+    std::vector<std::pair<uint64_t, size_t>> writtenRanges;
+};
+
 TEST_F(TbxCommandStreamTests, DISABLED_makeResident) {
     uint8_t buffer[0x10000];
     size_t size = sizeof(buffer);
@@ -259,6 +271,64 @@ HWTEST_F(TbxCommandStreamTests, givenTbxCommandStreamReceiverWhenWriteMemoryIsCa
     memoryManager->freeGraphicsMemory(graphicsAllocation);
 }
 
+HWTEST_F(TbxCommandStreamTests, givenAllocationPartiallyWrittenByCpuAfterUploadWhenWriteMemoryIsCalledThenOnlyDirtyPagesAreUploaded) {
+    MockTbxCsrRecordingMemoryWrites<FamilyType> tbxCsr(*pDevice->executionEnvironment, 0);
+    MockOsContext osContext(0, 1, aub_stream::ENGINE_RCS, PreemptionMode::Disabled, false, false, false);
+    tbxCsr.setupContext(osContext);
+    tbxCsr.aubManager = nullptr;
+
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{4 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    ASSERT_NE(nullptr, graphicsAllocation);
+    auto gpuAddress = GmmHelper::decanonize(graphicsAllocation->getGpuAddress());
+
+    EXPECT_TRUE(tbxCsr.writeMemory(*graphicsAllocation));
+    ASSERT_EQ(1u, tbxCsr.writtenRanges.size());
+    EXPECT_EQ(4 * MemoryConstants::pageSize, tbxCsr.writtenRanges[0].second);
+    EXPECT_FALSE(tbxCsr.isTbxWritable(*graphicsAllocation));
+
+    graphicsAllocation->setTbxWritableRange(MemoryConstants::pageSize + 16, 8, GraphicsAllocation::defaultBank);
+    graphicsAllocation->setTbxWritableRange(3 * MemoryConstants::pageSize, MemoryConstants::pageSize, GraphicsAllocation::defaultBank);
+    EXPECT_TRUE(tbxCsr.isTbxWritable(*graphicsAllocation));
+
+    tbxCsr.writtenRanges.clear();
+    EXPECT_TRUE(tbxCsr.writeMemory(*graphicsAllocation));
+    ASSERT_EQ(2u, tbxCsr.writtenRanges.size());
+    EXPECT_EQ(gpuAddress + MemoryConstants::pageSize, tbxCsr.writtenRanges[0].first);
+    EXPECT_EQ(MemoryConstants::pageSize, tbxCsr.writtenRanges[0].second);
+    EXPECT_EQ(gpuAddress + 3 * MemoryConstants::pageSize, tbxCsr.writtenRanges[1].first);
+    EXPECT_EQ(MemoryConstants::pageSize, tbxCsr.writtenRanges[1].second);
+    EXPECT_FALSE(tbxCsr.isTbxWritable(*graphicsAllocation));
+    EXPECT_TRUE(graphicsAllocation->getTbxDirtyPages().isTracking());
+    EXPECT_EQ(0u, graphicsAllocation->getTbxDirtyPages().getDirtyPagesCount());
+
+    EXPECT_EQ(6 * MemoryConstants::pageSize, tbxCsr.getUploadedBytes());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, tbxCsr.getSkippedBytes());
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenAllocationMadeWritableWithoutRangeWhenWriteMemoryIsCalledThenWholeAllocationIsUploaded) {
+    MockTbxCsrRecordingMemoryWrites<FamilyType> tbxCsr(*pDevice->executionEnvironment, 0);
+    MockOsContext osContext(0, 1, aub_stream::ENGINE_RCS, PreemptionMode::Disabled, false, false, false);
+    tbxCsr.setupContext(osContext);
+    tbxCsr.aubManager = nullptr;
+
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{4 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    ASSERT_NE(nullptr, graphicsAllocation);
+
+    EXPECT_TRUE(tbxCsr.writeMemory(*graphicsAllocation));
+    graphicsAllocation->setTbxWritableRange(0, 8, GraphicsAllocation::defaultBank);
+    graphicsAllocation->setTbxWritable(true, GraphicsAllocation::defaultBank);
+
+    tbxCsr.writtenRanges.clear();
+    EXPECT_TRUE(tbxCsr.writeMemory(*graphicsAllocation));
+    ASSERT_EQ(1u, tbxCsr.writtenRanges.size());
+    EXPECT_EQ(4 * MemoryConstants::pageSize, tbxCsr.writtenRanges[0].second);
+    EXPECT_EQ(0u, tbxCsr.getSkippedBytes());
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+}
+
 HWTEST_F(TbxCommandStreamTests, givenTbxCommandStreamReceiverWhenWriteMemoryIsCalledForGraphicsAllocationWithZeroSizeThenItShouldReturnFalse) {
     TbxCommandStreamReceiverHw<FamilyType> *tbxCsr = (TbxCommandStreamReceiverHw<FamilyType> *)pCommandStreamReceiver;
     MockGraphicsAllocation graphicsAllocation((void *)0x1234, 0);
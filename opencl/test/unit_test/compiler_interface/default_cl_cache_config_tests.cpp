@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/source/memory_manager/memory_constants.h"
+
 #include "opencl/source/compiler_interface/default_cl_cache_config.h"
 #include "test.h"
 
@@ -13,4 +15,6 @@ TEST(CompilerCache, GivenDefaultClCacheConfigThenValuesAreProperlyPopulated) {
     EXPECT_STREQ("cl_cache", cacheConfig.cacheDir.c_str());
     EXPECT_STREQ(".cl_cache", cacheConfig.cacheFileExtension.c_str());
     EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_EQ(static_cast<size_t>(NEO::defaultClCacheMaxSizeInMb) * MemoryConstants::megaByte, cacheConfig.cacheSize);
+    EXPECT_FALSE(cacheConfig.mapCachedBinaries);
 }
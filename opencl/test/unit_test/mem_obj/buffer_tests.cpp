@@ -801,6 +801,39 @@ HWTEST_TEMPLATED_F(BcsBufferTests, givenBcsSupportedWhenEnqueueBufferOperationIs
     EXPECT_EQ(6u, bcsCsr->blitBufferCalled);
 }
 
+HWTEST_TEMPLATED_F(BcsBufferTests, givenBcsSupportedWhenEnqueueBufferRectOperationIsCalledThenUseBcsCsrWithPitchedBlit) {
+    using XY_COPY_BLT = typename FamilyType::XY_COPY_BLT;
+    auto bcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(commandQueue->getBcsCommandStreamReceiver());
+
+    auto bufferForBlt0 = clUniquePtr(Buffer::create(bcsMockContext.get(), CL_MEM_READ_WRITE, 64, nullptr, retVal));
+    auto bufferForBlt1 = clUniquePtr(Buffer::create(bcsMockContext.get(), CL_MEM_READ_WRITE, 64, nullptr, retVal));
+    bufferForBlt0->forceDisallowCPUCopy = true;
+    bufferForBlt1->forceDisallowCPUCopy = true;
+
+    uint32_t hostRect[4] = {};
+    size_t origin[] = {0, 0, 0};
+    size_t region[] = {4, 2, 1};
+
+    commandQueue->enqueueWriteBufferRect(bufferForBlt0.get(), CL_TRUE, origin, origin, region, 16, 32, 8, 16, hostRect, 0, nullptr, nullptr);
+    EXPECT_EQ(1u, bcsCsr->blitBufferCalled);
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(bcsCsr->getCS(0));
+    auto commandItor = find<XY_COPY_BLT *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_NE(hwParser.cmdList.end(), commandItor);
+    auto copyBltCmd = genCmdCast<XY_COPY_BLT *>(*commandItor);
+    EXPECT_EQ(4u, copyBltCmd->getTransferWidth());
+    EXPECT_EQ(2u, copyBltCmd->getTransferHeight());
+    EXPECT_EQ(16u, copyBltCmd->getDestinationPitch());
+    EXPECT_EQ(8u, copyBltCmd->getSourcePitch());
+    EXPECT_EQ(bufferForBlt0->getGraphicsAllocation()->getGpuAddress(), copyBltCmd->getDestinationBaseAddress());
+
+    commandQueue->enqueueReadBufferRect(bufferForBlt0.get(), CL_TRUE, origin, origin, region, 16, 32, 8, 16, hostRect, 0, nullptr, nullptr);
+    EXPECT_EQ(2u, bcsCsr->blitBufferCalled);
+    commandQueue->enqueueCopyBufferRect(bufferForBlt0.get(), bufferForBlt1.get(), origin, origin, region, 16, 32, 8, 16, 0, nullptr, nullptr);
+    EXPECT_EQ(3u, bcsCsr->blitBufferCalled);
+}
+
 HWTEST_TEMPLATED_F(BcsBufferTests, givenBcsSupportedWhenQueueIsBlockedThenDispatchBlitWhenUnblocked) {
     auto bcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(commandQueue->getBcsCommandStreamReceiver());
 
@@ -849,6 +882,96 @@ HWTEST_TEMPLATED_F(BcsBufferTests, givenBuffersWhenCopyBufferCalledThenUseBcs) {
     EXPECT_EQ(bufferForBlt1->getGraphicsAllocation()->getGpuAddress(), copyBltCmd->getDestinationBaseAddress());
 }
 
+HWTEST_TEMPLATED_F(BcsBufferTests, givenSplitBcsCopyEnabledWhenCopyBufferCalledThenSplitRangeBetweenKernelsAndBcs) {
+    using XY_COPY_BLT = typename FamilyType::XY_COPY_BLT;
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsCopyMinSize.set(4 * MemoryConstants::pageSize);
+
+    auto cmdQ = clUniquePtr(new MockCommandQueueHw<FamilyType>(bcsMockContext.get(), device.get(), nullptr));
+    auto bcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(cmdQ->getBcsCommandStreamReceiver());
+    size_t copySize = 4 * MemoryConstants::pageSize;
+
+    auto bufferForBlt0 = clUniquePtr(Buffer::create(bcsMockContext.get(), CL_MEM_READ_WRITE, copySize, nullptr, retVal));
+    auto bufferForBlt1 = clUniquePtr(Buffer::create(bcsMockContext.get(), CL_MEM_READ_WRITE, copySize, nullptr, retVal));
+    bufferForBlt0->forceDisallowCPUCopy = true;
+    bufferForBlt1->forceDisallowCPUCopy = true;
+
+    cmdQ->enqueueCopyBuffer(bufferForBlt0.get(), bufferForBlt1.get(), 0, 0, copySize - 1, 0, nullptr, nullptr);
+    EXPECT_EQ(1u, bcsCsr->blitBufferCalled);
+    EXPECT_EQ(1u, cmdQ->timestampPacketContainer->peekNodes().size());
+
+    cmdQ->enqueueCopyBuffer(bufferForBlt0.get(), bufferForBlt1.get(), 0, 0, copySize, 0, nullptr, nullptr);
+    EXPECT_EQ(2u, bcsCsr->blitBufferCalled);
+    auto &timestampPacketNodes = cmdQ->timestampPacketContainer->peekNodes();
+    EXPECT_LT(1u, timestampPacketNodes.size());
+
+    HardwareParse bcsParser;
+    bcsParser.parseCommands<FamilyType>(bcsCsr->getCS(0));
+    auto copyBltCmds = findAll<XY_COPY_BLT *>(bcsParser.cmdList.begin(), bcsParser.cmdList.end());
+    ASSERT_EQ(2u, copyBltCmds.size());
+    auto copyBltCmd = genCmdCast<XY_COPY_BLT *>(*copyBltCmds.back());
+    EXPECT_EQ(bufferForBlt0->getGraphicsAllocation()->getGpuAddress() + copySize / 2, copyBltCmd->getSourceBaseAddress());
+    EXPECT_EQ(bufferForBlt1->getGraphicsAllocation()->getGpuAddress() + copySize / 2, copyBltCmd->getDestinationBaseAddress());
+    EXPECT_EQ(copySize / 2, static_cast<size_t>(copyBltCmd->getTransferWidth()) * copyBltCmd->getTransferHeight());
+
+    HardwareParse gpgpuParser;
+    gpgpuParser.parseCommands<FamilyType>(*cmdQ->peekCommandStream());
+    auto walkerItor = find<WALKER_TYPE *>(gpgpuParser.cmdList.begin(), gpgpuParser.cmdList.end());
+    ASSERT_NE(gpgpuParser.cmdList.end(), walkerItor);
+
+    auto blitNodeAddress = timestampPacketNodes.back()->getGpuAddress() + offsetof(TimestampPacketStorage, packets[0].contextEnd);
+    bool blitSemaphoreFound = false;
+    for (auto cmdItor = walkerItor; cmdItor != gpgpuParser.cmdList.end(); cmdItor++) {
+        if (auto semaphoreCmd = genCmdCast<MI_SEMAPHORE_WAIT *>(*cmdItor)) {
+            blitSemaphoreFound |= (blitNodeAddress == semaphoreCmd->getSemaphoreGraphicsAddress());
+        }
+    }
+    EXPECT_TRUE(blitSemaphoreFound);
+}
+
+HWTEST_TEMPLATED_F(BcsBufferTests, givenSplitBcsCopyEnabledWhenReadBufferCalledThenHostPtrAllocationIsReleasedAfterGpgpuPartCompletes) {
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsCopyMinSize.set(4 * MemoryConstants::pageSize);
+
+    auto cmdQ = clUniquePtr(new MockCommandQueueHw<FamilyType>(bcsMockContext.get(), device.get(), nullptr));
+    auto bcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(cmdQ->getBcsCommandStreamReceiver());
+    auto &gpgpuCsr = cmdQ->getGpgpuCommandStreamReceiver();
+    size_t readSize = 4 * MemoryConstants::pageSize;
+
+    auto buffer = clUniquePtr(Buffer::create(bcsMockContext.get(), CL_MEM_READ_WRITE, readSize, nullptr, retVal));
+    buffer->forceDisallowCPUCopy = true;
+    auto hostPtr = alignedMalloc(readSize, MemoryConstants::pageSize);
+
+    cmdQ->enqueueReadBuffer(buffer.get(), CL_FALSE, 0, readSize, hostPtr, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(1u, bcsCsr->blitBufferCalled);
+    EXPECT_TRUE(bcsCsr->getTemporaryAllocations().peekIsEmpty());
+
+    auto findHostPtrAllocation = [&]() -> GraphicsAllocation * {
+        for (auto allocation = gpgpuCsr.getTemporaryAllocations().peekHead(); allocation != nullptr; allocation = allocation->next) {
+            if (allocation->getUnderlyingBuffer() == hostPtr) {
+                return allocation;
+            }
+        }
+        return nullptr;
+    };
+    auto hostPtrAllocation = findHostPtrAllocation();
+    ASSERT_NE(nullptr, hostPtrAllocation);
+    auto gpgpuTaskCount = hostPtrAllocation->getTaskCount(gpgpuCsr.getOsContext().getContextId());
+    EXPECT_EQ(cmdQ->taskCount, gpgpuTaskCount);
+
+    // blitter part completing first does not release the allocation still written by kernels
+    bcsCsr->getInternalAllocationStorage()->cleanAllocationList(bcsCsr->peekTaskCount(), TEMPORARY_ALLOCATION);
+    gpgpuCsr.getInternalAllocationStorage()->cleanAllocationList(gpgpuTaskCount - 1, TEMPORARY_ALLOCATION);
+    EXPECT_EQ(hostPtrAllocation, findHostPtrAllocation());
+
+    gpgpuCsr.getInternalAllocationStorage()->cleanAllocationList(gpgpuTaskCount, TEMPORARY_ALLOCATION);
+    EXPECT_EQ(nullptr, findHostPtrAllocation());
+
+    alignedFree(hostPtr);
+}
+
 HWTEST_TEMPLATED_F(BcsBufferTests, givenBlockedBlitEnqueueWhenUnblockingThenMakeResidentAllTimestampPackets) {
     auto bcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(commandQueue->getBcsCommandStreamReceiver());
     bcsCsr->storeMakeResidentAllocations = true;
@@ -1197,6 +1320,59 @@ HWTEST_TEMPLATED_F(BcsBufferTests, givenPipeControlRequestWhenDispatchingBlocked
     cmdQ->isQueueBlocked();
 }
 
+HWTEST_TEMPLATED_F(BcsBufferTests, givenPipeControlRequestWhenDispatchingBlockedSplitCopyThenBcsWaitsForBarrierPipeControl) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsCopyMinSize.set(4 * MemoryConstants::pageSize);
+
+    auto cmdQ = clUniquePtr(new MockCommandQueueHw<FamilyType>(bcsMockContext.get(), device.get(), nullptr));
+    auto bcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(cmdQ->getBcsCommandStreamReceiver());
+
+    auto queueCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(cmdQ->gpgpuEngine->commandStreamReceiver);
+    queueCsr->stallingPipeControlOnNextFlushRequired = true;
+
+    size_t copySize = 4 * MemoryConstants::pageSize;
+    auto bufferForBlt0 = clUniquePtr(Buffer::create(bcsMockContext.get(), CL_MEM_READ_WRITE, copySize, nullptr, retVal));
+    auto bufferForBlt1 = clUniquePtr(Buffer::create(bcsMockContext.get(), CL_MEM_READ_WRITE, copySize, nullptr, retVal));
+    bufferForBlt0->forceDisallowCPUCopy = true;
+    bufferForBlt1->forceDisallowCPUCopy = true;
+
+    UserEvent userEvent;
+    cl_event waitlist = &userEvent;
+    cmdQ->enqueueCopyBuffer(bufferForBlt0.get(), bufferForBlt1.get(), 0, 0, copySize, 1, &waitlist, nullptr);
+    EXPECT_EQ(0u, bcsCsr->blitBufferCalled);
+    userEvent.setStatus(CL_COMPLETE);
+    EXPECT_EQ(1u, bcsCsr->blitBufferCalled);
+    EXPECT_FALSE(queueCsr->isStallingPipeControlOnNextFlushRequired());
+
+    HardwareParse gpgpuHwParser;
+    gpgpuHwParser.parseCommands<FamilyType>(queueCsr->getCS(0));
+    std::vector<uint64_t> barrierAddresses;
+    for (auto &cmd : gpgpuHwParser.cmdList) {
+        if (auto pipeControlCmd = genCmdCast<PIPE_CONTROL *>(cmd)) {
+            if (pipeControlCmd->getCommandStreamerStallEnable() &&
+                pipeControlCmd->getPostSyncOperation() == PIPE_CONTROL::POST_SYNC_OPERATION::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA) {
+                barrierAddresses.push_back((static_cast<uint64_t>(pipeControlCmd->getAddressHigh()) << 32) | pipeControlCmd->getAddress());
+            }
+        }
+    }
+    ASSERT_NE(0u, barrierAddresses.size());
+
+    HardwareParse bcsHwParser;
+    bcsHwParser.parseCommands<FamilyType>(bcsCsr->commandStream);
+    bool barrierSemaphoreFound = false;
+    for (auto &cmd : bcsHwParser.cmdList) {
+        if (auto semaphoreCmd = genCmdCast<MI_SEMAPHORE_WAIT *>(cmd)) {
+            auto semaphoreAddress = semaphoreCmd->getSemaphoreGraphicsAddress();
+            barrierSemaphoreFound |= std::find(barrierAddresses.begin(), barrierAddresses.end(), semaphoreAddress) != barrierAddresses.end();
+        }
+    }
+    EXPECT_TRUE(barrierSemaphoreFound);
+
+    cmdQ->isQueueBlocked();
+}
+
 HWTEST_TEMPLATED_F(BcsBufferTests, givenBufferOperationWithoutKernelWhenEstimatingCommandsSizeThenReturnCorrectValue) {
     auto cmdQ = clUniquePtr(new MockCommandQueueHw<FamilyType>(bcsMockContext.get(), device.get(), nullptr));
     CsrDependencies csrDependencies;
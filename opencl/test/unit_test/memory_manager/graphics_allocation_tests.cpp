@@ -9,6 +9,10 @@
 
 #include "gtest/gtest.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace NEO;
 
 TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenIsCreatedThenAllInspectionIdsAreSetToZero) {
@@ -179,3 +183,109 @@ TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenQueryingUsedPageSizeThen
         EXPECT_EQ(MemoryConstants::pageSize64k, graphicsAllocation.getUsedPageSize());
     }
 }
+
+TEST(DirtyPageTrackerTest, givenMarkedRangesWhenTakingDirtyRangesThenContiguousPagesAreMergedClippedToAllocationSizeAndCleared) {
+    DirtyPageTracker dirtyPages;
+    EXPECT_FALSE(dirtyPages.isTracking());
+
+    size_t allocationSize = 70 * MemoryConstants::pageSize + 100;
+    std::vector<std::pair<size_t, size_t>> ranges;
+    dirtyPages.takeDirtyRanges(allocationSize, [&](size_t offset, size_t size) { ranges.push_back({offset, size}); });
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(0u, ranges[0].first);
+    EXPECT_EQ(allocationSize, ranges[0].second);
+    EXPECT_TRUE(dirtyPages.isTracking());
+    EXPECT_EQ(0u, dirtyPages.getDirtyPagesCount());
+
+    dirtyPages.markRange(allocationSize, MemoryConstants::pageSize - 1, 2);
+    dirtyPages.markRange(allocationSize, 63 * MemoryConstants::pageSize, 2 * MemoryConstants::pageSize);
+    dirtyPages.markRange(allocationSize, 70 * MemoryConstants::pageSize + 50, 1000);
+    dirtyPages.markRange(allocationSize, allocationSize + 1, 1);
+    EXPECT_EQ(5u, dirtyPages.getDirtyPagesCount());
+    EXPECT_TRUE(dirtyPages.isPageDirty(64));
+    EXPECT_FALSE(dirtyPages.isPageDirty(65));
+
+    ranges.clear();
+    dirtyPages.takeDirtyRanges(allocationSize, [&](size_t offset, size_t size) { ranges.push_back({offset, size}); });
+    ASSERT_EQ(3u, ranges.size());
+    EXPECT_EQ(0u, ranges[0].first);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, ranges[0].second);
+    EXPECT_EQ(63 * MemoryConstants::pageSize, ranges[1].first);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, ranges[1].second);
+    EXPECT_EQ(70 * MemoryConstants::pageSize, ranges[2].first);
+    EXPECT_EQ(100u, ranges[2].second);
+    EXPECT_EQ(0u, dirtyPages.getDirtyPagesCount());
+
+    dirtyPages.markRange(allocationSize, 0, 1);
+    dirtyPages.markAll();
+    EXPECT_FALSE(dirtyPages.isTracking());
+    ranges.clear();
+    dirtyPages.takeDirtyRanges(allocationSize, [&](size_t offset, size_t size) { ranges.push_back({offset, size}); });
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(allocationSize, ranges[0].second);
+    EXPECT_EQ(0u, dirtyPages.getDirtyPagesCount());
+}
+
+TEST(DirtyPageTrackerTest, givenPagesMarkedWhileDirtyRangesAreTakenThenEveryMarkedPageIsTakenExactlyOnce) {
+    constexpr size_t pagesCount = 256;
+    constexpr size_t allocationSize = pagesCount * MemoryConstants::pageSize;
+    constexpr size_t rounds = 200;
+    DirtyPageTracker dirtyPages;
+    dirtyPages.takeDirtyRanges(allocationSize, [](size_t, size_t) {});
+
+    std::vector<uint32_t> takenPages(pagesCount, 0u);
+    auto takePages = [&]() {
+        dirtyPages.takeDirtyRanges(allocationSize, [&](size_t offset, size_t size) {
+            for (auto page = offset / MemoryConstants::pageSize; page < (offset + size) / MemoryConstants::pageSize; page++) {
+                takenPages[page]++;
+            }
+        });
+    };
+
+    std::atomic<bool> markingDone{false};
+    std::thread markingThread([&]() {
+        for (size_t round = 0; round < rounds; round++) {
+            for (size_t page = 0; page < pagesCount; page++) {
+                // each page is marked once per round, the next round starts when all pages of previous one were taken
+                dirtyPages.markRange(allocationSize, page * MemoryConstants::pageSize, 1);
+            }
+            while (dirtyPages.getDirtyPagesCount() != 0u) {
+                std::this_thread::yield();
+            }
+        }
+        markingDone = true;
+    });
+    while (!markingDone) {
+        takePages();
+    }
+    markingThread.join();
+    takePages();
+
+    for (auto count : takenPages) {
+        EXPECT_EQ(rounds, count);
+    }
+}
+
+TEST(GraphicsAllocationTest, givenUploadedAllocationWhenSettingWritableRangeThenOnlyRangeIsTracked) {
+    MockGraphicsAllocation graphicsAllocation(nullptr, 4 * MemoryConstants::pageSize);
+    graphicsAllocation.getAubDirtyPages().takeDirtyRanges(4 * MemoryConstants::pageSize, [](size_t, size_t) {});
+    graphicsAllocation.setAubWritable(false, GraphicsAllocation::defaultBank);
+
+    graphicsAllocation.setAubWritableRange(MemoryConstants::pageSize, 1, GraphicsAllocation::defaultBank);
+    EXPECT_TRUE(graphicsAllocation.isAubWritable(GraphicsAllocation::defaultBank));
+    EXPECT_TRUE(graphicsAllocation.getAubDirtyPages().isTracking());
+    EXPECT_EQ(1u, graphicsAllocation.getAubDirtyPages().getDirtyPagesCount());
+    EXPECT_FALSE(graphicsAllocation.getTbxDirtyPages().isTracking());
+
+    graphicsAllocation.setAubWritable(true, GraphicsAllocation::defaultBank);
+    EXPECT_FALSE(graphicsAllocation.getAubDirtyPages().isTracking());
+}
+
+TEST(GraphicsAllocationTest, givenAllocationWritableAsWholeWhenSettingWritableRangeThenWholeAllocationStaysWritable) {
+    MockGraphicsAllocation graphicsAllocation(nullptr, 4 * MemoryConstants::pageSize);
+    EXPECT_TRUE(graphicsAllocation.isTbxWritable(GraphicsAllocation::defaultBank));
+
+    graphicsAllocation.setTbxWritableRange(MemoryConstants::pageSize, 1, GraphicsAllocation::defaultBank);
+    EXPECT_TRUE(graphicsAllocation.isTbxWritable(GraphicsAllocation::defaultBank));
+    EXPECT_FALSE(graphicsAllocation.getTbxDirtyPages().isTracking());
+}
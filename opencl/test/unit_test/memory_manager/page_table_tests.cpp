@@ -172,15 +172,63 @@ TEST_F(PageTableTests48, pageWalkSimple) {
 
     size_t walked = 0u;
     size_t lastOffset = 0;
+    uint32_t walkerCalls = 0u;
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
         EXPECT_EQ(lastOffset, offset);
-        EXPECT_GE(pageSize, size);
 
         walked += size;
         lastOffset += size;
+        walkerCalls++;
     };
     pageTable->pageWalk(addr1, lSize, 0, 0, walker, MemoryBanks::MainBank);
     EXPECT_EQ(lSize, walked);
+    // pages reserved together are contiguous in physical memory, also across page table boundary
+    EXPECT_EQ(1u, walkerCalls);
+}
+
+TEST_F(PageTableTests48, givenPagesNotContiguousInPhysicalMemoryWhenPageWalkIsCalledThenWalkerIsCalledForEachPhysicalRun) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr;
+    auto physSecondPage = pageTable->map(gpuVa + pageSize, pageSize, 0, MemoryBanks::MainBank);
+
+    std::vector<std::pair<uint64_t, size_t>> runs;
+    size_t lastOffset = 0;
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        EXPECT_EQ(lastOffset, offset);
+        lastOffset += size;
+        runs.push_back({physAddress, size});
+    };
+    pageTable->pageWalk(gpuVa, 4 * pageSize, 0, 0, walker, MemoryBanks::MainBank);
+
+    ASSERT_EQ(3u, runs.size());
+    EXPECT_EQ(physSecondPage + pageSize, runs[0].first);
+    EXPECT_EQ(pageSize, runs[0].second);
+    EXPECT_EQ(physSecondPage, runs[1].first);
+    EXPECT_EQ(pageSize, runs[1].second);
+    EXPECT_EQ(physSecondPage + 2 * pageSize, runs[2].first);
+    EXPECT_EQ(2 * pageSize, runs[2].second);
+}
+
+TEST_F(PageTableTests48, givenUnmappedRangeWhenMapIsCalledThenPhysicalMemoryIsReservedOncePerPageTable) {
+    struct CountingPhysicalAddressAllocator : public MockPhysicalAddressAllocator {
+        uint64_t reservePage(uint32_t memoryBank, size_t pageSize, size_t alignement) override {
+            reservePageCalled++;
+            return MockPhysicalAddressAllocator::reservePage(memoryBank, pageSize, alignement);
+        }
+        uint32_t reservePageCalled = 0u;
+    } countingAllocator;
+
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&countingAllocator));
+    uintptr_t gpuVa = refAddr + 16 * pageSize;
+    size_t size = 1024 * pageSize;
+
+    auto phys = pageTable->map(gpuVa, size, 0, MemoryBanks::MainBank);
+    EXPECT_EQ(countingAllocator.initialPageAddress, phys);
+    EXPECT_EQ(3u, countingAllocator.reservePageCalled);
+    EXPECT_EQ(countingAllocator.initialPageAddress + size, countingAllocator.mainAllocator.load());
+
+    pageTable->map(gpuVa, size, 0, MemoryBanks::MainBank);
+    EXPECT_EQ(3u, countingAllocator.reservePageCalled);
 }
 
 TEST_F(PageTableTests48, givenReservedPhysicalAddressWhenPageWalkIsCalledThenPageTablesAreFilledWithProperAddresses) {
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/allocations_list.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/page_fault_manager/mock_cpu_page_fault_manager.h"
@@ -15,12 +16,18 @@
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
 #include "opencl/test/unit_test/mocks/mock_execution_environment.h"
+#include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 #include "opencl/test/unit_test/mocks/mock_svm_manager.h"
 #include "test.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace NEO;
 
 template <bool enableLocalMemory>
@@ -863,3 +870,179 @@ TEST(UnfiedSharedMemoryTransferCalls, givenSharedUSMllocationWithLocalMemoryWhen
     ASSERT_EQ(CL_SUCCESS, status);
     clReleaseCommandQueue(commandQueue);
 }
+
+TEST(SvmAllocationTrackerTest, givenTrackedAllocationsWhenLookingUpPointersThenOnlyPointersInsideAllocationsAreFound) {
+    SVMAllocsManager::MapBasedAllocationTracker tracker;
+    MockGraphicsAllocation allocation1(reinterpret_cast<void *>(0x10000), 0x10000, MemoryConstants::pageSize64k);
+    MockGraphicsAllocation allocation2(reinterpret_cast<void *>(0x30000), 0x30000, MemoryConstants::pageSize64k);
+
+    SvmAllocationData allocData1;
+    allocData1.gpuAllocation = &allocation1;
+    allocData1.size = MemoryConstants::pageSize;
+    tracker.insert(allocData1);
+
+    SvmAllocationData allocData2;
+    allocData2.gpuAllocation = &allocation2;
+    allocData2.size = MemoryConstants::pageSize64k;
+    tracker.insert(allocData2);
+    EXPECT_EQ(2u, tracker.getNumAllocs());
+
+    EXPECT_EQ(nullptr, tracker.get(nullptr));
+    EXPECT_EQ(nullptr, tracker.get(reinterpret_cast<void *>(0xffff)));
+    EXPECT_EQ(&allocation1, tracker.get(reinterpret_cast<void *>(0x10000))->gpuAllocation);
+    EXPECT_EQ(&allocation1, tracker.get(reinterpret_cast<void *>(0x10fff))->gpuAllocation);
+    EXPECT_EQ(nullptr, tracker.get(reinterpret_cast<void *>(0x11000)));
+    EXPECT_EQ(nullptr, tracker.get(reinterpret_cast<void *>(0x2ffff)));
+    EXPECT_EQ(&allocation2, tracker.get(reinterpret_cast<void *>(0x30000))->gpuAllocation);
+    EXPECT_EQ(&allocation2, tracker.get(reinterpret_cast<void *>(0x3ffff))->gpuAllocation);
+    EXPECT_EQ(nullptr, tracker.get(reinterpret_cast<void *>(0x40000)));
+
+    tracker.remove(allocData1);
+    EXPECT_EQ(1u, tracker.getNumAllocs());
+    EXPECT_EQ(nullptr, tracker.get(reinterpret_cast<void *>(0x10000)));
+    EXPECT_EQ(&allocation2, tracker.get(reinterpret_cast<void *>(0x30000))->gpuAllocation);
+
+    tracker.remove(allocData2);
+    EXPECT_EQ(0u, tracker.getNumAllocs());
+    EXPECT_EQ(nullptr, tracker.get(reinterpret_cast<void *>(0x30000)));
+}
+
+TEST(SvmAllocationTrackerTest, givenConcurrentLookupsWhenAllocationsAreInsertedAndRemovedThenPersistentAllocationIsAlwaysFound) {
+    SVMAllocsManager::MapBasedAllocationTracker tracker;
+    MockGraphicsAllocation persistentAllocation(reinterpret_cast<void *>(0x100000), 0x100000, MemoryConstants::pageSize64k);
+    SvmAllocationData persistentAllocData;
+    persistentAllocData.gpuAllocation = &persistentAllocation;
+    persistentAllocData.size = MemoryConstants::pageSize64k;
+    tracker.insert(persistentAllocData);
+
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> transientAllocations;
+    for (uint32_t i = 0; i < 16; i++) {
+        auto gpuAddress = 0x200000 + i * MemoryConstants::pageSize64k;
+        transientAllocations.emplace_back(new MockGraphicsAllocation(reinterpret_cast<void *>(gpuAddress), gpuAddress, MemoryConstants::pageSize64k));
+    }
+
+    std::atomic<bool> finished(false);
+    std::atomic<uint32_t> failedLookups(0u);
+    std::vector<std::thread> readers;
+    for (uint32_t i = 0; i < 4; i++) {
+        readers.emplace_back([&]() {
+            while (!finished) {
+                auto allocData = tracker.get(reinterpret_cast<void *>(0x100000 + MemoryConstants::pageSize));
+                if (allocData == nullptr || allocData->gpuAllocation != &persistentAllocation) {
+                    failedLookups++;
+                }
+                // transient allocation may be removed at any time, it is only looked up
+                tracker.get(reinterpret_cast<void *>(0x200000));
+            }
+        });
+    }
+
+    for (uint32_t iteration = 0; iteration < 100; iteration++) {
+        std::vector<SvmAllocationData> transientAllocData(transientAllocations.size());
+        for (size_t i = 0; i < transientAllocations.size(); i++) {
+            transientAllocData[i].gpuAllocation = transientAllocations[i].get();
+            transientAllocData[i].size = MemoryConstants::pageSize64k;
+            tracker.insert(transientAllocData[i]);
+        }
+        for (auto &allocData : transientAllocData) {
+            tracker.remove(allocData);
+        }
+    }
+    finished = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(0u, failedLookups);
+    EXPECT_EQ(1u, tracker.getNumAllocs());
+}
+
+TEST(SvmAllocationTrackerTest, givenAllocationsInsertedWithoutLookupsWhenLookingUpThenSnapshotIsRebuiltOnce) {
+    MockSvmAllocationTracker tracker;
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> allocations;
+    for (uint32_t i = 0; i < 4; i++) {
+        auto gpuAddress = 0x100000 + i * MemoryConstants::pageSize64k;
+        allocations.emplace_back(new MockGraphicsAllocation(reinterpret_cast<void *>(gpuAddress), gpuAddress, MemoryConstants::pageSize64k));
+        SvmAllocationData allocData;
+        allocData.gpuAllocation = allocations.back().get();
+        allocData.size = MemoryConstants::pageSize64k;
+        tracker.insert(allocData);
+    }
+    EXPECT_EQ(nullptr, tracker.snapshot.load());
+    EXPECT_TRUE(tracker.snapshotOutdated);
+
+    for (auto &allocation : allocations) {
+        EXPECT_EQ(allocation.get(), tracker.get(allocation->getUnderlyingBuffer())->gpuAllocation);
+    }
+    ASSERT_NE(nullptr, tracker.snapshot.load());
+    EXPECT_EQ(allocations.size(), tracker.snapshot.load()->size());
+    EXPECT_FALSE(tracker.snapshotOutdated);
+    EXPECT_TRUE(tracker.retiredSnapshots.empty());
+    EXPECT_TRUE(tracker.gracePeriodSnapshots.empty());
+}
+
+TEST(SvmAllocationTrackerTest, givenManyAllocationsWhenLookingUpAfterChangeThenMapIsSearchedUntilSnapshotRebuildIsSpreadOverLookups) {
+    MockSvmAllocationTracker tracker;
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> allocations;
+    std::vector<SvmAllocationData> allocationsData;
+    const size_t numAllocations = 4 * MockSvmAllocationTracker::allocationsPerLockedLookup;
+    for (size_t i = 0; i < numAllocations; i++) {
+        auto gpuAddress = 0x100000 + i * MemoryConstants::pageSize64k;
+        allocations.emplace_back(new MockGraphicsAllocation(reinterpret_cast<void *>(gpuAddress), gpuAddress, MemoryConstants::pageSize64k));
+        SvmAllocationData allocData;
+        allocData.gpuAllocation = allocations.back().get();
+        allocData.size = MemoryConstants::pageSize;
+        allocationsData.push_back(allocData);
+        tracker.insert(allocData);
+    }
+
+    // one lookup per allocationsPerLockedLookup allocations searches the map
+    EXPECT_EQ(allocations[1].get(), tracker.get(ptrOffset(allocations[1]->getUnderlyingBuffer(), 1))->gpuAllocation);
+    EXPECT_EQ(nullptr, tracker.get(ptrOffset(allocations[1]->getUnderlyingBuffer(), MemoryConstants::pageSize)));
+    tracker.remove(allocationsData[1]);
+    EXPECT_EQ(nullptr, tracker.get(allocations[1]->getUnderlyingBuffer()));
+    tracker.insert(allocationsData[1]);
+    EXPECT_EQ(nullptr, tracker.get(reinterpret_cast<void *>(0xffff)));
+    EXPECT_EQ(4u, tracker.lockedLookups);
+    EXPECT_EQ(nullptr, tracker.snapshot.load());
+    EXPECT_TRUE(tracker.snapshotOutdated);
+
+    EXPECT_EQ(allocations[0].get(), tracker.get(allocations[0]->getUnderlyingBuffer())->gpuAllocation);
+    ASSERT_NE(nullptr, tracker.snapshot.load());
+    EXPECT_EQ(numAllocations, tracker.snapshot.load()->size());
+    EXPECT_FALSE(tracker.snapshotOutdated);
+    EXPECT_EQ(0u, tracker.lockedLookups);
+}
+
+TEST(SvmAllocationTrackerTest, givenReaderInsideLookupWhenSnapshotIsReplacedThenWriterDoesNotWaitAndOldSnapshotsAreFreedAfterReaderLeaves) {
+    MockSvmAllocationTracker tracker;
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> allocations;
+    auto insertAndLookUp = [&]() {
+        auto gpuAddress = 0x100000 + allocations.size() * MemoryConstants::pageSize64k;
+        allocations.emplace_back(new MockGraphicsAllocation(reinterpret_cast<void *>(gpuAddress), gpuAddress, MemoryConstants::pageSize64k));
+        SvmAllocationData allocData;
+        allocData.gpuAllocation = allocations.back().get();
+        allocData.size = MemoryConstants::pageSize64k;
+        tracker.insert(allocData);
+        EXPECT_NE(nullptr, tracker.get(reinterpret_cast<void *>(gpuAddress)));
+    };
+
+    insertAndLookUp();
+    auto &readerSlot = tracker.readerSlots[0];
+    auto epochIndex = tracker.enterReadSection(readerSlot);
+    auto snapshotUsedByReader = tracker.snapshot.load();
+
+    insertAndLookUp();
+    insertAndLookUp();
+    EXPECT_EQ(1u, tracker.retiredSnapshots.size());
+    ASSERT_EQ(1u, tracker.gracePeriodSnapshots.size());
+    EXPECT_EQ(snapshotUsedByReader, tracker.gracePeriodSnapshots[0]);
+    auto epochWithReader = tracker.epoch.load();
+
+    readerSlot.activeReaders[epochIndex]--;
+    insertAndLookUp();
+    EXPECT_EQ(epochWithReader + 1, tracker.epoch.load());
+    EXPECT_TRUE(tracker.retiredSnapshots.empty());
+    EXPECT_EQ(2u, tracker.gracePeriodSnapshots.size());
+    EXPECT_EQ(std::find(tracker.gracePeriodSnapshots.begin(), tracker.gracePeriodSnapshots.end(), snapshotUsedByReader), tracker.gracePeriodSnapshots.end());
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "opencl/source/tbx/tbx_proto.h"
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace NEO {
+
+// Loopback TBX server answering reads from memory, MMIO and GTT written by the client.
+// Serves a single connection on 127.0.0.1 and an ephemeral port until the client disconnects.
+class MockTbxServer {
+  public:
+    // when discardMemoryWrites is set written data is not stored, reads return zeros
+    MockTbxServer(bool discardMemoryWrites = false) : discardMemoryWrites(discardMemoryWrites) {
+        listenSocket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        socklen_t addressLength = sizeof(address);
+        if (listenSocket < 0 ||
+            ::bind(listenSocket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+            ::listen(listenSocket, 1) != 0 ||
+            ::getsockname(listenSocket, reinterpret_cast<sockaddr *>(&address), &addressLength) != 0) {
+            return;
+        }
+        port = ntohs(address.sin_port);
+        serverThread = std::thread([this]() { serve(); });
+    }
+
+    ~MockTbxServer() {
+        if (listenSocket >= 0) {
+            // wakes up accept() when client never connected
+            ::shutdown(listenSocket, SHUT_RDWR);
+        }
+        waitForClientDisconnect();
+        if (listenSocket >= 0) {
+            ::close(listenSocket);
+        }
+    }
+
+    uint16_t getPort() const { return port; }
+
+    void waitForClientDisconnect() {
+        if (serverThread.joinable()) {
+            serverThread.join();
+        }
+    }
+
+    uint32_t getMessagesCount(uint32_t msgType) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = messagesCount.find(msgType);
+        return it != messagesCount.end() ? it->second : 0u;
+    }
+
+    uint8_t getMemoryByte(uint64_t address) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = memory.find(address);
+        return it != memory.end() ? it->second : 0u;
+    }
+
+    uint64_t getGttEntry(uint32_t index) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = gtt.find(index);
+        return it != gtt.end() ? it->second : 0u;
+    }
+
+  protected:
+    void serve() {
+        int clientSocket = ::accept(listenSocket, nullptr, nullptr);
+        if (clientSocket < 0) {
+            return;
+        }
+        HAS_MSG msg;
+        std::vector<uint8_t> data;
+        while (receive(clientSocket, &msg.hdr, sizeof(msg.hdr)) &&
+               msg.hdr.size <= sizeof(msg.u) &&
+               receive(clientSocket, &msg.u, msg.hdr.size)) {
+            std::lock_guard<std::mutex> lock(mutex);
+            messagesCount[msg.hdr.msg_type]++;
+
+            if (msg.hdr.msg_type == HAS_WRITE_DATA_REQ_TYPE) {
+                data.resize(msg.u.write_req.size);
+                if (!receive(clientSocket, data.data(), data.size())) {
+                    break;
+                }
+                if (!discardMemoryWrites) {
+                    auto address = getAddress(msg.u.write_req.address, msg.u.write_req.address_h);
+                    for (size_t i = 0; i < data.size(); i++) {
+                        memory[address + i] = data[i];
+                    }
+                }
+            } else if (msg.hdr.msg_type == HAS_GTT_REQ_TYPE) {
+                gtt[msg.u.gtt64_req.offset] = (static_cast<uint64_t>(msg.u.gtt64_req.data_h) << 32) | msg.u.gtt64_req.data;
+            } else if (msg.hdr.msg_type == HAS_MMIO_REQ_TYPE && msg.u.mmio_req.write) {
+                mmio[msg.u.mmio_req.offset] = msg.u.mmio_req.data;
+            } else if (msg.hdr.msg_type == HAS_MMIO_REQ_TYPE) {
+                HAS_MSG resp = {};
+                resp.hdr.msg_type = HAS_MMIO_RES_TYPE;
+                resp.hdr.trans_id = msg.hdr.trans_id;
+                resp.hdr.size = sizeof(HAS_MMIO_RES);
+                resp.u.mmio_res.data = mmio[msg.u.mmio_req.offset];
+                ::send(clientSocket, &resp, sizeof(HAS_HDR) + sizeof(HAS_MMIO_RES), 0);
+            } else if (msg.hdr.msg_type == HAS_READ_DATA_REQ_TYPE) {
+                auto address = getAddress(msg.u.read_req.address, msg.u.read_req.address_h);
+                HAS_MSG resp = {};
+                resp.hdr.msg_type = HAS_READ_DATA_RES_TYPE;
+                resp.hdr.trans_id = msg.hdr.trans_id;
+                resp.hdr.size = sizeof(HAS_READ_DATA_RES);
+                resp.u.read_res.address = msg.u.read_req.address;
+                resp.u.read_res.address_h = msg.u.read_req.address_h;
+                resp.u.read_res.size = msg.u.read_req.size;
+                data.assign(msg.u.read_req.size, 0u);
+                for (size_t i = 0; i < data.size(); i++) {
+                    auto it = memory.find(address + i);
+                    data[i] = it != memory.end() ? it->second : 0u;
+                }
+                ::send(clientSocket, &resp, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_RES), 0);
+                ::send(clientSocket, data.data(), data.size(), 0);
+            }
+        }
+        ::close(clientSocket);
+    }
+
+    static bool receive(int socket, void *buffer, size_t size) {
+        auto dataBuffer = static_cast<char *>(buffer);
+        while (size > 0) {
+            auto bytesRecv = ::recv(socket, dataBuffer, size, 0);
+            if (bytesRecv <= 0) {
+                return false;
+            }
+            dataBuffer += bytesRecv;
+            size -= static_cast<size_t>(bytesRecv);
+        }
+        return true;
+    }
+
+    static uint64_t getAddress(uint32_t address, uint32_t addressHigh) {
+        return (static_cast<uint64_t>(addressHigh) << 32) | address;
+    }
+
+    const bool discardMemoryWrites;
+    int listenSocket = -1;
+    uint16_t port = 0;
+    std::thread serverThread;
+
+    mutable std::mutex mutex;
+    std::map<uint32_t, uint32_t> messagesCount;
+    std::map<uint64_t, uint8_t> memory;
+    std::map<uint32_t, uint32_t> mmio;
+    std::map<uint32_t, uint64_t> gtt;
+};
+
+} // namespace NEO
@@ -50,6 +50,7 @@ class MockProgram : public Program {
     using Program::irBinarySize;
     using Program::isSpirV;
     using Program::linkerInput;
+    using Program::mappedUnpackedDeviceBinary;
     using Program::options;
     using Program::packDeviceBinary;
     using Program::packedDeviceBinary;
@@ -8,6 +8,17 @@
 #pragma once
 #include "shared/source/memory_manager/unified_memory_manager.h"
 namespace NEO {
+struct MockSvmAllocationTracker : SVMAllocsManager::MapBasedAllocationTracker {
+    using MapBasedAllocationTracker::enterReadSection;
+    using MapBasedAllocationTracker::epoch;
+    using MapBasedAllocationTracker::gracePeriodSnapshots;
+    using MapBasedAllocationTracker::lockedLookups;
+    using MapBasedAllocationTracker::readerSlots;
+    using MapBasedAllocationTracker::retiredSnapshots;
+    using MapBasedAllocationTracker::snapshot;
+    using MapBasedAllocationTracker::snapshotOutdated;
+};
+
 struct MockSVMAllocsManager : SVMAllocsManager {
 
     using SVMAllocsManager::memoryManager;
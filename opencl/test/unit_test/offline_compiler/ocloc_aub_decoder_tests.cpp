@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/offline_compiler/source/ocloc_aub_decoder.h"
+#include "shared/offline_compiler/source/offline_compiler.h"
+
+#include "opencl/source/aub_mem_dump/aub_block_codec.h"
+#include "opencl/test/unit_test/offline_compiler/mock/mock_argument_helper.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+using namespace AubMemDump;
+
+namespace {
+std::string createCompressedAub(const std::string &aub) {
+    ZeroRunCodec codec;
+    std::vector<uint8_t> encoded(codec.getMaxEncodedSize(aub.size()));
+    auto encodedSize = codec.encode(reinterpret_cast<const uint8_t *>(aub.data()), aub.size(), encoded.data());
+
+    BlockFileHeader fileHeader = {BlockFileHeader::magicValue, BlockFileHeader::versionValue, ZeroRunCodec::id, 0u};
+    BlockHeader blockHeader = {static_cast<uint32_t>(aub.size()), static_cast<uint32_t>(encodedSize), 0u, 0u};
+
+    std::string compressedAub(reinterpret_cast<const char *>(&fileHeader), sizeof(fileHeader));
+    compressedAub.append(reinterpret_cast<const char *>(&blockHeader), sizeof(blockHeader));
+    compressedAub.append(reinterpret_cast<const char *>(encoded.data()), encodedSize);
+    return compressedAub;
+}
+} // namespace
+
+TEST(OclocDecodeAubTest, givenCompressedAubWhenDecodingThenOriginalAubIsSaved) {
+    std::string aub(4096, '\0');
+    aub.replace(100, 7, "aubdata");
+    std::map<std::string, std::string> files = {{"capture.aub", createCompressedAub(aub)}};
+    MockOclocArgHelper argHelper(files);
+
+    const char *outputFile = "ocloc_decode_aub_test.aub";
+    std::vector<std::string> args = {"ocloc", "decode_aub", "-file", "capture.aub", "-out", outputFile};
+    EXPECT_EQ(NEO::ErrorCode::SUCCESS, NEO::decodeCompressedAubFile(args, &argHelper));
+
+    std::ifstream file(outputFile, std::ios::binary);
+    std::string decoded((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(outputFile);
+    EXPECT_EQ(aub, decoded);
+}
+
+TEST(OclocDecodeAubTest, givenFileWhichIsNotCompressedAubWhenDecodingThenInvalidFileIsReturned) {
+    std::map<std::string, std::string> files = {{"capture.aub", "not a compressed aub"}};
+    MockOclocArgHelper argHelper(files);
+
+    std::vector<std::string> args = {"ocloc", "decode_aub", "-file", "capture.aub", "-out", "ocloc_decode_aub_test_invalid.aub"};
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(NEO::ErrorCode::INVALID_FILE, NEO::decodeCompressedAubFile(args, &argHelper));
+    testing::internal::GetCapturedStdout();
+}
+
+TEST(OclocDecodeAubTest, givenMissingOutputFileWhenDecodingThenInvalidCommandLineIsReturned) {
+    std::map<std::string, std::string> files = {{"capture.aub", ""}};
+    MockOclocArgHelper argHelper(files);
+
+    std::vector<std::string> args = {"ocloc", "decode_aub", "-file", "capture.aub"};
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(NEO::ErrorCode::INVALID_COMMAND_LINE, NEO::decodeCompressedAubFile(args, &argHelper));
+    testing::internal::GetCapturedStdout();
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/offline_compiler/source/ocloc_parallel_build.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(OclocParseJobsCount, GivenValidValueThenJobsCountIsReturned) {
+    uint32_t jobsCount = 0u;
+    EXPECT_TRUE(parseJobsCount("4", jobsCount));
+    EXPECT_EQ(4u, jobsCount);
+
+    EXPECT_TRUE(parseJobsCount("1", jobsCount));
+    EXPECT_EQ(1u, jobsCount);
+}
+
+TEST(OclocParseJobsCount, GivenZeroThenAtLeastOneJobIsReturned) {
+    uint32_t jobsCount = 0u;
+    EXPECT_TRUE(parseJobsCount("0", jobsCount));
+    EXPECT_LE(1u, jobsCount);
+}
+
+TEST(OclocParseJobsCount, GivenInvalidValueThenFalseIsReturned) {
+    uint32_t jobsCount = 7u;
+    EXPECT_FALSE(parseJobsCount("", jobsCount));
+    EXPECT_FALSE(parseJobsCount("-1", jobsCount));
+    EXPECT_FALSE(parseJobsCount("2a", jobsCount));
+    EXPECT_FALSE(parseJobsCount("123456", jobsCount));
+    EXPECT_EQ(7u, jobsCount);
+}
+
+TEST(OclocRunBuildsInOrder, GivenMultipleJobsWhenRunningBuildsThenAllTasksAreBuiltAndReportedInOrder) {
+    constexpr size_t numTasks = 32u;
+    for (uint32_t jobsCount : {1u, 4u}) {
+        std::vector<std::atomic<int>> built(numTasks);
+        for (auto &flag : built) {
+            flag = 0;
+        }
+        std::vector<size_t> reported;
+
+        runBuildsInOrder(
+            numTasks, jobsCount,
+            [&](size_t taskId) {
+                if (taskId % 3 == 0) {
+                    std::this_thread::yield();
+                }
+                built[taskId]++;
+            },
+            [&](size_t taskId) {
+                EXPECT_EQ(1, built[taskId].load());
+                reported.push_back(taskId);
+                return true;
+            });
+
+        ASSERT_EQ(numTasks, reported.size());
+        for (size_t i = 0; i < numTasks; i++) {
+            EXPECT_EQ(i, reported[i]);
+            EXPECT_EQ(1, built[i].load());
+        }
+    }
+}
+
+TEST(OclocRunBuildsInOrder, GivenReportReturningFalseThenFollowingTasksAreNotReported) {
+    constexpr size_t numTasks = 16u;
+    for (uint32_t jobsCount : {1u, 4u}) {
+        std::atomic<size_t> builtCount{0u};
+        std::vector<size_t> reported;
+
+        runBuildsInOrder(
+            numTasks, jobsCount,
+            [&](size_t) { builtCount++; },
+            [&](size_t taskId) {
+                reported.push_back(taskId);
+                return taskId < 2;
+            });
+
+        EXPECT_EQ(3u, reported.size());
+        EXPECT_LE(3u, builtCount.load());
+        EXPECT_GE(numTasks, builtCount.load());
+    }
+}
+
+TEST(OclocFrontEndOutputCache, GivenDifferentInputsThenKeysDiffer) {
+    auto key = FrontEndOutputCache::getKey(1u, 120u, "src", "-cl-opt-disable", "");
+    EXPECT_EQ(key, FrontEndOutputCache::getKey(1u, 120u, "src", "-cl-opt-disable", ""));
+    EXPECT_NE(key, FrontEndOutputCache::getKey(2u, 120u, "src", "-cl-opt-disable", ""));
+    EXPECT_NE(key, FrontEndOutputCache::getKey(1u, 210u, "src", "-cl-opt-disable", ""));
+    EXPECT_NE(key, FrontEndOutputCache::getKey(1u, 120u, "src2", "-cl-opt-disable", ""));
+    EXPECT_NE(key, FrontEndOutputCache::getKey(1u, 120u, "src", "", "-cl-opt-disable"));
+}
+
+TEST(OclocFrontEndOutputCache, GivenStoredOutputWhenLookingUpThenOutputIsReturned) {
+    FrontEndOutputCache cache;
+    FrontEndOutputCache::Output output;
+
+    EXPECT_FALSE(cache.lookupOrReserve("key", output));
+
+    FrontEndOutputCache::Output producedOutput;
+    producedOutput.successful = true;
+    producedOutput.ir = {'I', 'R'};
+    producedOutput.buildLog = "warning";
+    cache.store("key", producedOutput);
+
+    EXPECT_TRUE(cache.lookupOrReserve("key", output));
+    EXPECT_TRUE(output.successful);
+    EXPECT_EQ(producedOutput.ir, output.ir);
+    EXPECT_EQ(producedOutput.buildLog, output.buildLog);
+    EXPECT_EQ(1u, cache.getHits());
+}
+
+TEST(OclocFrontEndOutputCache, GivenFailedOutputWhenLookingUpThenCallerTranslatesOnItsOwn) {
+    FrontEndOutputCache cache;
+    FrontEndOutputCache::Output output;
+
+    EXPECT_FALSE(cache.lookupOrReserve("key", output));
+    cache.store("key", {});
+
+    EXPECT_FALSE(cache.lookupOrReserve("key", output));
+    EXPECT_EQ(0u, cache.getHits());
+}
+
+TEST(OclocFrontEndOutputCache, GivenOutputInFlightWhenLookingUpThenLookupWaitsForProducer) {
+    FrontEndOutputCache cache;
+    FrontEndOutputCache::Output output;
+    EXPECT_FALSE(cache.lookupOrReserve("key", output));
+
+    std::atomic<bool> found{false};
+    std::thread consumer([&]() {
+        FrontEndOutputCache::Output consumerOutput;
+        found = cache.lookupOrReserve("key", consumerOutput);
+    });
+
+    FrontEndOutputCache::Output producedOutput;
+    producedOutput.successful = true;
+    producedOutput.ir = {'I', 'R'};
+    cache.store("key", producedOutput);
+    consumer.join();
+
+    EXPECT_TRUE(found);
+    EXPECT_EQ(1u, cache.getHits());
+}
@@ -7,6 +7,7 @@
 
 #include "offline_compiler_tests.h"
 
+#include "shared/offline_compiler/source/ocloc_parallel_build.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_cmds.h"
@@ -225,6 +226,67 @@ TEST_F(MultiCommandTests, GoodMultiBuildTestWithOutputFileListFlag) {
     deleteOutFileList();
     delete pMultiCommand;
 }
+TEST_F(MultiCommandTests, GivenJobsCountWhenBuildingMultiCommandThenAllBuildsAreReportedInOrder) {
+    nameOfFileWithArgs = "test_files/ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-multi",
+        nameOfFileWithArgs.c_str(),
+        "-q",
+        "-j",
+        "2",
+        "-output_file_list",
+        "outFileList.txt",
+    };
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 4;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    pMultiCommand = MultiCommand::create(argv, retVal);
+
+    EXPECT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    outFileList = pMultiCommand->outputFileList;
+
+    std::ifstream outFileListStream(outFileList);
+    std::string line;
+    for (int i = 0; i < numOfBuild; i++) {
+        std::string outFileName = pMultiCommand->outDirForBuilds + "/build_no_" + std::to_string(i + 1);
+        EXPECT_TRUE(compilerOutputExists(outFileName, "bin"));
+
+        ASSERT_TRUE(static_cast<bool>(std::getline(outFileListStream, line)));
+        EXPECT_NE(std::string::npos, line.find("build_no_" + std::to_string(i + 1) + ".bin"));
+    }
+    outFileListStream.close();
+
+    deleteFileWithArgs();
+    deleteOutFileList();
+    delete pMultiCommand;
+}
+
+TEST_F(MultiCommandTests, GivenInvalidJobsCountWhenCreatingMultiCommandThenInvalidCommandLineIsReturned) {
+    nameOfFileWithArgs = "test_files/ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-multi",
+        nameOfFileWithArgs.c_str(),
+        "-j",
+        "many"};
+
+    testing::internal::CaptureStdout();
+    auto pMultiCommand = std::unique_ptr<MultiCommand>(MultiCommand::create(argv, retVal));
+    testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(nullptr, pMultiCommand);
+    EXPECT_EQ(INVALID_COMMAND_LINE, retVal);
+}
+
 TEST_F(OfflineCompilerTests, GoodArgTest) {
     std::vector<std::string> argv = {
         "ocloc",
@@ -725,6 +787,45 @@ TEST(OfflineCompilerTest, buildSourceCode) {
     EXPECT_NE(0u, mockOfflineCompiler->getGenBinarySize());
 }
 
+TEST(OfflineCompilerTest, givenFrontEndOutputCacheWhenSameSourceIsBuiltTwiceThenFrontEndOutputIsReused) {
+    FrontEndOutputCache frontEndOutputCache;
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    for (uint32_t build = 0; build < 2; build++) {
+        auto mockOfflineCompiler = std::unique_ptr<MockOfflineCompiler>(new MockOfflineCompiler());
+        ASSERT_EQ(CL_SUCCESS, mockOfflineCompiler->initialize(argv.size(), argv));
+        mockOfflineCompiler->setFrontEndOutputCache(&frontEndOutputCache);
+
+        EXPECT_EQ(CL_SUCCESS, mockOfflineCompiler->buildSourceCode());
+        EXPECT_NE(nullptr, mockOfflineCompiler->getGenBinary());
+        EXPECT_NE(0u, mockOfflineCompiler->getGenBinarySize());
+        EXPECT_EQ(build, frontEndOutputCache.getHits());
+    }
+}
+
+TEST(OfflineCompilerTest, givenJobsCountOptionWhenCmdLineIsParsedThenItIsAccepted) {
+    auto mockOfflineCompiler = std::unique_ptr<MockOfflineCompiler>(new MockOfflineCompiler());
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-j",
+        "4"};
+    EXPECT_EQ(CL_SUCCESS, mockOfflineCompiler->parseCommandLine(argv.size(), argv));
+
+    argv.back() = "x";
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(INVALID_COMMAND_LINE, mockOfflineCompiler->parseCommandLine(argv.size(), argv));
+    testing::internal::GetCapturedStdout();
+}
+
 TEST(OfflineCompilerTest, GivenKernelWhenNoCharAfterKernelSourceThenBuildWithSuccess) {
     auto mockOfflineCompiler = std::unique_ptr<MockOfflineCompiler>(new MockOfflineCompiler());
     ASSERT_NE(nullptr, mockOfflineCompiler);
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/memory_constants.h"
+#include "shared/source/os_interface/linux/drm_buffer_object_cache.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+namespace {
+DrmBufferObjectCache::Entry createEntry(uintptr_t bo, uintptr_t cpuPtr) {
+    DrmBufferObjectCache::Entry entry;
+    entry.bo = reinterpret_cast<BufferObject *>(bo);
+    entry.cpuPtr = reinterpret_cast<void *>(cpuPtr);
+    return entry;
+}
+
+auto alwaysCompleted = [](const DrmBufferObjectCache::Entry &) { return true; };
+} // namespace
+
+TEST(DrmBufferObjectCacheTest, whenGettingSizeClassThenSmallSizesArePageGranularAndBiggerSizesAreRoundedUpToQuarterOfPowerOfTwo) {
+    EXPECT_EQ(MemoryConstants::pageSize, DrmBufferObjectCache::getSizeClass(0u));
+    EXPECT_EQ(MemoryConstants::pageSize, DrmBufferObjectCache::getSizeClass(1u));
+    EXPECT_EQ(3 * MemoryConstants::pageSize, DrmBufferObjectCache::getSizeClass(2 * MemoryConstants::pageSize + 1));
+    EXPECT_EQ(4 * MemoryConstants::pageSize, DrmBufferObjectCache::getSizeClass(4 * MemoryConstants::pageSize));
+    EXPECT_EQ(5 * MemoryConstants::pageSize, DrmBufferObjectCache::getSizeClass(4 * MemoryConstants::pageSize + 1));
+    EXPECT_EQ(MemoryConstants::megaByte, DrmBufferObjectCache::getSizeClass(MemoryConstants::megaByte));
+    EXPECT_EQ(MemoryConstants::megaByte + MemoryConstants::megaByte / 4, DrmBufferObjectCache::getSizeClass(MemoryConstants::megaByte + 1));
+    EXPECT_EQ(2 * MemoryConstants::megaByte, DrmBufferObjectCache::getSizeClass(2 * MemoryConstants::megaByte - 1));
+}
+
+TEST(DrmBufferObjectCacheTest, whenGettingSizeClassOfSizeClassThenSameSizeIsReturned) {
+    for (size_t size = 1u; size < 64 * MemoryConstants::megaByte; size = size * 3 / 2 + 1) {
+        auto sizeClass = DrmBufferObjectCache::getSizeClass(size);
+        EXPECT_LE(size, sizeClass);
+        EXPECT_EQ(sizeClass, DrmBufferObjectCache::getSizeClass(sizeClass));
+    }
+}
+
+TEST(DrmBufferObjectCacheTest, givenStoredEntryWhenTakingEntryOfSameSizeClassThenEntryIsReturnedAndHitIsCounted) {
+    DrmBufferObjectCache cache(MemoryConstants::megaByte);
+    std::vector<DrmBufferObjectCache::Entry> evictedEntries;
+    auto size = DrmBufferObjectCache::getSizeClass(100 * MemoryConstants::kiloByte);
+
+    EXPECT_TRUE(cache.store(createEntry(0x1000, 0x10000), size, evictedEntries));
+    EXPECT_TRUE(evictedEntries.empty());
+    EXPECT_EQ(size, cache.getCachedSize());
+    EXPECT_EQ(1u, cache.getCachedEntriesCount());
+
+    DrmBufferObjectCache::Entry entry;
+    EXPECT_FALSE(cache.take(200 * MemoryConstants::kiloByte, MemoryConstants::pageSize, alwaysCompleted, entry));
+    EXPECT_TRUE(cache.take(100 * MemoryConstants::kiloByte - 1, MemoryConstants::pageSize, alwaysCompleted, entry));
+    EXPECT_EQ(reinterpret_cast<BufferObject *>(0x1000), entry.bo);
+    EXPECT_EQ(reinterpret_cast<void *>(0x10000), entry.cpuPtr);
+
+    EXPECT_EQ(0u, cache.getCachedSize());
+    EXPECT_EQ(0u, cache.getCachedEntriesCount());
+    EXPECT_EQ(1u, cache.getHitsCount());
+    EXPECT_EQ(1u, cache.getMissesCount());
+    EXPECT_EQ(0u, cache.getEvictionsCount());
+}
+
+TEST(DrmBufferObjectCacheTest, givenEntriesNotCompletedOrMisalignedWhenTakingEntryThenMostRecentlyStoredMatchingEntryIsReturned) {
+    DrmBufferObjectCache cache(MemoryConstants::megaByte);
+    std::vector<DrmBufferObjectCache::Entry> evictedEntries;
+    auto size = MemoryConstants::pageSize64k;
+
+    EXPECT_TRUE(cache.store(createEntry(0x1000, 0x100000), size, evictedEntries));
+    EXPECT_TRUE(cache.store(createEntry(0x2000, 0x200000), size, evictedEntries));
+    EXPECT_TRUE(cache.store(createEntry(0x3000, 0x301000), size, evictedEntries));
+    auto pendingEntry = createEntry(0x4000, 0x400000);
+    pendingEntry.pendingTaskCounts.push_back({0u, 5u});
+    EXPECT_TRUE(cache.store(std::move(pendingEntry), size, evictedEntries));
+
+    auto isCompleted = [](const DrmBufferObjectCache::Entry &entry) { return entry.pendingTaskCounts.size() == 0u; };
+    DrmBufferObjectCache::Entry entry;
+    EXPECT_TRUE(cache.take(size, MemoryConstants::pageSize64k, isCompleted, entry));
+    EXPECT_EQ(reinterpret_cast<BufferObject *>(0x2000), entry.bo);
+    EXPECT_TRUE(cache.take(size, MemoryConstants::pageSize64k, isCompleted, entry));
+    EXPECT_EQ(reinterpret_cast<BufferObject *>(0x1000), entry.bo);
+    EXPECT_FALSE(cache.take(size, MemoryConstants::pageSize64k, isCompleted, entry));
+
+    EXPECT_TRUE(cache.take(size, MemoryConstants::pageSize, isCompleted, entry));
+    EXPECT_EQ(reinterpret_cast<BufferObject *>(0x3000), entry.bo);
+    EXPECT_TRUE(cache.take(size, MemoryConstants::pageSize, alwaysCompleted, entry));
+    EXPECT_EQ(reinterpret_cast<BufferObject *>(0x4000), entry.bo);
+    EXPECT_EQ(1u, entry.pendingTaskCounts.size());
+    EXPECT_EQ(0u, cache.getCachedEntriesCount());
+}
+
+TEST(DrmBufferObjectCacheTest, givenFullCacheWhenStoringEntryThenOldestEntriesOfBiggestSizeClassAreEvicted) {
+    DrmBufferObjectCache cache(4 * MemoryConstants::pageSize64k);
+    std::vector<DrmBufferObjectCache::Entry> evictedEntries;
+
+    EXPECT_TRUE(cache.store(createEntry(0x1000, 0x100000), 2 * MemoryConstants::pageSize64k, evictedEntries));
+    EXPECT_TRUE(cache.store(createEntry(0x2000, 0x200000), MemoryConstants::pageSize64k, evictedEntries));
+    EXPECT_TRUE(cache.store(createEntry(0x3000, 0x300000), MemoryConstants::pageSize64k, evictedEntries));
+    EXPECT_TRUE(evictedEntries.empty());
+
+    EXPECT_TRUE(cache.store(createEntry(0x4000, 0x400000), MemoryConstants::pageSize64k, evictedEntries));
+    ASSERT_EQ(1u, evictedEntries.size());
+    EXPECT_EQ(reinterpret_cast<BufferObject *>(0x1000), evictedEntries[0].bo);
+
+    EXPECT_TRUE(cache.store(createEntry(0x5000, 0x500000), 2 * MemoryConstants::pageSize64k, evictedEntries));
+    ASSERT_EQ(2u, evictedEntries.size());
+    EXPECT_EQ(reinterpret_cast<BufferObject *>(0x2000), evictedEntries[1].bo);
+
+    EXPECT_EQ(4 * MemoryConstants::pageSize64k, cache.getCachedSize());
+    EXPECT_EQ(3u, cache.getCachedEntriesCount());
+    EXPECT_EQ(2u, cache.getEvictionsCount());
+}
+
+TEST(DrmBufferObjectCacheTest, givenEntryBiggerThanCacheOrNotOfSizeClassWhenStoringThenEntryIsRejected) {
+    DrmBufferObjectCache cache(MemoryConstants::megaByte);
+    std::vector<DrmBufferObjectCache::Entry> evictedEntries;
+
+    EXPECT_FALSE(cache.store(createEntry(0x1000, 0x100000), 2 * MemoryConstants::megaByte, evictedEntries));
+    EXPECT_FALSE(cache.store(createEntry(0x1000, 0x100000), MemoryConstants::pageSize64k + MemoryConstants::pageSize, evictedEntries));
+    EXPECT_TRUE(evictedEntries.empty());
+    EXPECT_EQ(0u, cache.getCachedEntriesCount());
+}
+
+TEST(DrmBufferObjectCacheTest, givenCachedEntriesWhenTrimmingToZeroThenAllEntriesAreEvicted) {
+    DrmBufferObjectCache cache(MemoryConstants::megaByte);
+    std::vector<DrmBufferObjectCache::Entry> evictedEntries;
+
+    EXPECT_TRUE(cache.store(createEntry(0x1000, 0x100000), MemoryConstants::pageSize, evictedEntries));
+    EXPECT_TRUE(cache.store(createEntry(0x2000, 0x200000), MemoryConstants::pageSize64k, evictedEntries));
+
+    cache.trim(0u, evictedEntries);
+    EXPECT_EQ(2u, evictedEntries.size());
+    EXPECT_EQ(0u, cache.getCachedSize());
+    EXPECT_EQ(0u, cache.getCachedEntriesCount());
+}
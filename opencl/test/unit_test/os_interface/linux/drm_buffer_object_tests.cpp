@@ -78,6 +78,43 @@ TEST_F(DrmBufferObjectTest, exec_ioctlFailed) {
     EXPECT_EQ(EFAULT, bo->exec(0, 0, 0, false, 1, nullptr, 0u, &execObjectsStorage));
 }
 
+TEST_F(DrmBufferObjectTest, givenExecObjectsFilledForSameBufferObjectsWhenFillingExecObjectsThenOnlyChangedEntriesAreFilled) {
+    mock->ioctl_expected.total = 0;
+    auto otherBo = std::make_unique<TestedBufferObject>(this->mock.get());
+    BufferObject *residency[] = {bo, otherBo.get()};
+    const BufferObject *execObjectsOwners[2] = {};
+    drm_i915_gem_exec_object2 execObjects[2] = {};
+
+    BufferObject::fillExecObjects(residency, 2u, execObjectsOwners, execObjects, 1u);
+    EXPECT_EQ(&execObjects[0], bo->execObjectPointerFilled);
+    EXPECT_EQ(&execObjects[1], otherBo->execObjectPointerFilled);
+    EXPECT_EQ(bo, execObjectsOwners[0]);
+    EXPECT_EQ(otherBo.get(), execObjectsOwners[1]);
+
+    bo->execObjectPointerFilled = nullptr;
+    otherBo->execObjectPointerFilled = nullptr;
+    BufferObject::fillExecObjects(residency, 2u, execObjectsOwners, execObjects, 1u);
+    EXPECT_EQ(nullptr, bo->execObjectPointerFilled);
+    EXPECT_EQ(nullptr, otherBo->execObjectPointerFilled);
+
+    otherBo->setAddress(0x10000);
+    BufferObject::fillExecObjects(residency, 2u, execObjectsOwners, execObjects, 1u);
+    EXPECT_EQ(nullptr, bo->execObjectPointerFilled);
+    EXPECT_EQ(&execObjects[1], otherBo->execObjectPointerFilled);
+    EXPECT_EQ(0x10000u, execObjects[1].offset);
+
+    bo->execObjectPointerFilled = nullptr;
+    BufferObject::fillExecObjects(residency, 2u, execObjectsOwners, execObjects, 2u);
+    EXPECT_EQ(&execObjects[0], bo->execObjectPointerFilled);
+    EXPECT_EQ(2u, execObjects[0].rsvd1);
+
+    std::swap(residency[0], residency[1]);
+    BufferObject::fillExecObjects(residency, 2u, execObjectsOwners, execObjects, 2u);
+    EXPECT_EQ(otherBo.get(), execObjectsOwners[0]);
+    EXPECT_EQ(bo, execObjectsOwners[1]);
+    EXPECT_EQ(0x10000u, execObjects[0].offset);
+}
+
 TEST_F(DrmBufferObjectTest, setTiling_success) {
     mock->ioctl_expected.total = 1; //set_tiling
     auto ret = bo->setTiling(I915_TILING_X, 0);
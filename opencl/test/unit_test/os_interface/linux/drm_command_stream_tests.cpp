@@ -558,6 +558,105 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenTaskThatRequiresLargeResou
     EXPECT_EQ(11u, execStorage.size());
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenSameResidencyWhenFlushedAgainThenExecObjectsOfResidencyAreNotFilledAgain) {
+    auto &execStorage = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr)->getExecStorage();
+    auto allocation1 = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    auto allocation2 = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    csr->makeResident(*allocation1);
+    csr->makeResident(*allocation2);
+
+    auto &cs = csr->getCS();
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr};
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(3u, this->mock->execBuffer.buffer_count);
+    EXPECT_EQ(static_cast<uint32_t>(allocation1->getBO()->peekHandle()), execStorage[0].handle);
+    EXPECT_EQ(static_cast<uint32_t>(allocation2->getBO()->peekHandle()), execStorage[1].handle);
+
+    // field not written by BufferObject::fillExecObject marks exec objects of previous submission
+    execStorage[0].rsvd2 = 0x1234;
+    execStorage[1].rsvd2 = 0x5678;
+    // exec object content is not compared when residency is unchanged
+    execStorage[1].offset = 0u;
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(3u, this->mock->execBuffer.buffer_count);
+    EXPECT_EQ(0x1234u, execStorage[0].rsvd2);
+    EXPECT_EQ(static_cast<uint32_t>(allocation1->getBO()->peekHandle()), execStorage[0].handle);
+    EXPECT_EQ(0x5678u, execStorage[1].rsvd2);
+    EXPECT_EQ(0u, execStorage[1].offset);
+    EXPECT_EQ(static_cast<uint32_t>(static_cast<DrmAllocation *>(cs.getGraphicsAllocation())->getBO()->peekHandle()), execStorage[2].handle);
+
+    csr->makeSurfacePackNonResident(csr->getResidencyAllocations());
+    mm->freeGraphicsMemory(allocation1);
+    mm->freeGraphicsMemory(allocation2);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenSameResidencyWhenBufferObjectWasDestroyedBeforeFlushThenExecObjectsOfResidencyAreVerified) {
+    auto &execStorage = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr)->getExecStorage();
+    auto allocation1 = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    auto allocation2 = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    csr->makeResident(*allocation1);
+    csr->makeResident(*allocation2);
+
+    auto &cs = csr->getCS();
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr};
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+
+    execStorage[0].rsvd2 = 0x1234;
+    execStorage[1].offset = 0u;
+    // another BO may be created at the address of destroyed one
+    auto destroyedBo = std::make_unique<BufferObject>(this->mock, 1, 0u);
+    destroyedBo.reset();
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(3u, this->mock->execBuffer.buffer_count);
+    EXPECT_EQ(0x1234u, execStorage[0].rsvd2);
+    EXPECT_EQ(allocation2->getBO()->peekAddress(), execStorage[1].offset);
+
+    csr->makeSurfacePackNonResident(csr->getResidencyAllocations());
+    mm->freeGraphicsMemory(allocation1);
+    mm->freeGraphicsMemory(allocation2);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenChangedResidencyWhenFlushedThenExecObjectsOfChangedEntriesAreFilled) {
+    auto &execStorage = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr)->getExecStorage();
+    auto allocation1 = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    auto allocation2 = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    auto allocation3 = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+
+    auto &cs = csr->getCS();
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr};
+
+    csr->makeResident(*allocation1);
+    csr->makeResident(*allocation2);
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    csr->makeSurfacePackNonResident(csr->getResidencyAllocations());
+
+    csr->makeResident(*allocation1);
+    csr->makeResident(*allocation3);
+    csr->makeResident(*allocation2);
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+
+    EXPECT_EQ(4u, this->mock->execBuffer.buffer_count);
+    EXPECT_EQ(static_cast<uint32_t>(allocation1->getBO()->peekHandle()), execStorage[0].handle);
+    EXPECT_EQ(static_cast<uint32_t>(allocation3->getBO()->peekHandle()), execStorage[1].handle);
+    EXPECT_EQ(allocation3->getBO()->peekAddress(), execStorage[1].offset);
+    EXPECT_EQ(static_cast<uint32_t>(allocation2->getBO()->peekHandle()), execStorage[2].handle);
+    EXPECT_EQ(allocation2->getBO()->peekAddress(), execStorage[2].offset);
+    EXPECT_EQ(static_cast<uint32_t>(static_cast<DrmAllocation *>(cs.getGraphicsAllocation())->getBO()->peekHandle()), execStorage[3].handle);
+
+    csr->makeSurfacePackNonResident(csr->getResidencyAllocations());
+    mm->freeGraphicsMemory(allocation1);
+    mm->freeGraphicsMemory(allocation2);
+    mm->freeGraphicsMemory(allocation3);
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenGemCloseWorkerInactiveModeWhenMakeResidentIsCalledThenRefCountsAreNotUpdated) {
     auto dummyAllocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
 
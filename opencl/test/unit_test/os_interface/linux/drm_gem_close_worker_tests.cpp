@@ -36,6 +36,7 @@ class DrmMockForWorker : public Drm {
     std::mutex mutex;
     std::atomic<int> gem_close_cnt;
     std::atomic<int> gem_close_expected;
+    std::atomic<int> gem_wait_cnt{0};
     std::atomic<std::thread::id> ioctl_caller_thread_id;
     DrmMockForWorker() : Drm(std::make_unique<HwDeviceId>(33), *platform()->peekExecutionEnvironment()->rootDeviceEnvironments[0]) {
     }
@@ -47,6 +48,8 @@ class DrmMockForWorker : public Drm {
         }
         if (request == DRM_IOCTL_GEM_CLOSE)
             gem_close_cnt++;
+        if (request == DRM_IOCTL_I915_GEM_WAIT)
+            gem_wait_cnt++;
 
         ioctl_caller_thread_id = std::this_thread::get_id();
 
@@ -189,3 +192,56 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+TEST_F(DrmGemCloseWorkerTests, givenManyBufferObjectsPushedWhenWorkerIsClosedThenAllAreClosedAndStatisticsAreUpdated) {
+    constexpr int numBufferObjects = 100;
+    this->drmMock->gem_close_expected = numBufferObjects;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    for (int i = 0; i < numBufferObjects; i++) {
+        worker->push(new BufferObject(this->drmMock, i + 1, 0));
+    }
+    worker->close(true);
+
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(0u, worker->getQueueDepth());
+
+    auto &statistics = worker->getStatistics();
+    EXPECT_EQ(static_cast<uint64_t>(numBufferObjects), statistics.closedBufferObjects.load());
+    EXPECT_LE(1u, statistics.processedBatches.load());
+    EXPECT_GE(static_cast<uint64_t>(numBufferObjects), statistics.processedBatches.load());
+    EXPECT_LE(1u, statistics.maxQueueDepth.load());
+    EXPECT_GE(statistics.totalCloseLatencyNs.load(), statistics.maxCloseLatencyNs.load());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBufferObjectPushedMultipleTimesWhenBatchIsClosedThenItIsWaitedOnceAndClosedAfterLastReference) {
+    struct MockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::closeBatch;
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+        using DrmGemCloseWorker::takeAll;
+    };
+    this->drmMock->gem_close_expected = 2;
+
+    auto worker = std::make_unique<MockDrmGemCloseWorker>(*mm);
+    worker->close(true);
+
+    auto sharedBo = new BufferObject(this->drmMock, 1, 0);
+    auto otherBo = new BufferObject(this->drmMock, 2, 0);
+    sharedBo->reference();
+    sharedBo->reference();
+    worker->push(sharedBo);
+    worker->push(otherBo);
+    worker->push(sharedBo);
+    worker->push(sharedBo);
+    EXPECT_EQ(4u, worker->getQueueDepth());
+    EXPECT_EQ(4u, worker->getStatistics().maxQueueDepth.load());
+
+    worker->closeBatch(worker->takeAll());
+
+    EXPECT_EQ(2, this->drmMock->gem_wait_cnt.load());
+    EXPECT_EQ(2, this->drmMock->gem_close_cnt.load());
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(1u, worker->getStatistics().processedBatches.load());
+    EXPECT_EQ(4u, worker->getStatistics().closedBufferObjects.load());
+    EXPECT_EQ(nullptr, worker->takeAll());
+}
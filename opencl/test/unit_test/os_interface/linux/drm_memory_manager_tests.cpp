@@ -3395,6 +3395,141 @@ TEST(DrmMemoryManagerFreeGraphicsMemoryUnreferenceTest, givenDrmMemoryManagerAnd
     gmockDrmMemoryManager.freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryManagerTest, givenBufferObjectCacheDisabledWhenMemoryManagerIsCreatedThenCacheIsNotCreated) {
+    EXPECT_EQ(nullptr, memoryManager->getBufferObjectCache(0u));
+    EXPECT_FALSE(memoryManager->trimBufferObjectCache(0u));
+}
+
+TEST_F(DrmMemoryManagerTest, givenBufferObjectCacheEnabledWhenAllocationIsFreedAndAllocatedAgainThenBufferObjectIsReused) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBufferObjectCache.set(true);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 0;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+    auto bufferObjectCache = memoryManager->getBufferObjectCache(0u);
+    ASSERT_NE(nullptr, bufferObjectCache);
+    EXPECT_EQ(128 * MemoryConstants::megaByte, bufferObjectCache->getMaxSize());
+
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::megaByte + 1}));
+    ASSERT_NE(nullptr, allocation);
+    auto bo = allocation->getBO();
+    auto cpuPtr = allocation->getUnderlyingBuffer();
+    EXPECT_EQ(DrmBufferObjectCache::getSizeClass(MemoryConstants::megaByte + 1), bo->peekSize());
+    EXPECT_EQ(alignUp(MemoryConstants::megaByte + 1, MemoryConstants::pageSize), allocation->getUnderlyingBufferSize());
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, bufferObjectCache->getCachedEntriesCount());
+
+    allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::megaByte + MemoryConstants::megaByte / 8}));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(bo, allocation->getBO());
+    EXPECT_EQ(cpuPtr, allocation->getUnderlyingBuffer());
+    EXPECT_EQ(MemoryConstants::megaByte + MemoryConstants::megaByte / 8, allocation->getUnderlyingBufferSize());
+    EXPECT_EQ(0u, bufferObjectCache->getCachedEntriesCount());
+    EXPECT_EQ(1u, bufferObjectCache->getHitsCount());
+    EXPECT_EQ(1u, bufferObjectCache->getMissesCount());
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenCachedBufferObjectWithPendingTaskCountWhenAllocatingThenBufferObjectIsReusedOnlyAfterTaskCountCompletes) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBufferObjectCache.set(true);
+    mock->ioctl_expected.gemUserptr = 2;
+    mock->ioctl_expected.gemWait = 0;
+    mock->ioctl_expected.gemClose = 2;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+    memoryManager->registeredEngines = EngineControlContainer{this->device->engines};
+    for (auto engine : memoryManager->registeredEngines) {
+        engine.osContext->incRefInternal();
+    }
+    auto &engine = this->device->getDefaultEngine();
+    auto tagAddress = engine.commandStreamReceiver->getTagAddress();
+    *tagAddress = 5u;
+
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    ASSERT_NE(nullptr, allocation);
+    auto bo = allocation->getBO();
+    allocation->updateTaskCount(10u, engine.osContext->getContextId());
+    memoryManager->freeGraphicsMemory(allocation);
+
+    auto secondAllocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    ASSERT_NE(nullptr, secondAllocation);
+    EXPECT_NE(bo, secondAllocation->getBO());
+
+    *tagAddress = 10u;
+    auto thirdAllocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    ASSERT_NE(nullptr, thirdAllocation);
+    EXPECT_EQ(bo, thirdAllocation->getBO());
+
+    memoryManager->freeGraphicsMemory(secondAllocation);
+    memoryManager->freeGraphicsMemory(thirdAllocation);
+    EXPECT_EQ(2u, memoryManager->getBufferObjectCache(0u)->getCachedEntriesCount());
+}
+
+TEST_F(DrmMemoryManagerTest, givenCachedBufferObjectWhenUserptrIoctlFailsThenCacheIsTrimmedAndAllocationIsRetried) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBufferObjectCache.set(true);
+    mock->ioctl_expected.gemUserptr = 3;
+    mock->ioctl_expected.gemWait = 0;
+    mock->ioctl_expected.gemClose = 2;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+    auto bufferObjectCache = memoryManager->getBufferObjectCache(0u);
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, allocation);
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, bufferObjectCache->getCachedEntriesCount());
+
+    DrmMockCustom::IoctlResExt ioctlResExt = {mock->ioctl_cnt.total.load(), -1};
+    mock->ioctl_res_ext = &ioctlResExt;
+    allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize64k});
+    mock->ioctl_res_ext = &mock->NONE;
+    ASSERT_NE(nullptr, allocation);
+
+    EXPECT_EQ(0u, bufferObjectCache->getCachedEntriesCount());
+    EXPECT_EQ(1u, bufferObjectCache->getEvictionsCount());
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenBufferObjectCacheEnabledWhenInternalHandleOfAllocationIsExportedThenBufferObjectIsNotCached) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBufferObjectCache.set(true);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+    mock->ioctl_expected.handleToPrimeFd = 1;
+    mock->outputFd = 1337;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(1337u, allocation->peekInternalHandle(memoryManager.get()));
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(0u, memoryManager->getBufferObjectCache(0u)->getCachedEntriesCount());
+}
+
+TEST_F(DrmMemoryManagerTest, givenBufferObjectCacheMaxSizeSetWhenAllocationBiggerThanCacheIsFreedThenBufferObjectIsReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBufferObjectCache.set(true);
+    DebugManager.flags.BufferObjectCacheMaxSize.set(1);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, false, false, *executionEnvironment);
+    EXPECT_EQ(MemoryConstants::megaByte, memoryManager->getBufferObjectCache(0u)->getMaxSize());
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{2 * MemoryConstants::megaByte});
+    ASSERT_NE(nullptr, allocation);
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(0u, memoryManager->getBufferObjectCache(0u)->getCachedEntriesCount());
+}
+
 TEST(DrmMemoryMangerTest, givenMultipleRootDeviceWhenMemoryManagerGetsDrmThenDrmIsFromCorrectRootDevice) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.CreateMultipleRootDevices.set(4);
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/built_ins/built_ins.h"
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/helpers/hash.h"
+
+#include "opencl/source/built_ins/builtins_dispatch_builder.h"
+#include "opencl/source/program/program.h"
+#include "opencl/test/unit_test/fixtures/built_in_fixture.h"
+#include "opencl/test/unit_test/fixtures/device_fixture.h"
+
+#include "perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+
+using namespace NEO;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+// ratio results that are not checked be EXPECT ( very short time tests are not chceked due to high fluctuations )
+const double ratioThreshold = 0.005;
+
+class BuiltInsPerfTest : public DeviceFixture,
+                         public BuiltInFixture,
+                         public ::testing::Test {
+  public:
+    using BuiltInFixture::SetUp;
+    using DeviceFixture::SetUp;
+
+    void SetUp() override {
+        DeviceFixture::SetUp();
+        BuiltInFixture::SetUp(pDevice);
+    }
+
+    void TearDown() override {
+        BuiltInFixture::TearDown();
+        DeviceFixture::TearDown();
+    }
+};
+
+//------------------------------------------------------------------------------
+// first use of built-in operation ( startup latency of first clEnqueueCopyBuffer )
+//------------------------------------------------------------------------------
+
+TEST_F(BuiltInsPerfTest, givenFreshBuiltInsWhenCopyBufferToBufferBuilderIsUsedFirstTimeThenItIsNotSlowerThanReference) {
+    setReferenceTime();
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(__FUNCTION__, strlen(__FUNCTION__));
+
+    bool success = getTestRatio(hash, previousRatio);
+    long long times[3] = {0, 0, 0};
+    size_t loadedKernels = 0;
+
+    for (int i = 0; i < 3; i++) {
+        // fresh built-ins library, so that builder and its program are created again
+        pDevice->getExecutionEnvironment()->builtins.reset(new BuiltIns);
+        pDevice->getExecutionEnvironment()->builtins->setCacheingEnableState(false);
+
+        Timer t;
+        t.start();
+        auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pDevice);
+        t.end();
+
+        times[i] = t.get();
+        ASSERT_FALSE(builder.peekUsedKernels().empty());
+        loadedKernels = builder.peekUsedKernels()[0]->getProgram()->getNumKernels();
+    }
+
+    long long time = majorityVote(times[0], times[1], times[2]);
+    double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+
+    std::cout << "CopyBufferToBuffer built-in first use: " << time << " ns, kernels loaded: " << loadedKernels << std::endl;
+
+    if (success && previousRatio > ratioThreshold) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, multiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+
+    updateTestRatio(hash, ratio);
+}
+} // namespace ULT
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/memory_manager/memory_constants.h"
+#include "shared/source/os_interface/linux/drm_buffer_object.h"
+#include "shared/source/os_interface/linux/drm_null_device.h"
+#include "shared/source/os_interface/linux/hw_device_id.h"
+
+#include "perf_test_utils.h"
+
+#include "drm/i915_drm.h"
+
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace NEO;
+
+namespace ULT {
+
+// number of buffer objects resident in every submission
+const size_t numResidentBos = 300;
+const size_t submissionsCount = 10000;
+
+struct DrmExecFixture {
+    DrmExecFixture() {
+        executionEnvironment.prepareRootDeviceEnvironments(1);
+        drm = std::make_unique<DrmNullDevice>(std::make_unique<HwDeviceId>(-1), *executionEnvironment.rootDeviceEnvironments[0]);
+        for (size_t i = 0; i < numResidentBos; i++) {
+            bufferObjects.emplace_back(new BufferObject(drm.get(), static_cast<int>(i + 1), MemoryConstants::pageSize, 0u));
+            bufferObjects.back()->setAddress((i + 1) * MemoryConstants::pageSize64k);
+            residency.push_back(bufferObjects.back().get());
+        }
+        commandBuffer = std::make_unique<BufferObject>(drm.get(), static_cast<int>(numResidentBos + 1), MemoryConstants::pageSize, 0u);
+        execObjectsStorage.resize(numResidentBos + 1);
+        execObjectsOwners.resize(numResidentBos + 1, nullptr);
+    }
+
+    ExecutionEnvironment executionEnvironment;
+    std::unique_ptr<DrmNullDevice> drm;
+    std::vector<std::unique_ptr<BufferObject>> bufferObjects;
+    std::unique_ptr<BufferObject> commandBuffer;
+    std::vector<BufferObject *> residency;
+    std::vector<drm_i915_gem_exec_object2> execObjectsStorage;
+    std::vector<const BufferObject *> execObjectsOwners;
+};
+
+template <typename SubmitT>
+long long measureSubmissions(SubmitT submit) {
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        Timer t;
+        t.start();
+        for (size_t submission = 0; submission < submissionsCount; submission++) {
+            EXPECT_EQ(0, submit());
+        }
+        t.end();
+        times[i] = t.get();
+    }
+    return majorityVote(times[0], times[1], times[2]);
+}
+
+TEST(DrmExecPerfTest, givenUnchangedResidencyWhenSubmittingThenReusingExecObjectsIsFasterThanRebuildingThem) {
+    setReferenceTime();
+    DrmExecFixture fixture;
+
+    auto rebuildTime = measureSubmissions([&]() {
+        return fixture.commandBuffer->exec(64u, 0u, I915_EXEC_NO_RELOC, false, 1u,
+                                           fixture.residency.data(), fixture.residency.size(), fixture.execObjectsStorage.data());
+    });
+    auto reuseTime = measureSubmissions([&]() {
+        BufferObject::fillExecObjects(fixture.residency.data(), fixture.residency.size(), fixture.execObjectsOwners.data(), fixture.execObjectsStorage.data(), 1u);
+        return fixture.commandBuffer->exec(64u, 0u, I915_EXEC_NO_RELOC, false, 1u,
+                                           fixture.residency.size(), fixture.execObjectsStorage.data());
+    });
+
+    std::cout << "Submission with " << numResidentBos << " resident buffer objects: "
+              << static_cast<double>(rebuildTime) / submissionsCount << " ns (exec objects rebuilt), "
+              << static_cast<double>(reuseTime) / submissionsCount << " ns (exec objects reused)" << std::endl;
+
+    EXPECT_LE(reuseTime, rebuildTime);
+
+    uint64_t hash = Hash::hash(__FUNCTION__, strlen(__FUNCTION__));
+    updateTestRatio(hash, static_cast<double>(reuseTime) / static_cast<double>(refTime));
+}
+
+} // namespace ULT
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hash128.h"
+#include "shared/source/memory_manager/memory_constants.h"
+
+#include "perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace NEO;
+
+namespace ULT {
+
+// size of input hashed in every iteration, corresponds to a large SPIR-V module
+const size_t hashInputSize = 16 * MemoryConstants::megaByte;
+
+template <typename HashFunc>
+long long measureHashTime(const std::vector<char> &input, HashFunc &&hashFunc) {
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        Timer t;
+        t.start();
+        hashFunc(input.data(), input.size());
+        t.end();
+        times[i] = t.get();
+    }
+    return majorityVote(times[0], times[1], times[2]);
+}
+
+TEST(HashPerfTest, givenLargeInputWhenHashingWithHash128ThenItIsFasterThanHash) {
+    setReferenceTime();
+    std::vector<char> input(hashInputSize);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<char>(i * 31 + (i >> 8));
+    }
+
+    volatile uint64_t sink = 0;
+    auto hashTime = measureHashTime(input, [&](const char *data, size_t size) {
+        sink = Hash::hash(data, size);
+    });
+    auto hash128Time = measureHashTime(input, [&](const char *data, size_t size) {
+        sink = Hash128::hash(data, size).low;
+    });
+
+    std::cout << "Hash: " << hashTime << " ns, Hash128: " << hash128Time << " ns for " << hashInputSize << " bytes" << std::endl;
+
+    EXPECT_LT(hash128Time, hashTime);
+
+    uint64_t hash = Hash::hash(__FUNCTION__, strlen(__FUNCTION__));
+    updateTestRatio(hash, static_cast<double>(hash128Time) / static_cast<double>(refTime));
+}
+
+} // namespace ULT
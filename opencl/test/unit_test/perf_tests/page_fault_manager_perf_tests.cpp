@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/memory_constants.h"
+#include "shared/test/unit_test/page_fault_manager/mock_cpu_page_fault_manager.h"
+
+#include "perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+
+using namespace NEO;
+
+namespace ULT {
+
+// number of faults resolved in a single measurement
+const size_t faultsPerMeasurement = 10000;
+
+long long measurePageFaultTime(size_t numAllocs) {
+    MockPageFaultManager pageFaultManager;
+    for (size_t i = 0; i < numAllocs; i++) {
+        auto alloc = reinterpret_cast<void *>((i + 1) * 2 * MemoryConstants::pageSize64k);
+        pageFaultManager.insertAllocation(alloc, MemoryConstants::pageSize64k, nullptr, nullptr);
+    }
+
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        Timer t;
+        t.start();
+        for (size_t fault = 0; fault < faultsPerMeasurement; fault++) {
+            auto allocIndex = (fault * 7919) % numAllocs;
+            auto alloc = reinterpret_cast<void *>((allocIndex + 1) * 2 * MemoryConstants::pageSize64k);
+            pageFaultManager.verifyPageFault(ptrOffset(alloc, MemoryConstants::pageSize));
+        }
+        t.end();
+        times[i] = t.get();
+    }
+    return majorityVote(times[0], times[1], times[2]);
+}
+
+TEST(PageFaultManagerPerfTest, givenGrowingNumberOfAllocationsWhenResolvingPageFaultsThenLatencyGrowsSublinearly) {
+    setReferenceTime();
+    long long faultTimes[] = {measurePageFaultTime(16), measurePageFaultTime(1024), measurePageFaultTime(16384)};
+
+    std::cout << "Page fault latency: "
+              << faultTimes[0] / faultsPerMeasurement << " ns (16 allocs), "
+              << faultTimes[1] / faultsPerMeasurement << " ns (1024 allocs), "
+              << faultTimes[2] / faultsPerMeasurement << " ns (16384 allocs)" << std::endl;
+
+    // 1024 times more allocations must not result in proportionally slower lookup
+    EXPECT_LT(faultTimes[2], faultTimes[0] * 64);
+
+    uint64_t hash = Hash::hash(__FUNCTION__, strlen(__FUNCTION__));
+    updateTestRatio(hash, static_cast<double>(faultTimes[2]) / static_cast<double>(refTime));
+}
+
+} // namespace ULT
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/hash.h"
+
+#include "opencl/source/memory_manager/memory_banks.h"
+#include "opencl/source/memory_manager/page_table.h"
+
+#include "perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+
+using namespace NEO;
+
+namespace ULT {
+
+struct PageTableMeasurement {
+    long long mapTime = 0;
+    long long walkTime = 0;
+    size_t walkerCalls = 0;
+};
+
+PageTableMeasurement measurePageTable(size_t size) {
+    PageTableMeasurement measurement;
+    PhysicalAddressAllocator allocator;
+    PML4 pageTable(&allocator);
+    uintptr_t gpuAddress = static_cast<uintptr_t>(64 * GB);
+
+    Timer t;
+    t.start();
+    pageTable.map(gpuAddress, size, 0, MemoryBanks::MainBank);
+    t.end();
+    measurement.mapTime = t.get();
+
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        measurement.walkerCalls++;
+    };
+    t.start();
+    pageTable.pageWalk(gpuAddress, size, 0, 0, walker, MemoryBanks::MainBank);
+    t.end();
+    measurement.walkTime = t.get();
+    return measurement;
+}
+
+TEST(PageTablePerfTest, givenMultiGigabyteRangeWhenMappedAndWalkedThenTimeGrowsLinearlyAndWalkerIsCalledOnce) {
+    setReferenceTime();
+    if (sizeof(void *) != 8) {
+        GTEST_SKIP();
+    }
+    auto small = measurePageTable(static_cast<size_t>(1 * GB));
+    auto large = measurePageTable(static_cast<size_t>(4 * GB));
+
+    std::cout << "Page table map: " << small.mapTime << " ns (1GB), " << large.mapTime << " ns (4GB); "
+              << "page walk: " << small.walkTime << " ns (1GB), " << large.walkTime << " ns (4GB)" << std::endl;
+
+    // freshly mapped range is contiguous in physical memory
+    EXPECT_EQ(1u, small.walkerCalls);
+    EXPECT_EQ(1u, large.walkerCalls);
+    EXPECT_LT(large.mapTime, small.mapTime * 8);
+
+    uint64_t hash = Hash::hash(__FUNCTION__, strlen(__FUNCTION__));
+    updateTestRatio(hash, static_cast<double>(large.mapTime + large.walkTime) / static_cast<double>(refTime));
+}
+
+} // namespace ULT
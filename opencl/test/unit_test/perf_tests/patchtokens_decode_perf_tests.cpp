@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/device_binary_format/patchtokens_decoder.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/program/program_info.h"
+#include "shared/test/unit_test/device_binary_format/patchtokens_tests.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+
+const uint32_t numKernels = 1000;
+const uint32_t numArgsPerKernel = 8;
+
+template <typename TokenT>
+void pushBackToken(const TokenT &token, std::vector<uint8_t> &storage) {
+    storage.insert(storage.end(), reinterpret_cast<const uint8_t *>(&token), reinterpret_cast<const uint8_t *>(&token + 1));
+}
+
+// program with numKernels kernels, each having ISA, execution environment and numArgsPerKernel stateless buffer arguments
+std::vector<uint8_t> createProgramWithManyKernels() {
+    std::vector<uint8_t> storage;
+    iOpenCL::SProgramBinaryHeader programHeader = {};
+    programHeader.Magic = iOpenCL::MAGIC_CL;
+    programHeader.Version = iOpenCL::CURRENT_ICBE_VERSION;
+    programHeader.GPUPointerSizeInBytes = sizeof(uintptr_t);
+    programHeader.NumberOfKernels = numKernels;
+    pushBackToken(programHeader, storage);
+
+    for (uint32_t kernelNum = 0; kernelNum < numKernels; kernelNum++) {
+        std::vector<uint8_t> patchList;
+        auto executionEnvironment = PatchTokensTestData::initToken<iOpenCL::SPatchExecutionEnvironment>(iOpenCL::PATCH_TOKEN_EXECUTION_ENVIRONMENT);
+        executionEnvironment.LargestCompiledSIMDSize = 16U;
+        executionEnvironment.CompiledSIMD16 = 1U;
+        pushBackToken(executionEnvironment, patchList);
+        for (uint32_t argNum = 0; argNum < numArgsPerKernel; argNum++) {
+            auto bufferArg = PatchTokensTestData::initToken<iOpenCL::SPatchStatelessGlobalMemoryObjectKernelArgument>(iOpenCL::PATCH_TOKEN_STATELESS_GLOBAL_MEMORY_OBJECT_KERNEL_ARGUMENT);
+            bufferArg.ArgumentNumber = argNum;
+            bufferArg.DataParamOffset = argNum * sizeof(uint64_t);
+            bufferArg.DataParamSize = sizeof(uint64_t);
+            pushBackToken(bufferArg, patchList);
+            pushBackToken(PatchTokensTestData::initDataParameterBufferToken(iOpenCL::DATA_PARAMETER_BUFFER_OFFSET, 0, argNum), patchList);
+        }
+        for (uint32_t dim = 0; dim < 3; dim++) {
+            pushBackToken(PatchTokensTestData::initDataParameterBufferToken(iOpenCL::DATA_PARAMETER_LOCAL_WORK_SIZE, dim), patchList);
+            pushBackToken(PatchTokensTestData::initDataParameterBufferToken(iOpenCL::DATA_PARAMETER_GLOBAL_WORK_OFFSET, dim), patchList);
+        }
+
+        std::string kernelName = "kernel_" + std::to_string(kernelNum);
+        std::vector<uint8_t> isa(1024, static_cast<uint8_t>(kernelNum));
+
+        iOpenCL::SKernelBinaryHeaderCommon kernelHeader = {};
+        kernelHeader.KernelNameSize = static_cast<uint32_t>(kernelName.size());
+        kernelHeader.KernelHeapSize = static_cast<uint32_t>(isa.size());
+        kernelHeader.PatchListSize = static_cast<uint32_t>(patchList.size());
+
+        auto kernelOffset = storage.size();
+        pushBackToken(kernelHeader, storage);
+        storage.insert(storage.end(), kernelName.begin(), kernelName.end());
+        storage.insert(storage.end(), isa.begin(), isa.end());
+        storage.insert(storage.end(), patchList.begin(), patchList.end());
+
+        auto kernelBlob = ArrayRef<const uint8_t>(storage.data() + kernelOffset, storage.size() - kernelOffset);
+        reinterpret_cast<iOpenCL::SKernelBinaryHeaderCommon *>(storage.data() + kernelOffset)->CheckSum = PatchTokenBinary::calcKernelChecksum(kernelBlob);
+    }
+    return storage;
+}
+
+long long measureDecode(const std::vector<uint8_t> &binary) {
+    SingleDeviceBinary deviceBinary = {};
+    deviceBinary.format = DeviceBinaryFormat::Patchtokens;
+    deviceBinary.deviceBinary = ArrayRef<const uint8_t>(binary.data(), binary.size());
+
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        ProgramInfo programInfo;
+        std::string errors, warnings;
+
+        Timer t;
+        t.start();
+        auto decodeError = decodeSingleDeviceBinary<DeviceBinaryFormat::Patchtokens>(programInfo, deviceBinary, errors, warnings);
+        t.end();
+
+        EXPECT_EQ(DecodeError::Success, decodeError) << errors;
+        EXPECT_EQ(numKernels, programInfo.kernelInfos.size());
+        times[i] = t.get();
+    }
+    return majorityVote(times[0], times[1], times[2]);
+}
+
+TEST(PatchtokensDecodePerfTest, givenProgramWithThousandKernelsWhenDecodingThenParallelDecodeIsNotSlowerThanSerialDecode) {
+    setReferenceTime();
+    DebugManagerStateRestore restore;
+    auto binary = createProgramWithManyKernels();
+
+    DebugManager.flags.PatchtokensDecodeWorkersCount.set(1);
+    auto serialTime = measureDecode(binary);
+
+    DebugManager.flags.PatchtokensDecodeWorkersCount.set(-1);
+    auto parallelTime = measureDecode(binary);
+
+    std::cout << "Decoding program with " << numKernels << " kernels: "
+              << serialTime << " ns (1 worker), "
+              << parallelTime << " ns (" << PatchTokenBinary::getKernelsDecodeWorkersCount(numKernels) << " workers)" << std::endl;
+
+    EXPECT_LE(parallelTime, serialTime * multiplier);
+
+    uint64_t hash = Hash::hash(__FUNCTION__, strlen(__FUNCTION__));
+    updateTestRatio(hash, static_cast<double>(parallelTime) / static_cast<double>(refTime));
+}
+
+} // namespace ULT
@@ -9,8 +9,7 @@
 
 #include "shared/source/helpers/aligned_memory.h"
 
-#include "opencl/source/helpers/hash.h"
-
+#include <cstring>
 #include <fstream>
 #include <string>
 
@@ -0,0 +1,16 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "test_mode.h"
+
+namespace NEO {
+// max time per single test iteration
+unsigned int ultIterationMaxTime = 180;
+bool useMockGmm = true;
+const char *executionDirectorySuffix = "";
+TestMode testMode = defaultTestMode;
+} // namespace NEO
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/pitched_copy.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace NEO;
+
+namespace ULT {
+
+// multiplier of reference ratio that is compared ( checked if less than ) with current result
+const double multiplier = 1.5000;
+
+// 4K frame
+const size_t imageWidth = 3840;
+const size_t imageHeight = 2160;
+
+template <typename CopyT>
+long long measureImageCopy(CopyT copy) {
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        Timer t;
+        t.start();
+        copy();
+        t.end();
+        times[i] = t.get();
+    }
+    return majorityVote(times[0], times[1], times[2]);
+}
+
+TEST(PitchedCopyPerfTest, given4kImagesWhenCopyingFromHostPtrThenPitchedCopyIsNotSlowerThanRowByRowMemcpy) {
+    setReferenceTime();
+    DebugManagerStateRestore restore;
+    long long totalRowByRowTime = 0;
+    long long totalPitchedCopyTime = 0;
+
+    // R8, RGBA8 and RGBA32F formats
+    for (size_t pixelSize : {1u, 4u, 16u}) {
+        auto rowSize = imageWidth * pixelSize;
+        // tightly packed host ptr and host ptr with rows padded to 256 bytes plus one cache line
+        for (size_t srcRowPitch : {rowSize, alignUp(rowSize, 256u) + 64u}) {
+            auto dstRowPitch = alignUp(rowSize, 64u);
+            std::vector<uint8_t> src(srcRowPitch * imageHeight, 1u);
+            std::vector<uint8_t> dst(dstRowPitch * imageHeight, 0u);
+
+            auto rowByRowTime = measureImageCopy([&]() {
+                for (size_t row = 0; row < imageHeight; row++) {
+                    memcpy(ptrOffset(dst.data(), row * dstRowPitch), ptrOffset(src.data(), row * srcRowPitch), rowSize);
+                }
+            });
+            auto pitchedCopyTime = measureImageCopy([&]() {
+                PitchedCopy::copy(dst.data(), dstRowPitch, dst.size(), src.data(), srcRowPitch, src.size(), rowSize, imageHeight, 1u);
+            });
+            EXPECT_EQ(0, memcmp(dst.data(), src.data(), rowSize));
+
+            std::cout << "Copying " << imageWidth << "x" << imageHeight << " image with " << pixelSize << " byte pixels, "
+                      << "row pitch " << srcRowPitch << " -> " << dstRowPitch << ": "
+                      << rowByRowTime << " ns (row by row memcpy), "
+                      << pitchedCopyTime << " ns (pitched copy, " << PitchedCopy::getWorkersCount(rowSize * imageHeight) << " workers)" << std::endl;
+
+            totalRowByRowTime += rowByRowTime;
+            totalPitchedCopyTime += pitchedCopyTime;
+        }
+    }
+
+    EXPECT_LE(totalPitchedCopyTime, totalRowByRowTime * multiplier);
+
+    uint64_t hash = Hash::hash(__FUNCTION__, strlen(__FUNCTION__));
+    updateTestRatio(hash, static_cast<double>(totalPitchedCopyTime) / static_cast<double>(refTime));
+}
+
+} // namespace ULT
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/memory_constants.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/utilities/spinlock.h"
+
+#include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
+
+#include "perf_test_utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace ULT {
+
+// number of lookups done by every thread in a single measurement
+const size_t lookupsPerThread = 200000;
+const size_t numAllocs = 256;
+// number of allocations made and freed while other allocations stay tracked
+const size_t allocFreeCycles = 10000;
+// lock timings vary between runs and machines, only a lock that is clearly slower fails the test
+const double multiplier = 2.0000;
+
+struct SvmLookupFixture {
+    SvmLookupFixture() : svmManager(nullptr) {
+        for (size_t i = 0; i < numAllocs; i++) {
+            auto gpuAddress = (i + 1) * 2 * MemoryConstants::pageSize64k;
+            allocations.emplace_back(new MockGraphicsAllocation(reinterpret_cast<void *>(gpuAddress), gpuAddress, MemoryConstants::pageSize64k));
+
+            SvmAllocationData allocData;
+            allocData.gpuAllocation = allocations.back().get();
+            allocData.size = MemoryConstants::pageSize64k;
+            svmManager.getSVMAllocs()->insert(allocData);
+        }
+    }
+
+    static const void *getLookupPtr(size_t lookup) {
+        auto allocIndex = (lookup * 7919) % numAllocs;
+        return reinterpret_cast<void *>((allocIndex + 1) * 2 * MemoryConstants::pageSize64k + MemoryConstants::pageSize);
+    }
+
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> allocations;
+    SVMAllocsManager svmManager;
+};
+
+template <typename LookupT>
+long long measureConcurrentLookups(size_t numThreads, LookupT lookup) {
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        std::atomic<size_t> threadsReady{0u};
+        std::atomic<bool> start{false};
+        std::vector<std::thread> threads;
+        for (size_t thread = 0; thread < numThreads; thread++) {
+            threads.emplace_back([&]() {
+                threadsReady++;
+                while (!start) {
+                    std::this_thread::yield();
+                }
+                for (size_t l = 0; l < lookupsPerThread; l++) {
+                    EXPECT_NE(nullptr, lookup(SvmLookupFixture::getLookupPtr(l)));
+                }
+            });
+        }
+        while (threadsReady != numThreads) {
+            std::this_thread::yield();
+        }
+
+        Timer t;
+        t.start();
+        start = true;
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        t.end();
+        times[i] = t.get();
+    }
+    return majorityVote(times[0], times[1], times[2]);
+}
+
+TEST(SvmAllocsManagerPerfTest, givenMultipleThreadsWhenLookingUpSvmAllocationsThenLockFreeLookupIsNotSlowerThanLockedLookup) {
+    setReferenceTime();
+    SvmLookupFixture fixture;
+    SpinLock referenceSpinLock;
+    std::mutex referenceMutex;
+
+    auto numThreads = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+
+    auto lockFreeTime = measureConcurrentLookups(numThreads, [&](const void *ptr) {
+        return fixture.svmManager.getSVMAlloc(ptr);
+    });
+    auto spinLockTime = measureConcurrentLookups(numThreads, [&](const void *ptr) {
+        std::lock_guard<SpinLock> lock(referenceSpinLock);
+        return fixture.svmManager.getSVMAllocs()->get(ptr);
+    });
+    auto mutexTime = measureConcurrentLookups(numThreads, [&](const void *ptr) {
+        std::lock_guard<std::mutex> lock(referenceMutex);
+        return fixture.svmManager.getSVMAllocs()->get(ptr);
+    });
+
+    auto totalLookups = numThreads * lookupsPerThread;
+    std::cout << "getSVMAlloc with " << numThreads << " threads: "
+              << static_cast<double>(lockFreeTime) / totalLookups << " ns per lookup (lock-free), "
+              << static_cast<double>(spinLockTime) / totalLookups << " ns per lookup (SpinLock), "
+              << static_cast<double>(mutexTime) / totalLookups << " ns per lookup (std::mutex)" << std::endl;
+    std::cout << "SpinLock to std::mutex time ratio: " << static_cast<double>(spinLockTime) / static_cast<double>(mutexTime) << std::endl;
+
+    std::cout << "Lock-free to SpinLock time ratio: " << static_cast<double>(lockFreeTime) / static_cast<double>(spinLockTime) << std::endl;
+
+    EXPECT_LE(lockFreeTime, spinLockTime * multiplier);
+    EXPECT_LE(spinLockTime, mutexTime * multiplier);
+
+    uint64_t hash = Hash::hash(__FUNCTION__, strlen(__FUNCTION__));
+    updateTestRatio(hash, static_cast<double>(lockFreeTime) / static_cast<double>(refTime));
+}
+
+long long measureAllocFreeCycles(size_t numTrackedAllocs) {
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> allocations;
+    SVMAllocsManager svmManager(nullptr);
+    auto svmAllocs = svmManager.getSVMAllocs();
+    for (size_t i = 0; i <= numTrackedAllocs; i++) {
+        auto gpuAddress = (i + 1) * MemoryConstants::pageSize64k;
+        allocations.emplace_back(new MockGraphicsAllocation(reinterpret_cast<void *>(gpuAddress), gpuAddress, MemoryConstants::pageSize64k));
+    }
+    std::vector<SvmAllocationData> allocationsData(allocations.size());
+    for (size_t i = 0; i < allocations.size(); i++) {
+        allocationsData[i].gpuAllocation = allocations[i].get();
+        allocationsData[i].size = MemoryConstants::pageSize64k;
+    }
+    for (size_t i = 0; i < numTrackedAllocs; i++) {
+        svmAllocs->insert(allocationsData[i]);
+    }
+    auto &transientAllocData = allocationsData[numTrackedAllocs];
+    auto transientPtr = allocations[numTrackedAllocs]->getUnderlyingBuffer();
+
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        Timer t;
+        t.start();
+        for (size_t cycle = 0; cycle < allocFreeCycles; cycle++) {
+            svmAllocs->insert(transientAllocData);
+            // freeSVMAlloc looks the allocation up before removing it
+            EXPECT_NE(nullptr, svmAllocs->get(transientPtr));
+            svmAllocs->remove(transientAllocData);
+        }
+        t.end();
+        times[i] = t.get();
+    }
+    return majorityVote(times[0], times[1], times[2]);
+}
+
+TEST(SvmAllocsManagerPerfTest, givenTensOfThousandsOfAllocationsWhenAllocatingAndFreeingAlternatelyThenCycleTimeGrowsSublinearly) {
+    setReferenceTime();
+    auto smallTime = measureAllocFreeCycles(1024);
+    auto largeTime = measureAllocFreeCycles(32768);
+
+    std::cout << "SVM alloc, lookup and free cycle: "
+              << static_cast<double>(smallTime) / allocFreeCycles << " ns (1024 allocations), "
+              << static_cast<double>(largeTime) / allocFreeCycles << " ns (32768 allocations)" << std::endl;
+
+    // 32 times more tracked allocations, rebuilding the lookup snapshot in every cycle is about 32 times slower
+    EXPECT_LT(largeTime, smallTime * 8);
+
+    uint64_t hash = Hash::hash(__FUNCTION__, strlen(__FUNCTION__));
+    updateTestRatio(hash, static_cast<double>(largeTime) / static_cast<double>(refTime));
+}
+
+} // namespace ULT
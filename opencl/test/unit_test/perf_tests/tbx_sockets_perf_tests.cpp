@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/tbx/tbx_sockets_imp.h"
+#include "opencl/test/unit_test/mocks/linux/mock_tbx_server.h"
+
+#include "perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+using namespace NEO;
+
+namespace ULT {
+
+// page table setup for 64MB of memory, one 8 byte entry per 4KB page
+const uint32_t pageTableEntries = 16384;
+
+long long measurePageTableSetupTime() {
+    MockTbxServer server(true);
+    std::stringstream errors;
+    TbxSocketsImp socket(errors);
+    if (!socket.init("127.0.0.1", server.getPort())) {
+        return 0;
+    }
+
+    Timer t;
+    t.start();
+    for (uint32_t i = 0; i < pageTableEntries; i++) {
+        uint64_t entry = (static_cast<uint64_t>(i) << 12) | 0x3;
+        socket.writeMemory(0x100000 + i * sizeof(entry), &entry, sizeof(entry), 0);
+    }
+    uint32_t value = 0;
+    socket.readMMIO(0x2080, &value);
+    t.end();
+
+    socket.close();
+    return t.get();
+}
+
+long long measurePageTableSetupTimeMajority() {
+    auto time1 = measurePageTableSetupTime();
+    auto time2 = measurePageTableSetupTime();
+    auto time3 = measurePageTableSetupTime();
+    return majorityVote(time1, time2, time3);
+}
+
+TEST(TbxSocketsPerfTest, givenBatchedWritesWhenPageTableIsWrittenThenThroughputIsHigherThanWithSeparateWrites) {
+    setReferenceTime();
+    DebugManagerStateRestore restore;
+    DebugManager.flags.TbxSendBatchSize.set(0);
+    auto timeSeparate = measurePageTableSetupTimeMajority();
+
+    DebugManager.flags.TbxSendBatchSize.set(-1);
+    auto timeBatched = measurePageTableSetupTimeMajority();
+
+    ASSERT_NE(0, timeSeparate);
+    ASSERT_NE(0, timeBatched);
+    std::cout << "TBX page table setup: " << timeSeparate << " ns with separate writes, "
+              << timeBatched << " ns with batched writes" << std::endl;
+    EXPECT_LT(timeBatched, timeSeparate);
+
+    uint64_t hash = Hash::hash(__FUNCTION__, strlen(__FUNCTION__));
+    updateTestRatio(hash, static_cast<double>(timeBatched) / static_cast<double>(refTime));
+}
+
+} // namespace ULT
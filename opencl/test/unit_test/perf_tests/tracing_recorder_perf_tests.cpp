@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash.h"
+
+#include "opencl/source/tracing/tracing_notify.h"
+#include "opencl/source/tracing/tracing_recorder.h"
+
+#include "perf_test_utils.h"
+
+#include <cstring>
+#include <iostream>
+
+using namespace NEO;
+
+namespace ULT {
+
+// number of api calls in a single measurement
+const size_t callsPerMeasurement = 100000;
+const size_t recordsPerThread = 4096;
+
+cl_int tracedApiCall(cl_uint numEntries, cl_platform_id *platforms, cl_uint *numPlatforms) {
+    TRACING_ENTER(clGetPlatformIDs, &numEntries, &platforms, &numPlatforms);
+    cl_int retVal = CL_SUCCESS;
+    TRACING_EXIT(clGetPlatformIDs, &retVal);
+    return retVal;
+}
+
+long long measureTracedApiCallsTime() {
+    long long times[3] = {0, 0, 0};
+    cl_uint numPlatforms = 0;
+    for (int i = 0; i < 3; i++) {
+        Timer t;
+        t.start();
+        for (size_t call = 0; call < callsPerMeasurement; call++) {
+            tracedApiCall(0, nullptr, &numPlatforms);
+        }
+        t.end();
+        times[i] = t.get();
+    }
+    return majorityVote(times[0], times[1], times[2]);
+}
+
+TEST(TracingRecorderPerfTest, givenEnabledTracingRecorderWhenApiIsCalledThenOverheadPerCallIsBelow100ns) {
+    setReferenceTime();
+    auto timeWithoutTracing = measureTracedApiCallsTime();
+
+    // thread buffer wraps around during measurement, as in long running applications
+    HostSideTracing::TracingRecorder recorder("tracing_recorder_perf_test.json", recordsPerThread);
+    ASSERT_TRUE(recorder.enable());
+    for (size_t call = 0; call < recordsPerThread; call++) {
+        cl_uint numPlatforms = 0;
+        tracedApiCall(0, nullptr, &numPlatforms);
+    }
+    auto timeWithTracing = measureTracedApiCallsTime();
+    recorder.disable();
+
+    auto overheadPerCall = (timeWithTracing - timeWithoutTracing) / static_cast<long long>(callsPerMeasurement);
+    std::cout << "Tracing recorder overhead: " << overheadPerCall << " ns per api call" << std::endl;
+    EXPECT_LT(overheadPerCall, 100);
+
+    uint64_t hash = Hash::hash(__FUNCTION__, strlen(__FUNCTION__));
+    updateTestRatio(hash, static_cast<double>(timeWithTracing) / static_cast<double>(refTime));
+}
+
+} // namespace ULT
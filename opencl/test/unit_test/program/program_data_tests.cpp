@@ -14,6 +14,7 @@
 #include "shared/test/unit_test/device_binary_format/patchtokens_tests.h"
 
 #include "opencl/source/platform/platform.h"
+#include "opencl/source/program/kernel_info.h"
 #include "opencl/source/program/program.h"
 #include "opencl/test/unit_test/mocks/mock_buffer.h"
 #include "opencl/test/unit_test/mocks/mock_csr.h"
@@ -412,6 +413,44 @@ TEST(ProgramScopeMetadataTest, WhenPatchingGlobalSurfaceThenPickProperSourceBuff
     EXPECT_EQ(static_cast<uintptr_t>(program.constantSurface->getGpuAddressToPatch()), *reinterpret_cast<uintptr_t *>(program.globalSurface->getUnderlyingBuffer()));
 }
 
+TEST(ProgramScopeMetadataTest, givenKernelsToLoadWhenProcessingProgramInfoThenOtherKernelsAreDiscarded) {
+    MockExecutionEnvironment execEnv;
+    MockProgram program(execEnv);
+    SKernelBinaryHeaderCommon kernelHeader = {};
+    ProgramInfo programInfo;
+    for (auto kernelName : {"kernelA", "kernelB", "kernelC"}) {
+        auto kernelInfo = new KernelInfo();
+        kernelInfo->name = kernelName;
+        kernelInfo->heapInfo.pKernelHeader = &kernelHeader;
+        programInfo.kernelInfos.push_back(kernelInfo);
+    }
+
+    program.setKernelsToLoad({"kernelC", "kernelA"});
+    EXPECT_EQ(CL_SUCCESS, program.processProgramInfo(programInfo));
+    ASSERT_EQ(2u, program.getNumKernels());
+    EXPECT_EQ("kernelA", program.getKernelInfo(0u)->name);
+    EXPECT_EQ("kernelC", program.getKernelInfo(1u)->name);
+    EXPECT_EQ(nullptr, program.getKernelInfo("kernelB"));
+}
+
+TEST(ProgramScopeMetadataTest, givenKernelsToLoadAndLinkerInputWhenProcessingProgramInfoThenAllKernelsAreKept) {
+    MockExecutionEnvironment execEnv;
+    MockProgram program(execEnv);
+    SKernelBinaryHeaderCommon kernelHeader = {};
+    ProgramInfo programInfo;
+    programInfo.prepareLinkerInputStorage();
+    for (auto kernelName : {"kernelA", "kernelB"}) {
+        auto kernelInfo = new KernelInfo();
+        kernelInfo->name = kernelName;
+        kernelInfo->heapInfo.pKernelHeader = &kernelHeader;
+        programInfo.kernelInfos.push_back(kernelInfo);
+    }
+
+    program.setKernelsToLoad({"kernelA"});
+    EXPECT_EQ(CL_SUCCESS, program.processProgramInfo(programInfo));
+    EXPECT_EQ(2u, program.getNumKernels());
+}
+
 TEST_F(ProgramDataTest, GivenProgramWith32bitPointerOptWhenProgramScopeConstantBufferPatchTokensAreReadThenConstantPointerOffsetIsPatchedWith32bitPointer) {
     cl_device_id device = pPlatform->getClDevice(0);
     CreateProgramWithSource(pContext, &device, "CopyBuffer_simd16.cl");
@@ -1900,6 +1900,59 @@ TEST_F(ProgramTests, givenProgramFromGenBinaryWhenSLMSizeIsBiggerThenDeviceLimit
     EXPECT_EQ(CL_OUT_OF_RESOURCES, retVal);
 }
 
+struct MockOsMappedFile : public OsMappedFile {
+    MockOsMappedFile(const void *mappedData, size_t mappedSize) {
+        data = static_cast<const char *>(mappedData);
+        size = mappedSize;
+    }
+};
+
+TEST_F(ProgramTests, givenMappedDeviceBinaryWhenProcessingGenBinaryThenMappedMemoryIsDecodedWithoutCopy) {
+    PatchTokensTestData::ValidProgramWithKernel patchtokensProgram;
+    auto program = std::make_unique<MockProgram>(*pDevice->getExecutionEnvironment(), nullptr, false, pDevice);
+    program->replaceDeviceBinaryWithMappedFile(std::make_unique<MockOsMappedFile>(patchtokensProgram.storage.data(), patchtokensProgram.storage.size()));
+
+    EXPECT_EQ(nullptr, program->unpackedDeviceBinary);
+    EXPECT_EQ(nullptr, program->packedDeviceBinary);
+    EXPECT_EQ(patchtokensProgram.storage.data(), program->getUnpackedDeviceBinary().begin());
+    EXPECT_EQ(patchtokensProgram.storage.size(), program->getUnpackedDeviceBinary().size());
+
+    EXPECT_EQ(CL_SUCCESS, program->processGenBinary());
+    ASSERT_EQ(1U, program->getNumKernels());
+    auto kernelHeap = reinterpret_cast<const uint8_t *>(program->getKernelInfo(size_t{0})->heapInfo.pKernelHeap);
+    EXPECT_LE(patchtokensProgram.storage.data(), kernelHeap);
+    EXPECT_GT(patchtokensProgram.storage.data() + patchtokensProgram.storage.size(), kernelHeap);
+
+    EXPECT_EQ(CL_SUCCESS, program->packDeviceBinary());
+    EXPECT_NE(nullptr, program->packedDeviceBinary);
+}
+
+TEST_F(ProgramTests, givenMappedDeviceBinaryWhenReplacingDeviceBinaryThenMappingIsReleased) {
+    PatchTokensTestData::ValidEmptyProgram patchtokensProgram;
+    auto program = std::make_unique<MockProgram>(*pDevice->getExecutionEnvironment(), nullptr, false, pDevice);
+    program->replaceDeviceBinaryWithMappedFile(std::make_unique<MockOsMappedFile>(patchtokensProgram.storage.data(), patchtokensProgram.storage.size()));
+    EXPECT_NE(nullptr, program->mappedUnpackedDeviceBinary);
+
+    program->replaceDeviceBinary(makeCopy(patchtokensProgram.storage.data(), patchtokensProgram.storage.size()), patchtokensProgram.storage.size());
+    EXPECT_EQ(nullptr, program->mappedUnpackedDeviceBinary);
+    EXPECT_EQ(reinterpret_cast<const uint8_t *>(program->unpackedDeviceBinary.get()), program->getUnpackedDeviceBinary().begin());
+}
+
+TEST_F(ProgramTests, givenMappedPackedDeviceBinaryWhenReplacingDeviceBinaryThenBinaryIsCopied) {
+    PatchTokensTestData::ValidEmptyProgram patchtokensProgram;
+    NEO::Elf::ElfEncoder<NEO::Elf::EI_CLASS_64> elfEncoder;
+    elfEncoder.getElfFileHeader().type = NEO::Elf::ET_OPENCL_EXECUTABLE;
+    elfEncoder.appendSection(NEO::Elf::SHT_OPENCL_DEV_BINARY, NEO::Elf::SectionNamesOpenCl::deviceBinary, patchtokensProgram.storage);
+    auto elfBinary = elfEncoder.encode();
+
+    auto program = std::make_unique<MockProgram>(*pDevice->getExecutionEnvironment(), nullptr, false, pDevice);
+    program->replaceDeviceBinaryWithMappedFile(std::make_unique<MockOsMappedFile>(elfBinary.data(), elfBinary.size()));
+    EXPECT_EQ(nullptr, program->mappedUnpackedDeviceBinary);
+    ASSERT_NE(nullptr, program->packedDeviceBinary);
+    EXPECT_EQ(elfBinary.size(), program->packedDeviceBinarySize);
+    EXPECT_EQ(0, memcmp(elfBinary.data(), program->packedDeviceBinary.get(), elfBinary.size()));
+}
+
 TEST_F(ProgramTests, RebuildBinaryButNoCompilerInterface) {
     auto noCompilerInterfaceExecutionEnvironment = std::make_unique<MockCompIfaceExecutionEnvironment>(nullptr);
     auto program = std::make_unique<MockProgram>(*noCompilerInterfaceExecutionEnvironment);
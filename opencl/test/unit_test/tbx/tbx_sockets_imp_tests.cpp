@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/tbx/tbx_proto.h"
+#include "opencl/source/tbx/tbx_sockets_imp.h"
+#include "opencl/test/unit_test/mocks/linux/mock_tbx_server.h"
+#include "test.h"
+
+#include <sstream>
+
+using namespace NEO;
+
+struct TbxSocketsImpTest : public ::testing::Test {
+    void SetUp() override {
+        ASSERT_NE(0u, server.getPort());
+    }
+
+    void initSocket(TbxSocketsImp &socket) {
+        ASSERT_TRUE(socket.init("127.0.0.1", server.getPort()));
+    }
+
+    MockTbxServer server;
+    std::stringstream errors;
+};
+
+TEST_F(TbxSocketsImpTest, givenContiguousMemoryWritesWhenMemoryIsReadThenWritesAreSentAsSingleMessage) {
+    TbxSocketsImp socket(errors);
+    initSocket(socket);
+
+    uint64_t entries[3] = {0x1000, 0x2000, 0x3000};
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_TRUE(socket.writeMemory(0x10000 + i * sizeof(uint64_t), &entries[i], sizeof(uint64_t), 0));
+    }
+    EXPECT_TRUE(socket.writeGTT(2 * sizeof(uint64_t), 0xabcd00000001));
+
+    uint64_t readEntries[3] = {};
+    EXPECT_TRUE(socket.readMemory(0x10000, readEntries, sizeof(readEntries)));
+    EXPECT_EQ(0, memcmp(entries, readEntries, sizeof(entries)));
+
+    EXPECT_EQ(1u, server.getMessagesCount(HAS_WRITE_DATA_REQ_TYPE));
+    EXPECT_EQ(1u, server.getMessagesCount(HAS_GTT_REQ_TYPE));
+    EXPECT_EQ(0xabcd00000001u, server.getGttEntry(2));
+    socket.close();
+    EXPECT_TRUE(errors.str().empty());
+}
+
+TEST_F(TbxSocketsImpTest, givenMemoryWritesSeparatedByOtherMessageOrAddressGapOrTypeWhenSentThenWritesAreNotMerged) {
+    TbxSocketsImp socket(errors);
+    initSocket(socket);
+
+    uint32_t value = 0x12345678;
+    EXPECT_TRUE(socket.writeMemory(0x1000, &value, sizeof(value), 0));
+    EXPECT_TRUE(socket.writeMMIO(0x2080, 1));
+    EXPECT_TRUE(socket.writeMemory(0x1004, &value, sizeof(value), 0));
+    EXPECT_TRUE(socket.writeMemory(0x1010, &value, sizeof(value), 0));
+    EXPECT_TRUE(socket.writeMemory(0x1014, &value, sizeof(value), 1));
+
+    uint32_t mmioValue = 0;
+    EXPECT_TRUE(socket.readMMIO(0x2080, &mmioValue));
+    EXPECT_EQ(1u, mmioValue);
+    EXPECT_EQ(4u, server.getMessagesCount(HAS_WRITE_DATA_REQ_TYPE));
+    EXPECT_EQ(2u, server.getMessagesCount(HAS_MMIO_REQ_TYPE));
+    EXPECT_EQ(0x78u, server.getMemoryByte(0x1014));
+    socket.close();
+}
+
+TEST_F(TbxSocketsImpTest, givenBatchingDisabledWhenMemoryIsWrittenThenEachWriteIsSentSeparately) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.TbxSendBatchSize.set(0);
+
+    TbxSocketsImp socket(errors);
+    initSocket(socket);
+
+    uint64_t entries[3] = {0x1000, 0x2000, 0x3000};
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_TRUE(socket.writeMemory(0x10000 + i * sizeof(uint64_t), &entries[i], sizeof(uint64_t), 0));
+    }
+    uint64_t readEntries[3] = {};
+    EXPECT_TRUE(socket.readMemory(0x10000, readEntries, sizeof(readEntries)));
+    EXPECT_EQ(0, memcmp(entries, readEntries, sizeof(entries)));
+    EXPECT_EQ(3u, server.getMessagesCount(HAS_WRITE_DATA_REQ_TYPE));
+    socket.close();
+}
+
+TEST_F(TbxSocketsImpTest, givenWritesExceedingSendBatchSizeWhenMemoryIsReadThenAllDataIsWritten) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.TbxSendBatchSize.set(1);
+
+    TbxSocketsImp socket(errors);
+    initSocket(socket);
+
+    std::vector<uint8_t> data(4096);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i * 3 + 1);
+    }
+    EXPECT_TRUE(socket.writeMemory(0x20000, data.data(), data.size(), 0));
+    for (size_t offset = 0; offset < data.size(); offset += 256) {
+        EXPECT_TRUE(socket.writeMemory(0x30000 + offset, data.data() + offset, 256, 0));
+    }
+
+    std::vector<uint8_t> readData(data.size());
+    EXPECT_TRUE(socket.readMemory(0x20000, readData.data(), readData.size()));
+    EXPECT_EQ(data, readData);
+    EXPECT_TRUE(socket.readMemory(0x30000, readData.data(), readData.size()));
+    EXPECT_EQ(data, readData);
+    socket.close();
+}
+
+TEST_F(TbxSocketsImpTest, givenBatchedWritesWhenSocketIsClosedThenWritesAreSentToServer) {
+    TbxSocketsImp socket(errors);
+    initSocket(socket);
+
+    EXPECT_TRUE(socket.writeMMIO(0x2230, 5));
+    uint8_t value = 0x5a;
+    EXPECT_TRUE(socket.writeMemory(0x40000, &value, sizeof(value), 0));
+    socket.close();
+
+    server.waitForClientDisconnect();
+    EXPECT_EQ(1u, server.getMessagesCount(HAS_MMIO_REQ_TYPE));
+    EXPECT_EQ(0x5au, server.getMemoryByte(0x40000));
+}
@@ -90,6 +90,48 @@ TEST(FileLogger, WithoutDebugFunctionalityDoesNotCreateLogFile) {
     EXPECT_FALSE(fileLogger.wasFileCreated(fileLogger.getLogFileName()));
 }
 
+TEST(FileLogger, GivenLogToBinaryFileWhenLoggingThenRecordsAreWrittenToBinaryFileOnly) {
+    DebugVariables flags;
+    flags.LogApiCalls.set(true);
+    flags.LogToBinaryFile.set(true);
+    std::string binaryLogFileName = "test_binary.log.bin";
+    {
+        FullyEnabledFileLogger fileLogger(std::string("test_binary.log"), flags);
+        ASSERT_NE(nullptr, fileLogger.peekBinaryLogWriter());
+
+        fileLogger.logApiCall("searchString", true, 0);
+        fileLogger.logInputs("searchString2", "any");
+        fileLogger.log(true, "searchString3");
+        fileLogger.log(false, "searchString4");
+        fileLogger.logApiCall("searchString", false, -5);
+
+        EXPECT_EQ(0, fileLogger.createdFilesCount());
+    }
+
+    size_t binaryLogSize = 0u;
+    auto binaryLog = loadDataFromFile(binaryLogFileName.c_str(), binaryLogSize);
+    std::remove(binaryLogFileName.c_str());
+    ASSERT_NE(nullptr, binaryLog);
+
+    std::string str;
+    ASSERT_TRUE(BinaryLog::decode(ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(binaryLog.get()), binaryLogSize), str));
+    EXPECT_NE(std::string::npos, str.find("Function Enter: searchString\n"));
+    EXPECT_NE(std::string::npos, str.find("searchString2"));
+    EXPECT_NE(std::string::npos, str.find("searchString3"));
+    EXPECT_EQ(std::string::npos, str.find("searchString4"));
+    EXPECT_NE(std::string::npos, str.find("Function Leave (-5): searchString\n"));
+}
+
+TEST(FileLogger, GivenLogToBinaryFileWithoutDebugFunctionalityThenBinaryLogIsNotCreated) {
+    DebugVariables flags;
+    flags.LogApiCalls.set(true);
+    flags.LogToBinaryFile.set(true);
+    FullyDisabledFileLogger fileLogger(std::string("test_binary.log"), flags);
+
+    EXPECT_EQ(nullptr, fileLogger.peekBinaryLogWriter());
+    EXPECT_FALSE(fileExists("test_binary.log.bin"));
+}
+
 TEST(FileLogger, WithIncorrectFilenameFileNotCreated) {
     DebugVariables flags;
     flags.LogApiCalls.set(true);
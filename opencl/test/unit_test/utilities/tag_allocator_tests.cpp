@@ -13,7 +13,12 @@
 
 #include "gtest/gtest.h"
 
+#include <atomic>
 #include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 using namespace NEO;
 
@@ -43,9 +48,9 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using BaseClass::deferredTags;
     using BaseClass::doNotReleaseNodes;
     using BaseClass::freeTags;
+    using BaseClass::freeTagsCache;
     using BaseClass::populateFreeTags;
     using BaseClass::releaseDeferredTags;
-    using BaseClass::usedTags;
 
     MockTagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment, bool disableCompletionCheck)
         : BaseClass(0, memMngr, tagCount, tagAlignment, sizeof(TagType), disableCompletionCheck) {
@@ -63,8 +68,25 @@ class MockTagAllocator : public TagAllocator<TagType> {
         return this->freeTags.peekHead();
     }
 
-    TagNodeT *getUsedTagsHead() {
-        return this->usedTags.peekHead();
+    bool isFreeTag(TagNodeT &node) {
+        for (auto head : {this->freeTags.peekHead(), this->freeTagsCache.peekHead()}) {
+            for (auto current = head; current != nullptr; current = current->next) {
+                if (current == &node) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    size_t getFreeTagsCount() {
+        size_t count = 0;
+        for (auto head : {this->freeTags.peekHead(), this->freeTagsCache.peekHead()}) {
+            for (auto current = head; current != nullptr; current = current->next) {
+                count++;
+            }
+        }
+        return count;
     }
 
     size_t getGraphicsAllocationsCount() {
@@ -83,7 +105,7 @@ TEST_F(TagAllocatorTest, Initialize) {
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
 
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(100u, tagAllocator.getFreeTagsCount());
 
     void *gfxMemory = tagAllocator.getGraphicsAllocation()->getUnderlyingBuffer();
     void *head = reinterpret_cast<void *>(tagAllocator.getFreeTagsHead()->tagForCpuAccess);
@@ -96,28 +118,18 @@ TEST_F(TagAllocatorTest, GetReturnTagCheckFreeAndUsedLists) {
 
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(10u, tagAllocator.getFreeTagsCount());
 
     TagNode<TimeStamps> *tagNode = tagAllocator.getTag();
 
     EXPECT_NE(nullptr, tagNode);
-
-    IDList<TagNode<TimeStamps>> &freeList = tagAllocator.freeTags;
-    IDList<TagNode<TimeStamps>> &usedList = tagAllocator.usedTags;
-
-    bool isFoundOnUsedList = usedList.peekContains(*tagNode);
-    bool isFoundOnFreeList = freeList.peekContains(*tagNode);
-
-    EXPECT_FALSE(isFoundOnFreeList);
-    EXPECT_TRUE(isFoundOnUsedList);
+    EXPECT_FALSE(tagAllocator.isFreeTag(*tagNode));
+    EXPECT_EQ(9u, tagAllocator.getFreeTagsCount());
 
     tagAllocator.returnTag(tagNode);
 
-    isFoundOnUsedList = usedList.peekContains(*tagNode);
-    isFoundOnFreeList = freeList.peekContains(*tagNode);
-
-    EXPECT_TRUE(isFoundOnFreeList);
-    EXPECT_FALSE(isFoundOnUsedList);
+    EXPECT_TRUE(tagAllocator.isFreeTag(*tagNode));
+    EXPECT_EQ(10u, tagAllocator.getFreeTagsCount());
 }
 
 TEST_F(TagAllocatorTest, TagAlignment) {
@@ -206,25 +218,19 @@ TEST_F(TagAllocatorTest, GetTagsAndReturnInDifferentOrder) {
     EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
     EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
 
-    IDList<TagNode<TimeStamps>> &freeList = tagAllocator.freeTags;
-    bool isFoundOnFreeList = freeList.peekContains(*tagNodes[0]);
-    EXPECT_FALSE(isFoundOnFreeList);
+    EXPECT_FALSE(tagAllocator.isFreeTag(*tagNodes[0]));
 
     tagAllocator.returnTag(tagNodes[2]);
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[2]);
-    EXPECT_TRUE(isFoundOnFreeList);
+    EXPECT_TRUE(tagAllocator.isFreeTag(*tagNodes[2]));
     EXPECT_NE(nullptr, tagAllocator.getFreeTagsHead());
 
     tagAllocator.returnTag(tagNodes[3]);
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[3]);
-    EXPECT_TRUE(isFoundOnFreeList);
+    EXPECT_TRUE(tagAllocator.isFreeTag(*tagNodes[3]));
 
     tagAllocator.returnTag(tagNodes[1]);
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[1]);
-    EXPECT_TRUE(isFoundOnFreeList);
+    EXPECT_TRUE(tagAllocator.isFreeTag(*tagNodes[1]));
 
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[0]);
-    EXPECT_FALSE(isFoundOnFreeList);
+    EXPECT_FALSE(tagAllocator.isFreeTag(*tagNodes[0]));
 
     tagAllocator.returnTag(tagNodes[0]);
 }
@@ -297,18 +303,18 @@ TEST_F(TagAllocatorTest, givenMultipleReferencesOnTagWhenReleasingThenReturnWhen
     MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 2, 1);
 
     auto tag = tagAllocator.getTag();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_FALSE(tagAllocator.isFreeTag(*tag));
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead()); // only 1 reference
+    EXPECT_TRUE(tagAllocator.isFreeTag(*tag)); // only 1 reference
 
     tag = tagAllocator.getTag();
     tag->incRefCount();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_FALSE(tagAllocator.isFreeTag(*tag));
 
     tagAllocator.returnTag(tag);
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead()); // 1 reference left
+    EXPECT_FALSE(tagAllocator.isFreeTag(*tag)); // 1 reference left
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_TRUE(tagAllocator.isFreeTag(*tag));
 }
 
 TEST_F(TagAllocatorTest, givenNotReadyTagWhenReturnedThenMoveToDeferredList) {
@@ -402,6 +408,116 @@ TEST_F(TagAllocatorTest, givenTagsOnDeferredListWhenReleasingItThenMoveReadyTags
     EXPECT_FALSE(tagAllocator.freeTags.peekIsEmpty());
 }
 
+TEST_F(TagAllocatorTest, givenCompletedOldestDeferredTagsWhenReleasingThenOnlyOldestCompletedTagsAreReleased) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 3, 1);
+    TagNode<TimeStamps> *nodes[3];
+    for (auto &node : nodes) {
+        node = tagAllocator.getTag();
+    }
+    for (auto &node : nodes) {
+        node->tagForCpuAccess->release = false;
+        tagAllocator.returnTag(node);
+    }
+    EXPECT_EQ(nodes[0], tagAllocator.deferredTags.peekHead());
+
+    nodes[0]->tagForCpuAccess->release = true;
+    nodes[2]->tagForCpuAccess->release = true;
+    tagAllocator.releaseDeferredTags();
+    EXPECT_TRUE(tagAllocator.isFreeTag(*nodes[0]));
+    EXPECT_FALSE(tagAllocator.isFreeTag(*nodes[2]));
+    EXPECT_EQ(nodes[1], tagAllocator.deferredTags.peekHead());
+    EXPECT_EQ(nodes[2], tagAllocator.deferredTags.peekTail());
+}
+
+TEST_F(TagAllocatorTest, givenOldestDeferredTagNotCompletedWhenReleasingThenAllCompletedTagsAreReleasedAndOrderIsPreserved) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 4, 1);
+    TagNode<TimeStamps> *nodes[4];
+    for (auto &node : nodes) {
+        node = tagAllocator.getTag();
+    }
+    for (auto &node : nodes) {
+        node->tagForCpuAccess->release = false;
+        tagAllocator.returnTag(node);
+    }
+
+    nodes[1]->tagForCpuAccess->release = true;
+    nodes[3]->tagForCpuAccess->release = true;
+    tagAllocator.releaseDeferredTags();
+    EXPECT_FALSE(tagAllocator.isFreeTag(*nodes[0]));
+    EXPECT_TRUE(tagAllocator.isFreeTag(*nodes[1]));
+    EXPECT_FALSE(tagAllocator.isFreeTag(*nodes[2]));
+    EXPECT_TRUE(tagAllocator.isFreeTag(*nodes[3]));
+    EXPECT_EQ(nodes[0], tagAllocator.deferredTags.peekHead());
+    EXPECT_EQ(nodes[2], tagAllocator.deferredTags.peekTail());
+}
+
+TEST_F(TagAllocatorTest, givenTagsReturnedToDeferredListWhileReleasingDeferredTagsThenReturnOrderIsPreserved) {
+    constexpr size_t numTags = 256;
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, numTags, 1);
+    std::vector<TagNode<TimeStamps> *> nodes;
+    for (size_t i = 0; i < numTags; i++) {
+        nodes.push_back(tagAllocator.getTag());
+        nodes.back()->tagForCpuAccess->release = false;
+    }
+
+    std::atomic<bool> returningDone{false};
+    std::thread releasingThread([&]() {
+        while (!returningDone) {
+            tagAllocator.releaseDeferredTags();
+        }
+    });
+    for (auto node : nodes) {
+        tagAllocator.returnTag(node);
+    }
+    returningDone = true;
+    releasingThread.join();
+
+    auto currentNode = tagAllocator.deferredTags.peekHead();
+    for (auto node : nodes) {
+        ASSERT_EQ(node, currentNode);
+        currentNode = currentNode->next;
+    }
+    EXPECT_EQ(nullptr, currentNode);
+}
+
+TEST_F(TagAllocatorTest, givenMultipleThreadsWhenGettingAndReturningTagsThenEachTagIsOwnedByOneThreadAtTime) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 16, 1);
+    constexpr size_t numThreads = 4;
+    constexpr size_t iterations = 1000;
+    std::mutex ownedTagsMutex;
+    std::unordered_set<TagNode<TimeStamps> *> ownedTags;
+    std::atomic<bool> tagsShared{false};
+
+    auto worker = [&]() {
+        for (size_t i = 0; i < iterations; i++) {
+            auto node = tagAllocator.getTag();
+            {
+                std::lock_guard<std::mutex> lock(ownedTagsMutex);
+                if (!ownedTags.insert(node).second) {
+                    tagsShared = true;
+                }
+            }
+            std::this_thread::yield();
+            {
+                std::lock_guard<std::mutex> lock(ownedTagsMutex);
+                ownedTags.erase(node);
+            }
+            tagAllocator.returnTag(node);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++) {
+        threads.emplace_back(worker);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(tagsShared);
+    EXPECT_EQ(tagAllocator.getTagPoolCount() * 16, tagAllocator.getFreeTagsCount());
+}
+
 TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSetValidllocationType) {
     TagAllocator<TimestampPacketStorage> timestampPacketAllocator(0, memoryManager, 1, 1, sizeof(TimestampPacketStorage), false);
     TagAllocator<HwTimeStamps> hwTimeStampsAllocator(0, memoryManager, 1, 1, sizeof(HwTimeStamps), false);
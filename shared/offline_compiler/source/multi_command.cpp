@@ -8,36 +8,44 @@
 #include "shared/offline_compiler/source/multi_command.h"
 
 namespace NEO {
-int MultiCommand::singleBuild(size_t numArgs, const std::vector<std::string> &allArgs) {
+void MultiCommand::singleBuild(SingleBuild &build) {
     int retVal = ErrorCode::SUCCESS;
-    std::string buildLog;
-    OfflineCompiler *pCompiler = OfflineCompiler::create(numArgs, allArgs, true, retVal);
+    build.compiler.reset(OfflineCompiler::create(build.args.size(), build.args, true, retVal));
     if (retVal == ErrorCode::SUCCESS) {
-        retVal = buildWithSafetyGuard(pCompiler);
+        retVal = buildWithSafetyGuard(build.compiler.get());
+    }
+    build.retVal = retVal;
+}
+
+void MultiCommand::reportSingleBuild(SingleBuild &build, size_t buildId) {
+    if (!quiet)
+        printf("\nCommand number %d: ", static_cast<int>(buildId + 1));
 
-        buildLog = pCompiler->getBuildLog();
+    std::string buildLog;
+    if (build.compiler) {
+        buildLog = build.compiler->getBuildLog();
         if (buildLog.empty() == false) {
             printf("%s\n", buildLog.c_str());
         }
 
-        if (retVal == ErrorCode::SUCCESS) {
-            if (!pCompiler->isQuiet())
+        if (build.retVal == ErrorCode::SUCCESS) {
+            if (!build.compiler->isQuiet())
                 printf("Build succeeded.\n");
         } else {
-            printf("Build failed with error code: %d\n", retVal);
+            printf("Build failed with error code: %d\n", build.retVal);
         }
     }
     if (buildLog.empty() == false) {
-        singleBuilds.push_back(pCompiler);
+        singleBuilds.push_back(build.compiler.release());
     } else {
-        delete pCompiler;
+        build.compiler.reset();
     }
 
     if (outputFileList != "") {
         std::ofstream myfile(outputFileList, std::fstream::app);
         if (myfile.is_open()) {
-            if (retVal == ErrorCode::SUCCESS)
-                myfile << getCurrentDirectoryOwn(outDirForBuilds) + OutFileName + ".bin";
+            if (build.retVal == ErrorCode::SUCCESS)
+                myfile << getCurrentDirectoryOwn(outDirForBuilds) + build.outFileName + ".bin";
             else
                 myfile << "Unsuccesful build";
             myfile << std::endl;
@@ -45,9 +53,8 @@ int MultiCommand::singleBuild(size_t numArgs, const std::vector<std::string> &al
         } else
             printf("Unable to open outputFileList\n");
     }
-
-    return retVal;
 }
+
 MultiCommand::MultiCommand() = default;
 
 MultiCommand::~MultiCommand() {
@@ -127,6 +134,12 @@ int MultiCommand::initialize(const std::vector<std::string> &allArgs) {
             argIndex++;
         } else if (allArgs[argIndex] == "-q") {
             quiet = true;
+        } else if (allArgs[argIndex] == "-j") {
+            if ((numArgs <= argIndex + 1) || (false == parseJobsCount(allArgs[argIndex + 1], jobsCount))) {
+                printHelp();
+                return INVALID_COMMAND_LINE;
+            }
+            argIndex++;
         } else if (allArgs[argIndex] == "-output_file_list") {
             if (numArgs > argIndex + 1)
                 outputFileList = allArgs[argIndex + 1];
@@ -148,27 +161,37 @@ int MultiCommand::initialize(const std::vector<std::string> &allArgs) {
     //save file with builds arguments to vector of strings, line by line
     openFileWithBuildsArguments();
     if (!lines.empty()) {
+        std::vector<SingleBuild> builds(lines.size());
         for (unsigned int i = 0; i < lines.size(); i++) {
-            std::vector<std::string> singleLineWithArguments;
-            unsigned int numberOfArg;
+            auto &singleLineWithArguments = builds[i].args;
 
             singleLineWithArguments.push_back(allArgs[0]);
-            retVal = splitLineInSeparateArgs(singleLineWithArguments, lines[i], i);
-            if (retVal != ErrorCode::SUCCESS) {
-                retValues.push_back(retVal);
+            builds[i].retVal = splitLineInSeparateArgs(singleLineWithArguments, lines[i], i);
+            if (builds[i].retVal != ErrorCode::SUCCESS) {
                 continue;
             }
+            builds[i].isCommandLineSplit = true;
 
             addAdditionalOptionsToSingleCommandLine(singleLineWithArguments, i);
-
-            numberOfArg = static_cast<unsigned int>(singleLineWithArguments.size());
-
-            if (!quiet)
-                printf("\nCommand number %d: ", i + 1);
-            retVal = singleBuild(numberOfArg, singleLineWithArguments);
-            retValues.push_back(retVal);
+            builds[i].outFileName = OutFileName;
         }
 
+        // lines are built on a pool of jobsCount threads, results are reported in lines order
+        runBuildsInOrder(
+            builds.size(), jobsCount,
+            [&](size_t buildId) {
+                if (builds[buildId].isCommandLineSplit) {
+                    singleBuild(builds[buildId]);
+                }
+            },
+            [&](size_t buildId) {
+                if (builds[buildId].isCommandLineSplit) {
+                    reportSingleBuild(builds[buildId], buildId);
+                }
+                retValues.push_back(builds[buildId].retVal);
+                return true;
+            });
+
         return showResults();
     } else {
         printHelp();
@@ -191,6 +214,10 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of builds run in parallel.
+                                0 - use all hardware threads.
+                                Default is 1.
+
 )===");
 }
 
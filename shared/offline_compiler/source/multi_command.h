@@ -7,6 +7,7 @@
 
 #include "shared/offline_compiler/source/decoder/binary_decoder.h"
 #include "shared/offline_compiler/source/decoder/binary_encoder.h"
+#include "shared/offline_compiler/source/ocloc_parallel_build.h"
 #include "shared/offline_compiler/source/offline_compiler.h"
 #include "shared/offline_compiler/source/utilities/get_current_dir.h"
 #include "shared/offline_compiler/source/utilities/safety_caller.h"
@@ -16,6 +17,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <memory>
 
 namespace NEO {
 
@@ -40,7 +42,16 @@ class MultiCommand {
     void printHelp();
     int initialize(const std::vector<std::string> &allArgs);
     int showResults();
-    int singleBuild(size_t numArgs, const std::vector<std::string> &allArgs);
+
+    struct SingleBuild {
+        std::vector<std::string> args;
+        std::string outFileName;
+        int retVal = ErrorCode::SUCCESS;
+        bool isCommandLineSplit = false;
+        std::unique_ptr<OfflineCompiler> compiler;
+    };
+    void singleBuild(SingleBuild &build);
+    void reportSingleBuild(SingleBuild &build, size_t buildId);
     std::string eraseExtensionFromPath(std::string &filePath);
     std::string OutFileName;
 
@@ -48,6 +59,7 @@ class MultiCommand {
     std::string pathToCMD;
     std::vector<std::string> lines;
     bool quiet = false;
+    uint32_t jobsCount = 1u;
 
     MultiCommand();
 };
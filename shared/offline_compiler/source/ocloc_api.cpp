@@ -31,6 +31,8 @@ Commands:
   disasm                Disassembles Intel OpenCL GPU device binary.
   asm                   Assembles Intel OpenCL GPU device binary.
   multi                 Compiles multiple files using a config file.
+  decode_log            Converts binary log of the runtime to text.
+  decode_aub            Restores compressed AUB file for replay.
 
 Default command (when none provided) is 'compile'.
 
@@ -43,6 +45,12 @@ Examples:
 
   Assemble to Intel OpenCL GPU device binary (after above disasm)
     ocloc asm -out reassembled.bin
+
+  Decode binary log created with LogToBinaryFile debug flag
+    ocloc decode_log -file igdrcl.log.bin -out igdrcl.log
+
+  Restore AUB file created with AUBDumpCompression debug flag
+    ocloc decode_aub -file capture.aub -out capture_decoded.aub
 )===");
 }
 
@@ -83,6 +91,10 @@ int oclocInvoke(unsigned int numArgs, const char *argv[],
             int retValue = ErrorCode::SUCCESS;
             auto pMulti = std::unique_ptr<MultiCommand>(MultiCommand::create(allArgs, retValue));
             return retValue;
+        } else if (numArgs > 1 && !strcmp(argv[1], "decode_log")) {
+            return decodeBinaryLog(allArgs, helper.get());
+        } else if (numArgs > 1 && !strcmp(argv[1], "decode_aub")) {
+            return decodeCompressedAubFile(allArgs, helper.get());
         } else {
             int retVal = ErrorCode::SUCCESS;
             std::vector<std::string> allArgs;
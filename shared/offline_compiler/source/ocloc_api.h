@@ -8,6 +8,8 @@
 #include "shared/offline_compiler/source/decoder/binary_decoder.h"
 #include "shared/offline_compiler/source/decoder/binary_encoder.h"
 #include "shared/offline_compiler/source/multi_command.h"
+#include "shared/offline_compiler/source/ocloc_aub_decoder.h"
+#include "shared/offline_compiler/source/ocloc_log_decoder.h"
 #include "shared/offline_compiler/source/offline_compiler.h"
 
 using namespace NEO;
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/offline_compiler/source/ocloc_aub_decoder.h"
+
+#include "shared/offline_compiler/source/ocloc_arg_helper.h"
+#include "shared/offline_compiler/source/offline_compiler.h"
+
+#include "opencl/source/aub_mem_dump/aub_block_codec.h"
+
+#include <cstdio>
+
+namespace NEO {
+
+namespace {
+void printDecodeAubHelp() {
+    printf(R"===(Restores AUB file created with AUBDumpCompression debug flag, so that it can be replayed.
+
+Usage: ocloc decode_aub -file <file> -out <file>
+  -file <file>      Compressed AUB file to decode.
+
+  -out <file>       Output AUB file.
+)===");
+}
+} // namespace
+
+int decodeCompressedAubFile(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
+    std::string inputFile;
+    std::string outputFile;
+    for (size_t argIndex = 2; argIndex < args.size(); ++argIndex) {
+        const auto &currArg = args[argIndex];
+        const bool hasMoreArgs = (argIndex + 1 < args.size());
+        if ("-file" == currArg && hasMoreArgs) {
+            inputFile = args[++argIndex];
+        } else if ("-out" == currArg && hasMoreArgs) {
+            outputFile = args[++argIndex];
+        } else if ("--help" == currArg || "-h" == currArg) {
+            printDecodeAubHelp();
+            return ErrorCode::SUCCESS;
+        } else {
+            printf("Unknown argument %s\n", currArg.c_str());
+            printDecodeAubHelp();
+            return ErrorCode::INVALID_COMMAND_LINE;
+        }
+    }
+
+    if (inputFile.empty() || outputFile.empty()) {
+        printf("Error: Missing %s argument\n", inputFile.empty() ? "-file" : "-out");
+        printDecodeAubHelp();
+        return ErrorCode::INVALID_COMMAND_LINE;
+    }
+
+    if (false == argHelper->fileExists(inputFile)) {
+        printf("Error: Could not open file %s\n", inputFile.c_str());
+        return ErrorCode::INVALID_FILE;
+    }
+
+    auto compressedAub = argHelper->readBinaryFile(inputFile);
+    std::vector<uint8_t> aub;
+    if (false == AubMemDump::decodeCompressedAub(ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(compressedAub.data()), compressedAub.size()), aub)) {
+        printf("Error: %s is not a valid compressed AUB file\n", inputFile.c_str());
+        return ErrorCode::INVALID_FILE;
+    }
+
+    argHelper->saveOutput(outputFile, aub.data(), aub.size());
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace NEO
@@ -0,0 +1,20 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+class OclocArgHelper;
+
+namespace NEO {
+
+// Restores AUB file written with AUBDumpCompression debug flag
+int decodeCompressedAubFile(const std::vector<std::string> &args, OclocArgHelper *argHelper);
+
+} // namespace NEO
@@ -7,6 +7,7 @@
 
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
 
+#include "shared/offline_compiler/source/ocloc_parallel_build.h"
 #include "shared/offline_compiler/source/offline_compiler.h"
 #include "shared/offline_compiler/source/utilities/safety_caller.h"
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
@@ -19,6 +20,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <memory>
 #include <vector>
 
 namespace NEO {
@@ -208,6 +210,7 @@ int buildFatbinary(int argc, const char *argv[]) {
     std::string inputFileName = "";
     std::string outputFileName = "";
     std::string outputDirectory = "";
+    uint32_t jobsCount = 1u;
 
     std::vector<std::string> argsCopy;
     if (argc > 1) {
@@ -233,6 +236,12 @@ int buildFatbinary(int argc, const char *argv[]) {
         } else if ((ConstStringRef("-out_dir") == currArg) && hasMoreArgs) {
             outputDirectory = argv[argIndex + 1];
             ++argIndex;
+        } else if ((ConstStringRef("-j") == currArg) && hasMoreArgs) {
+            if (false == parseJobsCount(argv[argIndex + 1], jobsCount)) {
+                printf("Invalid number of jobs : %s\n", argv[argIndex + 1]);
+                return ErrorCode::INVALID_COMMAND_LINE;
+            }
+            ++argIndex;
         }
     }
 
@@ -245,36 +254,59 @@ int buildFatbinary(int argc, const char *argv[]) {
 
     NEO::Ar::ArEncoder fatbinary(true);
 
-    for (auto targetPlatform : targetPlatforms) {
+    // targets are built on a pool of jobsCount threads, results are reported and archived in targets order
+    FrontEndOutputCache frontEndOutputCache;
+    std::vector<std::unique_ptr<OfflineCompiler>> compilers(targetPlatforms.size());
+    std::vector<int> buildRetVals(targetPlatforms.size(), 0);
+
+    auto buildTarget = [&](size_t targetId) {
         int retVal = 0;
-        argsCopy[deviceArgIndex] = targetPlatform.str();
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argc, argsCopy, false, retVal)};
-        auto stepping = pCompiler->getHardwareInfo().platform.usRevId;
+        auto targetArgs = argsCopy;
+        targetArgs[deviceArgIndex] = targetPlatforms[targetId].str();
+        compilers[targetId].reset(OfflineCompiler::create(argc, targetArgs, false, retVal));
         if (retVal == 0) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+            compilers[targetId]->setFrontEndOutputCache(&frontEndOutputCache);
+            retVal = buildWithSafetyGuard(compilers[targetId].get());
+        }
+        buildRetVals[targetId] = retVal;
+    };
 
-            std::string buildLog = pCompiler->getBuildLog();
-            if (buildLog.empty() == false) {
-                printf("%s\n", buildLog.c_str());
-            }
+    int fatbinaryRetVal = 0;
+    auto archiveTarget = [&](size_t targetId) {
+        auto targetPlatform = targetPlatforms[targetId];
+        int retVal = buildRetVals[targetId];
+        std::unique_ptr<OfflineCompiler> pCompiler = std::move(compilers[targetId]);
+        if (pCompiler == nullptr) {
+            fatbinaryRetVal = retVal;
+            return false;
+        }
 
-            if (retVal == 0) {
-                if (!pCompiler->isQuiet())
-                    printf("Build succeeded for : %s.\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str());
-            } else {
-                printf("Build failed for : %s with error code: %d\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str(), retVal);
-                printf("Command was:");
-                for (auto i = 0; i < argc; ++i)
-                    printf(" %s", argv[i]);
-                printf("\n");
-            }
+        auto stepping = pCompiler->getHardwareInfo().platform.usRevId;
+        std::string buildLog = pCompiler->getBuildLog();
+        if (buildLog.empty() == false) {
+            printf("%s\n", buildLog.c_str());
         }
 
-        if (0 != retVal) {
-            return retVal;
+        if (retVal == 0) {
+            if (!pCompiler->isQuiet())
+                printf("Build succeeded for : %s.\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str());
+        } else {
+            printf("Build failed for : %s with error code: %d\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str(), retVal);
+            printf("Command was:");
+            for (auto i = 0; i < argc; ++i)
+                printf(" %s", argv[i]);
+            printf("\n");
+            fatbinaryRetVal = retVal;
+            return false;
         }
 
         fatbinary.appendFileEntry(pointerSizeInBits + "." + targetPlatform.str() + "." + std::to_string(stepping), pCompiler->getPackedDeviceBinaryOutput());
+        return true;
+    };
+
+    runBuildsInOrder(targetPlatforms.size(), jobsCount, buildTarget, archiveTarget);
+    if (0 != fatbinaryRetVal) {
+        return fatbinaryRetVal;
     }
 
     auto fatbinaryData = fatbinary.encode();
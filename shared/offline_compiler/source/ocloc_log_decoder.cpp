@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/offline_compiler/source/ocloc_log_decoder.h"
+
+#include "shared/offline_compiler/source/ocloc_arg_helper.h"
+#include "shared/offline_compiler/source/offline_compiler.h"
+#include "shared/source/utilities/binary_log.h"
+
+#include <cstdio>
+
+namespace NEO {
+
+namespace {
+void printDecodeLogHelp() {
+    printf(R"===(Converts binary log created with LogToBinaryFile debug flag to text.
+
+Usage: ocloc decode_log -file <file> [-out <file>]
+  -file <file>      Binary log file to decode.
+
+  -out <file>       Optional output file, decoded log is printed to
+                    standard output when not provided.
+)===");
+}
+} // namespace
+
+int decodeBinaryLog(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
+    std::string inputFile;
+    std::string outputFile;
+    for (size_t argIndex = 2; argIndex < args.size(); ++argIndex) {
+        const auto &currArg = args[argIndex];
+        const bool hasMoreArgs = (argIndex + 1 < args.size());
+        if ("-file" == currArg && hasMoreArgs) {
+            inputFile = args[++argIndex];
+        } else if ("-out" == currArg && hasMoreArgs) {
+            outputFile = args[++argIndex];
+        } else if ("--help" == currArg || "-h" == currArg) {
+            printDecodeLogHelp();
+            return ErrorCode::SUCCESS;
+        } else {
+            printf("Unknown argument %s\n", currArg.c_str());
+            printDecodeLogHelp();
+            return ErrorCode::INVALID_COMMAND_LINE;
+        }
+    }
+
+    if (inputFile.empty()) {
+        printf("Error: Missing -file argument\n");
+        printDecodeLogHelp();
+        return ErrorCode::INVALID_COMMAND_LINE;
+    }
+
+    if (false == argHelper->fileExists(inputFile)) {
+        printf("Error: Could not open file %s\n", inputFile.c_str());
+        return ErrorCode::INVALID_FILE;
+    }
+
+    auto binaryLog = argHelper->readBinaryFile(inputFile);
+    std::string text;
+    if (false == BinaryLog::decode(ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(binaryLog.data()), binaryLog.size()), text)) {
+        printf("Error: %s is not a valid binary log\n", inputFile.c_str());
+        return ErrorCode::INVALID_FILE;
+    }
+
+    if (outputFile.empty()) {
+        printf("%s", text.c_str());
+    } else {
+        argHelper->saveOutput(outputFile, text.c_str(), text.size());
+    }
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace NEO
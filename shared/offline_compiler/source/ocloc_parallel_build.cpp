@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/offline_compiler/source/ocloc_parallel_build.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <thread>
+
+namespace NEO {
+
+bool parseJobsCount(const std::string &value, uint32_t &jobsCount) {
+    if (value.empty() || value.size() > 4 || false == std::all_of(value.begin(), value.end(), [](char c) { return 0 != std::isdigit(static_cast<unsigned char>(c)); })) {
+        return false;
+    }
+    jobsCount = static_cast<uint32_t>(std::atoi(value.c_str()));
+    if (jobsCount == 0) {
+        jobsCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return true;
+}
+
+void runBuildsInOrder(size_t numTasks, uint32_t jobsCount, const std::function<void(size_t)> &build, const std::function<bool(size_t)> &report) {
+    auto numThreads = static_cast<size_t>(std::min<size_t>(jobsCount, numTasks));
+    if (numThreads <= 1) {
+        for (size_t taskId = 0; taskId < numTasks; taskId++) {
+            build(taskId);
+            if (false == report(taskId)) {
+                break;
+            }
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextTask{0u};
+    std::atomic<bool> cancelled{false};
+    std::mutex mtx;
+    std::condition_variable taskDone;
+    std::vector<bool> done(numTasks, false);
+
+    auto worker = [&]() {
+        for (auto taskId = nextTask++; taskId < numTasks && false == cancelled.load(); taskId = nextTask++) {
+            build(taskId);
+            std::lock_guard<std::mutex> lock(mtx);
+            done[taskId] = true;
+            taskDone.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++) {
+        threads.emplace_back(worker);
+    }
+
+    for (size_t taskId = 0; taskId < numTasks; taskId++) {
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            taskDone.wait(lock, [&]() { return done[taskId]; });
+        }
+        if (false == report(taskId)) {
+            cancelled = true;
+            break;
+        }
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+std::string FrontEndOutputCache::getKey(uint64_t irType, uint32_t oclApiVersion, const std::string &source,
+                                        const std::string &options, const std::string &internalOptions) {
+    std::string key = std::to_string(irType) + ":" + std::to_string(oclApiVersion) + ":" +
+                      std::to_string(options.size()) + ":" + options + ":" +
+                      std::to_string(internalOptions.size()) + ":" + internalOptions + ":";
+    key.append(source);
+    return key;
+}
+
+bool FrontEndOutputCache::lookupOrReserve(const std::string &key, Output &output) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto entry = entries.find(key);
+    if (entry == entries.end()) {
+        entries.emplace(key, Entry{});
+        return false;
+    }
+
+    // references to elements stay valid when other keys are inserted meanwhile
+    auto &cachedEntry = entry->second;
+    entryReady.wait(lock, [&]() { return cachedEntry.ready; });
+    if (false == cachedEntry.output.successful) {
+        // let the caller translate on its own to get its own build log
+        return false;
+    }
+    output = cachedEntry.output;
+    hits++;
+    return true;
+}
+
+void FrontEndOutputCache::store(const std::string &key, Output output) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &entry = entries[key];
+    entry.output = std::move(output);
+    entry.ready = true;
+    entryReady.notify_all();
+}
+
+} // namespace NEO
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+
+// value of "-j" option, 0 selects number of hardware threads
+bool parseJobsCount(const std::string &value, uint32_t &jobsCount);
+
+// Runs build(id) for all tasks on up to jobsCount threads.
+// report(id) is called on the calling thread in tasks order, as soon as given task is built.
+// When report returns false, tasks that did not start yet are skipped.
+void runBuildsInOrder(size_t numTasks, uint32_t jobsCount, const std::function<void(size_t)> &build, const std::function<bool(size_t)> &report);
+
+// Shares front end (OpenCL C -> IR) results between builds of the same source for different targets.
+class FrontEndOutputCache {
+  public:
+    struct Output {
+        bool successful = false;
+        std::vector<char> ir;
+        std::string buildLog;
+    };
+
+    static std::string getKey(uint64_t irType, uint32_t oclApiVersion, const std::string &source,
+                              const std::string &options, const std::string &internalOptions);
+
+    // true - output was produced by another build (waits for builds in flight)
+    // false - caller should translate the source and store the result
+    bool lookupOrReserve(const std::string &key, Output &output);
+    void store(const std::string &key, Output output);
+
+    uint32_t getHits() const { return hits.load(); }
+
+  protected:
+    struct Entry {
+        bool ready = false;
+        Output output;
+    };
+
+    std::mutex mtx;
+    std::condition_variable entryReady;
+    std::unordered_map<std::string, Entry> entries;
+    std::atomic<uint32_t> hits{0u};
+};
+
+} // namespace NEO
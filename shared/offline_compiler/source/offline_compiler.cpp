@@ -7,6 +7,7 @@
 
 #include "offline_compiler.h"
 
+#include "shared/offline_compiler/source/ocloc_parallel_build.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
@@ -137,28 +138,54 @@ int OfflineCompiler::buildSourceCode() {
                 break;
             }
 
-            auto fclOutput = fclTranslationCtx->Translate(fclSrc.get(), fclOptions.get(),
-                                                          fclInternalOptions.get(), nullptr, 0);
-
-            if (fclOutput == nullptr) {
-                retVal = OUT_OF_HOST_MEMORY;
-                break;
+            std::string frontEndOutputKey;
+            FrontEndOutputCache::Output frontEndOutput;
+            bool isFrontEndOutputCached = false;
+            if (frontEndOutputCache) {
+                frontEndOutputKey = FrontEndOutputCache::getKey(intermediateRepresentation, hwInfo->capabilityTable.clVersionSupport,
+                                                                sourceCode, options, internalOptions);
+                isFrontEndOutputCached = frontEndOutputCache->lookupOrReserve(frontEndOutputKey, frontEndOutput);
             }
 
-            UNRECOVERABLE_IF(fclOutput->GetBuildLog() == nullptr);
-            UNRECOVERABLE_IF(fclOutput->GetOutput() == nullptr);
+            if (false == isFrontEndOutputCached) {
+                auto fclOutput = fclTranslationCtx->Translate(fclSrc.get(), fclOptions.get(),
+                                                              fclInternalOptions.get(), nullptr, 0);
+
+                if (fclOutput == nullptr) {
+                    if (frontEndOutputCache) {
+                        frontEndOutputCache->store(frontEndOutputKey, {});
+                    }
+                    retVal = OUT_OF_HOST_MEMORY;
+                    break;
+                }
+
+                UNRECOVERABLE_IF(fclOutput->GetBuildLog() == nullptr);
+                UNRECOVERABLE_IF(fclOutput->GetOutput() == nullptr);
+
+                auto buildLogData = fclOutput->GetBuildLog()->GetMemory<char>();
+                frontEndOutput.buildLog.assign(buildLogData, buildLogData + fclOutput->GetBuildLog()->GetSizeRaw());
+                frontEndOutput.successful = fclOutput->Successful();
+                if (frontEndOutput.successful) {
+                    auto irData = fclOutput->GetOutput()->GetMemory<char>();
+                    frontEndOutput.ir.assign(irData, irData + fclOutput->GetOutput()->GetSizeRaw());
+                }
+                if (frontEndOutputCache) {
+                    frontEndOutputCache->store(frontEndOutputKey, frontEndOutput);
+                }
+            }
 
-            if (fclOutput->Successful() == false) {
-                updateBuildLog(fclOutput->GetBuildLog()->GetMemory<char>(), fclOutput->GetBuildLog()->GetSizeRaw());
+            if (false == frontEndOutput.successful) {
+                updateBuildLog(frontEndOutput.buildLog.c_str(), frontEndOutput.buildLog.size());
                 retVal = BUILD_PROGRAM_FAILURE;
                 break;
             }
 
-            storeBinary(irBinary, irBinarySize, fclOutput->GetOutput()->GetMemory<char>(), fclOutput->GetOutput()->GetSizeRaw());
+            storeBinary(irBinary, irBinarySize, frontEndOutput.ir.data(), frontEndOutput.ir.size());
             isSpirV = intermediateRepresentation == IGC::CodeType::spirV;
-            updateBuildLog(fclOutput->GetBuildLog()->GetMemory<char>(), fclOutput->GetBuildLog()->GetSizeRaw());
+            updateBuildLog(frontEndOutput.buildLog.c_str(), frontEndOutput.buildLog.size());
 
-            igcOutput = igcTranslationCtx->Translate(fclOutput->GetOutput(), fclOptions.get(),
+            auto igcSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), frontEndOutput.ir.data(), frontEndOutput.ir.size());
+            igcOutput = igcTranslationCtx->Translate(igcSrc.get(), fclOptions.get(),
                                                      fclInternalOptions.get(),
                                                      nullptr, 0);
 
@@ -501,6 +528,15 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
         } else if (("-out_dir" == currArg) && hasMoreArgs) {
             outputDirectory = argv[argIndex + 1];
             argIndex++;
+        } else if (("-j" == currArg) && hasMoreArgs) {
+            // consumed by fatbinary and multi command builds
+            uint32_t jobsCount = 0u;
+            if (false == parseJobsCount(argv[argIndex + 1], jobsCount)) {
+                printf("Invalid number of jobs : %s\n", argv[argIndex + 1].c_str());
+                retVal = INVALID_COMMAND_LINE;
+                break;
+            }
+            argIndex++;
         } else if ("-q" == currArg) {
             quiet = true;
         } else if ("-output_no_suffix" == currArg) {
@@ -643,7 +679,7 @@ void OfflineCompiler::printUsage() {
 Additionally, outputs intermediate representation (e.g. spirV).
 Different input and intermediate file formats are available.
 
-Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename>] [-out_dir <output_dir>] [-options <options>] [-32|-64] [-internal_options <options>] [-llvm_text|-llvm_input|-spirv_input] [-options_name] [-q] [-cpp_file] [-output_no_suffix] [--help]
+Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename>] [-out_dir <output_dir>] [-options <options>] [-32|-64] [-internal_options <options>] [-llvm_text|-llvm_input|-spirv_input] [-options_name] [-q] [-cpp_file] [-output_no_suffix] [-j <jobs>] [--help]
 
   -file <filename>              The input file to be compiled
                                 (by default input source format is
@@ -742,6 +778,11 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
 
   -output_no_suffix             Prevents ocloc from adding family name suffix.
 
+  -j <jobs>                     Number of targets built in parallel when
+                                multiple target devices are provided.
+                                0 - use all hardware threads.
+                                Default is 1.
+
   --help                        Print this usage message.
 
 Examples :
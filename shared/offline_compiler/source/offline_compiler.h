@@ -23,6 +23,7 @@
 namespace NEO {
 
 struct HardwareInfo;
+class FrontEndOutputCache;
 class OsLibrary;
 
 std::string convertToPascalCase(const std::string &inString);
@@ -70,6 +71,10 @@ class OfflineCompiler {
         return *hwInfo;
     }
 
+    void setFrontEndOutputCache(FrontEndOutputCache *cache) {
+        frontEndOutputCache = cache;
+    }
+
   protected:
     OfflineCompiler();
 
@@ -137,5 +142,6 @@ class OfflineCompiler {
     IGC::CodeType::CodeType_t preferredIntermediateRepresentation;
 
     std::unique_ptr<OclocArgHelper> argHelper = nullptr;
+    FrontEndOutputCache *frontEndOutputCache = nullptr;
 };
 } // namespace NEO
@@ -14,7 +14,7 @@
 #include <setjmp.h>
 #include <signal.h>
 
-static jmp_buf jmpbuf;
+static thread_local jmp_buf jmpbuf; // per thread, builds may run in parallel
 
 class SafetyGuardLinux {
   public:
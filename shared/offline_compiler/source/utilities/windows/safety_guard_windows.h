@@ -11,7 +11,7 @@
 
 #include <setjmp.h>
 
-static jmp_buf jmpbuf;
+static thread_local jmp_buf jmpbuf; // per thread, builds may run in parallel
 
 class SafetyGuardWindows {
   public:
@@ -7,26 +7,60 @@
 
 #include "shared/source/compiler_interface/compiler_cache.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/file_io.h"
-#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hash128.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/os_interface/os_file_lock.h"
+#include "shared/source/os_interface/os_mapped_file.h"
 #include "shared/source/utilities/debug_settings_reader.h"
+#include "shared/source/utilities/directory.h"
 
 #include "config.h"
 #include "os_inc.h"
 
+#include <chrono>
+#include <cstdio>
 #include <cstring>
-#include <iomanip>
+#include <functional>
+#include <iterator>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace NEO {
-std::mutex CompilerCache::cacheAccessMtx;
+namespace {
+struct CacheIndexHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t numEntries;
+    uint32_t reserved;
+};
+
+struct CacheIndexEntry {
+    uint64_t size;
+    uint32_t keyLength;
+    uint32_t reserved;
+};
+
+std::string getUniqueTempSuffix() {
+    static std::atomic<uint64_t> counter{0u};
+    uint64_t token = std::hash<std::thread::id>()(std::this_thread::get_id());
+    token ^= static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    token ^= (++counter) << 48;
+
+    std::stringstream stream;
+    stream << "." << std::hex << token << ".tmp";
+    return stream.str();
+}
+} // namespace
+
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
-    Hash hash;
+    Hash128 hash;
 
     hash.update("----", 4);
     hash.update(&*input.begin(), input.size());
@@ -42,32 +76,340 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     hash.update("----", 4);
     hash.update(reinterpret_cast<const char *>(&hwInfo.workaroundTable), sizeof(hwInfo.workaroundTable));
 
-    auto res = hash.finish();
-    std::stringstream stream;
-    stream << std::setfill('0')
-           << std::setw(sizeof(res) * 2)
-           << std::hex
-           << res;
-    return stream.str();
+    return hash.finish().toString();
 }
 
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
     : config(cacheConfig){};
 
+CompilerCache::~CompilerCache() {
+    std::vector<std::string> victims;
+    {
+        std::lock_guard<std::mutex> lock(indexMtx);
+        if (indexDirty) {
+            storeIndex(victims);
+        }
+    }
+    removeFiles(victims);
+}
+
 bool CompilerCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
     if (pBinary == nullptr || binarySize == 0) {
         return false;
     }
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return 0 != writeDataToFile(filePath.c_str(), pBinary, binarySize);
+    std::string filePath = getFilePath(kernelFileHash);
+    {
+        std::lock_guard<std::mutex> lock(getShardMutex(kernelFileHash));
+        if (false == publishFile(filePath, pBinary, binarySize, false)) {
+            return false;
+        }
+    }
+    statistics.bytesStored += binarySize;
+
+    recordAccess(kernelFileHash, binarySize);
+
+    // size limit is kept within this cache on every store, while binaries published
+    // by other processes sharing the cache directory are accounted for in batches
+    std::vector<std::string> victims;
+    {
+        std::lock_guard<std::mutex> lock(indexMtx);
+        evict(victims);
+        if (++storesSinceIndexStored >= indexStoreInterval) {
+            storeIndex(victims);
+        }
+    }
+    removeFiles(victims);
+    return true;
 }
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) {
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+    std::string filePath = getFilePath(kernelFileHash);
+
+    std::unique_ptr<char[]> ret;
+    {
+        std::lock_guard<std::mutex> lock(getShardMutex(kernelFileHash));
+        ret = loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    }
+
+    if (ret == nullptr) {
+        statistics.misses++;
+        forget(kernelFileHash);
+        return ret;
+    }
+    statistics.hits++;
+    statistics.bytesLoaded += cachedBinarySize;
+
+    recordAccess(kernelFileHash, cachedBinarySize);
+    return ret;
+}
+
+std::unique_ptr<OsMappedFile> CompilerCache::mapCachedBinary(const std::string kernelFileHash) {
+    std::string filePath = getFilePath(kernelFileHash);
+
+    std::unique_ptr<OsMappedFile> ret;
+    {
+        std::lock_guard<std::mutex> lock(getShardMutex(kernelFileHash));
+        ret = OsMappedFile::open(filePath);
+    }
+
+    if (ret == nullptr) {
+        statistics.misses++;
+        forget(kernelFileHash);
+        return ret;
+    }
+    auto mappedSize = ret->getData().size();
+    statistics.hits++;
+    statistics.bytesLoaded += mappedSize;
+
+    recordAccess(kernelFileHash, mappedSize);
+    return ret;
+}
+
+uint64_t CompilerCache::getUsedBytes() {
+    ensureIndexLoaded();
+    std::lock_guard<std::mutex> lock(indexMtx);
+    return usedBytes;
+}
+
+std::string CompilerCache::getFilePath(const std::string &kernelFileHash) const {
+    return config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+}
+
+std::string CompilerCache::getIndexFilePath() const {
+    return config.cacheDir + PATH_SEPARATOR + "index" + config.cacheFileExtension + "_index";
+}
+
+std::string CompilerCache::getIndexLockFilePath() const {
+    return config.cacheDir + PATH_SEPARATOR + "index" + config.cacheFileExtension + "_lock";
+}
+
+std::mutex &CompilerCache::getShardMutex(const std::string &kernelFileHash) {
+    return shardMutexes[std::hash<std::string>()(kernelFileHash) % numShards];
+}
+
+bool CompilerCache::publishFile(const std::string &filePath, const char *pData, size_t dataSize, bool overwrite) {
+    // write to a private file first and rename it, so concurrent readers
+    // (also from other processes) never observe partially written binaries
+    std::string tempPath = filePath + getUniqueTempSuffix();
+    if (dataSize != writeDataToFile(tempPath.c_str(), pData, dataSize)) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    if (0 != std::rename(tempPath.c_str(), filePath.c_str())) {
+        if (overwrite) {
+            std::remove(filePath.c_str());
+            if (0 == std::rename(tempPath.c_str(), filePath.c_str())) {
+                return true;
+            }
+        }
+        std::remove(tempPath.c_str());
+        // destination already published by another writer
+        return fileExists(filePath);
+    }
+    return true;
+}
+
+void CompilerCache::ensureIndexLoaded() {
+    std::lock_guard<std::mutex> lock(indexMtx);
+    if (indexLoaded) {
+        return;
+    }
+    indexLoaded = true;
+    loadIndex();
+    indexUnlistedFiles();
+}
+
+void CompilerCache::loadIndex() {
+    size_t indexSize = 0u;
+    auto indexData = loadDataFromFile(getIndexFilePath().c_str(), indexSize);
+    if (indexData == nullptr || indexSize < sizeof(CacheIndexHeader)) {
+        return;
+    }
+
+    CacheIndexHeader header = {};
+    memcpy(&header, indexData.get(), sizeof(header));
+    if (header.magic != indexMagic || header.version != indexVersion) {
+        return;
+    }
+
+    size_t offset = sizeof(CacheIndexHeader);
+    for (uint32_t i = 0; i < header.numEntries; i++) {
+        if (offset + sizeof(CacheIndexEntry) > indexSize) {
+            break;
+        }
+        CacheIndexEntry entry = {};
+        memcpy(&entry, indexData.get() + offset, sizeof(entry));
+        offset += sizeof(CacheIndexEntry);
+        if (offset + entry.keyLength > indexSize) {
+            break;
+        }
+        std::string key(indexData.get() + offset, entry.keyLength);
+        offset += entry.keyLength;
+
+        if (cacheIndex.find(key) != cacheIndex.end()) {
+            continue;
+        }
+        // entries are stored from least to most recently used
+        lruList.push_back(key);
+        cacheIndex[key] = {entry.size, std::prev(lruList.end())};
+        usedBytes += entry.size;
+    }
+}
+
+std::unique_ptr<OsFileLock> CompilerCache::lockIndexFile() {
+    return OsFileLock::lock(getIndexLockFilePath());
+}
 
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+bool CompilerCache::storeIndex(std::vector<std::string> &victims) {
+    storesSinceIndexStored = 0u;
+
+    // processes sharing the cache directory merge their changes into the index file one at a time
+    auto indexFileLock = lockIndexFile();
+    if (indexFileLock == nullptr) {
+        // changes are kept and merged with the next store
+        printDebugString(DebugManager.flags.PrintDebugMessages.get(), stderr, "Compiler cache index lock %s could not be taken\n", getIndexLockFilePath().c_str());
+        return false;
+    }
+
+    std::unordered_map<std::string, IndexEntry> ownIndex;
+    std::list<std::string> ownLruList;
+    ownIndex.swap(cacheIndex);
+    ownLruList.swap(lruList);
+    usedBytes = 0u;
+    loadIndex();
+
+    for (auto &key : removedKeys) {
+        auto it = cacheIndex.find(key);
+        if (it != cacheIndex.end()) {
+            usedBytes -= it->second.size;
+            lruList.erase(it->second.lruPosition);
+            cacheIndex.erase(it);
+        }
+    }
+    // binaries not listed by any index are the least recently used ones
+    for (auto key = ownLruList.rbegin(); key != ownLruList.rend(); ++key) {
+        if (unlistedKeys.find(*key) != unlistedKeys.end() && cacheIndex.find(*key) == cacheIndex.end()) {
+            lruList.push_front(*key);
+            cacheIndex[*key] = {ownIndex[*key].size, lruList.begin()};
+            usedBytes += ownIndex[*key].size;
+        }
+    }
+    for (auto &key : ownLruList) {
+        if (accessedKeys.find(key) == accessedKeys.end()) {
+            continue;
+        }
+        auto it = cacheIndex.find(key);
+        if (it != cacheIndex.end()) {
+            usedBytes -= it->second.size;
+            lruList.erase(it->second.lruPosition);
+        }
+        lruList.push_back(key);
+        cacheIndex[key] = {ownIndex[key].size, std::prev(lruList.end())};
+        usedBytes += ownIndex[key].size;
+    }
+    evict(victims);
+    accessedKeys.clear();
+    removedKeys.clear();
+    unlistedKeys.clear();
+
+    std::vector<char> data(sizeof(CacheIndexHeader));
+    CacheIndexHeader header = {indexMagic, indexVersion, static_cast<uint32_t>(lruList.size()), 0u};
+    memcpy(data.data(), &header, sizeof(header));
+    for (auto &key : lruList) {
+        CacheIndexEntry entry = {cacheIndex[key].size, static_cast<uint32_t>(key.size()), 0u};
+        auto pos = data.size();
+        data.resize(pos + sizeof(entry) + key.size());
+        memcpy(data.data() + pos, &entry, sizeof(entry));
+        memcpy(data.data() + pos + sizeof(entry), key.data(), key.size());
+    }
+
+    indexDirty = false;
+    return publishFile(getIndexFilePath(), data.data(), data.size(), true);
+}
+
+void CompilerCache::indexUnlistedFiles() {
+    // binaries left by processes that were terminated before storing the index
+    // still count against the cache size limit
+    if (config.cacheFileExtension.empty()) {
+        return;
+    }
+    auto prefixLength = config.cacheDir.size() + 1;
+    auto extensionLength = config.cacheFileExtension.size();
+    for (auto &filePath : Directory::getFiles(config.cacheDir)) {
+        if (filePath.size() <= prefixLength + extensionLength ||
+            0 != filePath.compare(filePath.size() - extensionLength, extensionLength, config.cacheFileExtension)) {
+            continue;
+        }
+        auto key = filePath.substr(prefixLength, filePath.size() - prefixLength - extensionLength);
+        if (cacheIndex.find(key) != cacheIndex.end()) {
+            continue;
+        }
+        auto size = static_cast<uint64_t>(getFileSize(filePath));
+        lruList.push_front(key);
+        cacheIndex[key] = {size, lruList.begin()};
+        usedBytes += size;
+        unlistedKeys.insert(key);
+        indexDirty = true;
+    }
+}
+
+void CompilerCache::recordAccess(const std::string &kernelFileHash, uint64_t size) {
+    ensureIndexLoaded();
+    std::lock_guard<std::mutex> lock(indexMtx);
+    auto it = cacheIndex.find(kernelFileHash);
+    if (it != cacheIndex.end()) {
+        usedBytes -= it->second.size;
+        it->second.size = size;
+        lruList.splice(lruList.end(), lruList, it->second.lruPosition);
+    } else {
+        lruList.push_back(kernelFileHash);
+        cacheIndex[kernelFileHash] = {size, std::prev(lruList.end())};
+    }
+    usedBytes += size;
+    accessedKeys.insert(kernelFileHash);
+    removedKeys.erase(kernelFileHash);
+    indexDirty = true;
+}
+
+void CompilerCache::forget(const std::string &kernelFileHash) {
+    ensureIndexLoaded();
+    std::lock_guard<std::mutex> lock(indexMtx);
+    auto it = cacheIndex.find(kernelFileHash);
+    if (it != cacheIndex.end()) {
+        usedBytes -= it->second.size;
+        lruList.erase(it->second.lruPosition);
+        cacheIndex.erase(it);
+        accessedKeys.erase(kernelFileHash);
+        removedKeys.insert(kernelFileHash);
+        indexDirty = true;
+    }
+}
+
+void CompilerCache::evict(std::vector<std::string> &victims) {
+    if (config.cacheSize == 0u) {
+        return;
+    }
+
+    while (usedBytes > config.cacheSize && lruList.size() > 1) {
+        auto victim = lruList.front();
+        lruList.pop_front();
+        usedBytes -= cacheIndex[victim].size;
+        cacheIndex.erase(victim);
+        accessedKeys.erase(victim);
+        unlistedKeys.erase(victim);
+        removedKeys.insert(victim);
+        indexDirty = true;
+        victims.push_back(std::move(victim));
+        statistics.evictions++;
+    }
+}
+
+void CompilerCache::removeFiles(const std::vector<std::string> &keys) {
+    // called without index locks held, so that file removal does not stall other users of the cache
+    for (auto &key : keys) {
+        std::lock_guard<std::mutex> lock(getShardMutex(key));
+        std::remove(getFilePath(key).c_str());
+    }
 }
 
 } // namespace NEO
@@ -9,19 +9,37 @@
 
 #include "shared/source/utilities/arrayref.h"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace NEO {
 struct HardwareInfo;
+class OsFileLock;
+class OsMappedFile;
 
 struct CompilerCacheConfig {
     bool enabled = true;
     std::string cacheFileExtension;
     std::string cacheDir;
+    size_t cacheSize = 0u; // 0 - no limit
+    bool mapCachedBinaries = false;
+};
+
+struct CompilerCacheStatistics {
+    std::atomic<uint64_t> hits{0u};
+    std::atomic<uint64_t> misses{0u};
+    std::atomic<uint64_t> bytesLoaded{0u};
+    std::atomic<uint64_t> bytesStored{0u};
+    std::atomic<uint64_t> evictions{0u};
 };
 
 class CompilerCache {
@@ -30,7 +48,7 @@ class CompilerCache {
                                                ArrayRef<const char> options, ArrayRef<const char> internalOptions);
 
     CompilerCache(const CompilerCacheConfig &config);
-    virtual ~CompilerCache() = default;
+    virtual ~CompilerCache();
 
     CompilerCache(const CompilerCache &) = delete;
     CompilerCache(CompilerCache &&) = delete;
@@ -39,9 +57,57 @@ class CompilerCache {
 
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize);
+    MOCKABLE_VIRTUAL std::unique_ptr<OsMappedFile> mapCachedBinary(const std::string kernelFileHash);
+
+    bool isMappingEnabled() const { return config.mapCachedBinaries; }
+
+    const CompilerCacheStatistics &getStatistics() const { return statistics; }
+    uint64_t getUsedBytes();
+
+    static constexpr uint32_t indexMagic = 0x494c4358; // "XCLI"
+    static constexpr uint32_t indexVersion = 1u;
+    static constexpr size_t numShards = 16u;
+    static constexpr uint32_t defaultIndexStoreInterval = 16u;
 
   protected:
-    static std::mutex cacheAccessMtx;
+    struct IndexEntry {
+        uint64_t size;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    std::string getFilePath(const std::string &kernelFileHash) const;
+    std::string getIndexFilePath() const;
+    std::string getIndexLockFilePath() const;
+    std::mutex &getShardMutex(const std::string &kernelFileHash);
+
+    void ensureIndexLoaded();
+    void recordAccess(const std::string &kernelFileHash, uint64_t size);
+    void forget(const std::string &kernelFileHash);
+    void indexUnlistedFiles();
+    void evict(std::vector<std::string> &victims);
+    void removeFiles(const std::vector<std::string> &keys);
+    MOCKABLE_VIRTUAL bool publishFile(const std::string &filePath, const char *pData, size_t dataSize, bool overwrite);
+    MOCKABLE_VIRTUAL std::unique_ptr<OsFileLock> lockIndexFile();
+    MOCKABLE_VIRTUAL void loadIndex();
+    MOCKABLE_VIRTUAL bool storeIndex(std::vector<std::string> &victims);
+
     CompilerCacheConfig config;
+    CompilerCacheStatistics statistics;
+
+    std::array<std::mutex, numShards> shardMutexes;
+
+    std::mutex indexMtx;
+    std::unordered_map<std::string, IndexEntry> cacheIndex;
+    std::list<std::string> lruList; // front - least recently used
+    // changes made by this cache since the index was last stored, merged with the index file on store
+    std::unordered_set<std::string> accessedKeys;
+    std::unordered_set<std::string> removedKeys;
+    std::unordered_set<std::string> unlistedKeys;
+    uint64_t usedBytes = 0u;
+    // index file is shared by all processes using the cache directory, so it is merged with in batches
+    uint32_t indexStoreInterval = defaultIndexStoreInterval;
+    uint32_t storesSinceIndexStored = 0u;
+    bool indexLoaded = false;
+    bool indexDirty = false;
 };
 } // namespace NEO
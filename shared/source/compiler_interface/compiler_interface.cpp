@@ -70,8 +70,7 @@ TranslationOutput::ErrorCode CompilerInterface::build(
                                                           input.src,
                                                           input.apiOptions,
                                                           input.internalOptions);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
-        if (output.deviceBinary.mem) {
+        if (loadFromCache(kernelFileHash, output)) {
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -116,8 +115,7 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
                                                           input.apiOptions,
                                                           input.internalOptions);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
-        if (output.deviceBinary.mem) {
+        if (loadFromCache(kernelFileHash, output)) {
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -147,6 +145,15 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     return TranslationOutput::ErrorCode::Success;
 }
 
+bool CompilerInterface::loadFromCache(const std::string &kernelFileHash, TranslationOutput &output) {
+    if (cache->isMappingEnabled()) {
+        output.mappedDeviceBinary = cache->mapCachedBinary(kernelFileHash);
+        return nullptr != output.mappedDeviceBinary;
+    }
+    output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
+    return nullptr != output.deviceBinary.mem;
+}
+
 TranslationOutput::ErrorCode CompilerInterface::compile(
     const NEO::Device &device,
     const TranslationInput &input,
@@ -10,6 +10,7 @@
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/os_library.h"
+#include "shared/source/os_interface/os_mapped_file.h"
 #include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/spinlock.h"
 
@@ -66,6 +67,7 @@ struct TranslationOutput {
     IGC::CodeType::CodeType_t intermediateCodeType = IGC::CodeType::invalid;
     MemAndSize intermediateRepresentation;
     MemAndSize deviceBinary;
+    std::unique_ptr<OsMappedFile> mappedDeviceBinary; // set instead of deviceBinary on compiler cache hits in mapping mode
     MemAndSize debugData;
     std::string frontendCompilerLog;
     std::string backendCompilerLog;
@@ -141,6 +143,7 @@ class CompilerInterface {
     MOCKABLE_VIRTUAL bool initialize(std::unique_ptr<CompilerCache> cache, bool requireFcl);
     MOCKABLE_VIRTUAL bool loadFcl();
     MOCKABLE_VIRTUAL bool loadIgc();
+    bool loadFromCache(const std::string &kernelFileHash, TranslationOutput &output);
 
     static SpinLock spinlock;
     MOCKABLE_VIRTUAL std::unique_lock<SpinLock> lock() {
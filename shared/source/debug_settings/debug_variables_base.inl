@@ -27,11 +27,15 @@ DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegister, 0, "Override mmio o
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegisterValue, 0, "Value to override mmio offset from AubDumpOverrideMmioRegister")
 DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, -1, "Set command stream receiver to: 0 - HW, 1 - AUB, 2 - TBX, 3 - HW & AUB, 4 - TBX & AUB")
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
+DECLARE_DEBUG_VARIABLE(int32_t, TbxSendBatchSize, -1, "Size in KB of buffer collecting TBX write messages sent to server together, -1: default (1024), 0: send each message separately")
 DECLARE_DEBUG_VARIABLE(bool, FlattenBatchBufferForAUBDump, false, "Dump multi-level batch buffers to AUB as single, flat batch buffer")
 DECLARE_DEBUG_VARIABLE(bool, AddPatchInfoCommentsForAUBDump, false, "Dump comments containing allocations and patching information")
 DECLARE_DEBUG_VARIABLE(bool, UseAubStream, true, "Use aub_stream for aub dumping")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueReadOnly, false, "Force dumping buffers and images on clEnqueueReadBuffer/Image only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing every allocation in local memory address space")
+DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpWriterChunkSize, -1, "Size in KB of chunks written to AUB file by background thread, -1: default (write synchronously, 4096 with AUBDumpCompression), 0: write synchronously")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpCompression, false, "Compress AUB file written by background thread, file has to be decoded with ocloc decode_aub before replay")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpSkipUnchangedAllocations, false, "Do not dump allocations whose content did not change since previous dump")
 
 /*DEBUG FLAGS*/
 DECLARE_DEBUG_VARIABLE(std::string, ForceDeviceId, std::string("unk"), "DeviceId selected for testing")
@@ -67,6 +71,7 @@ DECLARE_DEBUG_VARIABLE(bool, PrintDebugMessages, false, "when enabled, some debu
 DECLARE_DEBUG_VARIABLE(bool, DumpKernels, false, "Enables dumping kernels' program source code to text files and program from binary to bin file")
 DECLARE_DEBUG_VARIABLE(bool, DumpKernelArgs, false, "Enables dumping kernels args to binary files")
 DECLARE_DEBUG_VARIABLE(bool, LogApiCalls, false, "Enables logging api function calls, inputs and outputs to file")
+DECLARE_DEBUG_VARIABLE(bool, LogToBinaryFile, false, "Writes logs to binary file (log file name with .bin suffix) through per thread buffers flushed in background, decode with: ocloc decode_log -file <file>")
 DECLARE_DEBUG_VARIABLE(bool, LogPatchTokens, false, "Enables logging patch tokens, inputs and outputs to file")
 DECLARE_DEBUG_VARIABLE(bool, LogTaskCounts, false, "Enables logging taskCounts and taskLevels to file")
 DECLARE_DEBUG_VARIABLE(bool, LogAlignedAllocations, false, "Logs alignedMalloc and alignedFree allocations")
@@ -80,6 +85,8 @@ DECLARE_DEBUG_VARIABLE(bool, PrintLWSSizes, false, "prints driver choosen local
 DECLARE_DEBUG_VARIABLE(bool, PrintDispatchParameters, false, "prints dispatch paramters of kernels passed to clEnqueueNDRangeKernel")
 DECLARE_DEBUG_VARIABLE(bool, PrintProgramBinaryProcessingTime, false, "prints execution time of Program::processGenBinary() method during program building")
 DECLARE_DEBUG_VARIABLE(int32_t, PrintDriverDiagnostics, -1, "prints driver diagnostics messages to standard output, value corresponds to hint level")
+DECLARE_DEBUG_VARIABLE(std::string, HostSideTracingRecorderFile, std::string("unk"), "Records all api calls with host side tracing and exports them to given file in Chrome trace format at exit")
+DECLARE_DEBUG_VARIABLE(int32_t, HostSideTracingRecorderBufferSize, -1, "Number of most recent api calls kept per thread by host side tracing recorder, -1: default (65536)")
 /*PERFORMANCE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNullHardware, false, "works on Windows only, sets the Null Hardware flag that makes all Command buffers completed while GPU does nothing")
 DECLARE_DEBUG_VARIABLE(bool, ForceLinearImages, false, "Force linear images. Default is Y-tiled.")
@@ -95,6 +102,10 @@ DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForUseHostPtr, false, "When active a
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
 DECLARE_DEBUG_VARIABLE(bool, DisableDcFlushInEpilogue, false, "Disable DC flush in epilogue")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrTracking, -1, "Enable host ptr tracking: -1 - default platform setting, 0 - disabled, 1 - enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, PatchtokensDecodeWorkersCount, -1, "Number of threads decoding kernels of patchtokens binaries, -1: default (up to 8 for programs with many kernels), 0 or 1: decode on calling thread")
+DECLARE_DEBUG_VARIABLE(int32_t, PitchedCopyWorkersCount, -1, "Number of threads copying image data between host pointer and image storage on CPU, -1: default (up to 4 for big copies), 0 or 1: copy on calling thread")
+DECLARE_DEBUG_VARIABLE(bool, EnableBufferObjectCache, false, "Linux only, buffer objects of freed allocations are kept for reuse by new allocations of the same size class")
+DECLARE_DEBUG_VARIABLE(int32_t, BufferObjectCacheMaxSize, -1, "Linux only, max size in MB of buffer objects kept in cache of each root device, -1: default (128 MB)")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
@@ -118,6 +129,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelVme, -1, "-1: default, 0: disabled, 1
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelAdvancedVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_advanced_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterOperationsSupport, -1, "-1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterOperationsForReadWriteBuffers, -1, "Use Blitter engine for Read/Write Buffers operations. -1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsCopy, -1, "Split big Read/Copy Buffer operations between Blitter and compute engines. -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsCopyMinSize, -1, "Minimal size in bytes of Read/Copy Buffer operation split between Blitter and compute engines. -1: default (64MB)")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalker, -1, "-1: platform behavior, 0: disabled, 1: enabled. Adds dedicated cache flush command after WALKER command when surfaces used by kernel require to flush the cache")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalMemory, -1, "-1: default behavior, 0: disabled, 1: enabled, Allows allocating graphics memory in Local Memory")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableStatelessToStatefulBufferOffsetOpt, -1, "-1: dont override, 0: disable, 1: enable, Enables buffer-offset improvement of the stateless to stateful optimization")
@@ -148,6 +161,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideAubDeviceId, -1, "-1 dont override, any
 DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampPacket, -1, "-1: default, 0: disable, 1:enable. Write Timestamp Packet for each set of gpu walkers")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
 DECLARE_DEBUG_VARIABLE(int32_t, AllocateSharedAllocationsWithCpuAndGpuStorage, -1, "When enabled driver creates cpu & gpu storage for shared unified memory allocations. (-1 - devices default mode, 0 - disable, 1 - enable)")
+DECLARE_DEBUG_VARIABLE(int32_t, UnifiedMemoryMigrationGranularity, -1, "-1: default (2MB), >0: size in bytes of shared unified memory chunk migrated to cpu on page fault, aligned up to page size")
 DECLARE_DEBUG_VARIABLE(bool, UseMaxSimdSizeToDeduceMaxWorkgroupSize, false, "With this flag on, max workgroup size is deduced using SIMD32 instead of SIMD8, this causes the max wkg size to be 4 times bigger")
 DECLARE_DEBUG_VARIABLE(bool, ReturnRawGpuTimestamps, false, "Driver returns raw GPU tiemstamps instead of calculated ones.")
 DECLARE_DEBUG_VARIABLE(bool, ForcePerDssBackedBufferProgramming, false, "Always program per-DSS memory backed buffer in preamble")
@@ -11,6 +11,7 @@
 #include "shared/source/device_binary_format/patchtokens_validator.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/program/program_info_from_patchtokens.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "opencl/source/utilities/logger.h"
 
@@ -45,18 +46,20 @@ SingleDeviceBinary unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::Patchtokens
 
 template <>
 DecodeError decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Patchtokens>(ProgramInfo &dst, const SingleDeviceBinary &src, std::string &outErrReason, std::string &outWarning) {
+    // kernels are processed concurrently in each phase, worker threads are started once for all of them
+    ParallelForWorkers workers;
     NEO::PatchTokenBinary::ProgramFromPatchtokens decodedProgram = {};
-    NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(src.deviceBinary, decodedProgram);
+    NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(src.deviceBinary, decodedProgram, workers);
     DBG_LOG(LogPatchTokens, NEO::PatchTokenBinary::asString(decodedProgram).c_str());
 
     std::string validatorWarnings;
     std::string validatorErrMessage;
-    auto validatorErr = PatchTokenBinary::validate(decodedProgram, outErrReason, outWarning);
+    auto validatorErr = PatchTokenBinary::validate(decodedProgram, outErrReason, outWarning, workers);
     if (DecodeError::Success != validatorErr) {
         return validatorErr;
     }
 
-    NEO::populateProgramInfo(dst, decodedProgram);
+    NEO::populateProgramInfo(dst, decodedProgram, workers);
 
     return DecodeError::Success;
 }
@@ -11,8 +11,10 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include <algorithm>
+#include <thread>
 
 namespace NEO {
 
@@ -499,6 +501,10 @@ inline bool decodePatchList(PatchTokensStreamReader patchListStream, OutT &out)
     return decodeSuccess;
 }
 
+inline size_t getKernelInfoBlobSize(const SKernelBinaryHeaderCommon *header) {
+    return sizeof(SKernelBinaryHeaderCommon) + header->KernelNameSize + header->KernelHeapSize + header->GeneralStateHeapSize + header->DynamicStateHeapSize + header->SurfaceStateHeapSize + header->PatchListSize;
+}
+
 bool decodeKernelFromPatchtokensBlob(ArrayRef<const uint8_t> kernelBlob, KernelFromPatchtokens &out) {
     PatchTokensStreamReader stream{kernelBlob};
     auto decodePos = stream.data.begin();
@@ -510,7 +516,7 @@ bool decodeKernelFromPatchtokensBlob(ArrayRef<const uint8_t> kernelBlob, KernelF
 
     out.header = reinterpret_cast<const SKernelBinaryHeaderCommon *>(decodePos);
 
-    auto kernelInfoBlobSize = sizeof(SKernelBinaryHeaderCommon) + out.header->KernelNameSize + out.header->KernelHeapSize + out.header->GeneralStateHeapSize + out.header->DynamicStateHeapSize + out.header->SurfaceStateHeapSize + out.header->PatchListSize;
+    auto kernelInfoBlobSize = getKernelInfoBlobSize(out.header);
 
     if (stream.notEnoughDataLeft(decodePos, kernelInfoBlobSize)) {
         out.decodeStatus = DecodeError::InvalidBinary;
@@ -570,26 +576,49 @@ inline bool decodeProgramHeader(ProgramFromPatchtokens &decodedProgram) {
     return true;
 }
 
-inline bool decodeKernels(ProgramFromPatchtokens &decodedProgram) {
+inline bool decodeKernels(ProgramFromPatchtokens &decodedProgram, ParallelForWorkers &workers) {
     auto numKernels = decodedProgram.header->NumberOfKernels;
-    decodedProgram.kernels.reserve(decodedProgram.header->NumberOfKernels);
     const uint8_t *decodePos = decodedProgram.blobs.kernelsInfo.begin();
-    bool decodeSuccess = true;
     PatchTokensStreamReader stream{decodedProgram.blobs.kernelsInfo};
-    for (uint32_t i = 0; (i < numKernels) && decodeSuccess; i++) {
-        decodedProgram.kernels.resize(decodedProgram.kernels.size() + 1);
-        auto &currKernelInfo = *decodedProgram.kernels.rbegin();
-        auto kernelDataLeft = ArrayRef<const uint8_t>(decodePos, stream.getDataSizeLeft(decodePos));
-        decodeSuccess = decodeKernelFromPatchtokensBlob(kernelDataLeft, currKernelInfo);
-        decodePos = ptrOffset(decodePos, currKernelInfo.blobs.kernelInfo.size());
+
+    // kernel boundaries are known from headers only, patch lists are then decoded concurrently
+    std::vector<ArrayRef<const uint8_t>> kernelBlobs;
+    kernelBlobs.reserve(numKernels);
+    for (uint32_t i = 0; i < numKernels; i++) {
+        auto header = reinterpret_cast<const SKernelBinaryHeaderCommon *>(decodePos);
+        if (stream.notEnoughDataLeft<SKernelBinaryHeaderCommon>(decodePos) || stream.notEnoughDataLeft(decodePos, getKernelInfoBlobSize(header))) {
+            decodedProgram.kernels.resize(i + 1);
+            decodeKernelFromPatchtokensBlob(ArrayRef<const uint8_t>(decodePos, stream.getDataSizeLeft(decodePos)), decodedProgram.kernels[i]);
+            return false;
+        }
+        kernelBlobs.push_back(ArrayRef<const uint8_t>(decodePos, getKernelInfoBlobSize(header)));
+        decodePos = ptrOffset(decodePos, kernelBlobs[i].size());
     }
-    return decodeSuccess;
+
+    decodedProgram.kernels.resize(numKernels);
+    parallelFor(workers, numKernels, getKernelsDecodeWorkersCount(numKernels), [&](size_t kernelNum) {
+        decodeKernelFromPatchtokensBlob(kernelBlobs[kernelNum], decodedProgram.kernels[kernelNum]);
+    });
+
+    // same result as decoding stopped at first invalid kernel
+    for (uint32_t i = 0; i < numKernels; i++) {
+        if (decodedProgram.kernels[i].decodeStatus != DecodeError::Success) {
+            decodedProgram.kernels.resize(i + 1);
+            return false;
+        }
+    }
+    return true;
 }
 
 bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, ProgramFromPatchtokens &out) {
+    ParallelForWorkers workers;
+    return decodeProgramFromPatchtokensBlob(programBlob, out, workers);
+}
+
+bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, ProgramFromPatchtokens &out, ParallelForWorkers &workers) {
     out.blobs.programInfo = programBlob;
     bool decodeSuccess = decodeProgramHeader(out);
-    decodeSuccess = decodeSuccess && decodeKernels(out);
+    decodeSuccess = decodeSuccess && decodeKernels(out, workers);
     decodeSuccess = decodeSuccess && decodePatchList(out.blobs.patchList, out);
     out.decodeStatus = decodeSuccess ? DecodeError::Success : DecodeError::InvalidBinary;
 
@@ -610,6 +639,16 @@ bool hasInvalidChecksum(const KernelFromPatchtokens &decodedKernel) {
     return decodedChecksum != calculatedChecksum;
 }
 
+size_t getKernelsDecodeWorkersCount(size_t numKernels) {
+    if (DebugManager.flags.PatchtokensDecodeWorkersCount.get() != -1) {
+        return std::max(1, DebugManager.flags.PatchtokensDecodeWorkersCount.get());
+    }
+    // starting threads pays off only when each of them gets a batch of kernels
+    constexpr size_t minKernelsPerWorker = 32u;
+    constexpr size_t maxWorkers = 8u;
+    return std::max<size_t>(1u, std::min({numKernels / minKernelsPerWorker, maxWorkers, static_cast<size_t>(std::thread::hardware_concurrency())}));
+}
+
 const KernelArgAttributesFromPatchtokens getInlineData(const SPatchKernelArgumentInfo *ptr) {
     KernelArgAttributesFromPatchtokens ret = {};
     UNRECOVERABLE_IF(ptr == nullptr);
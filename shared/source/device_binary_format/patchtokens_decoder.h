@@ -25,6 +25,8 @@
 
 namespace NEO {
 
+class ParallelForWorkers;
+
 namespace PatchTokenBinary {
 
 using namespace iOpenCL;
@@ -194,8 +196,10 @@ struct KernelArgAttributesFromPatchtokens {
 
 bool decodeKernelFromPatchtokensBlob(ArrayRef<const uint8_t> kernelBlob, KernelFromPatchtokens &out);
 bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, ProgramFromPatchtokens &out);
+bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, ProgramFromPatchtokens &out, ParallelForWorkers &workers);
 uint32_t calcKernelChecksum(const ArrayRef<const uint8_t> kernelBlob);
 bool hasInvalidChecksum(const KernelFromPatchtokens &decodedKernel);
+size_t getKernelsDecodeWorkersCount(size_t numKernels);
 
 inline const uint8_t *getInlineData(const SPatchAllocateConstantMemorySurfaceProgramBinaryInfo *ptr) {
     return ptrOffset(reinterpret_cast<const uint8_t *>(ptr), sizeof(SPatchAllocateConstantMemorySurfaceProgramBinaryInfo));
@@ -9,12 +9,14 @@
 
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "opencl/source/program/kernel_arg_info.h"
 
 #include "igfxfmid.h"
 
 #include <string>
+#include <vector>
 
 namespace NEO {
 
@@ -24,6 +26,12 @@ bool allowUnhandledTokens = true;
 
 DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
                      std::string &outErrReason, std::string &outWarnings) {
+    ParallelForWorkers workers;
+    return validate(decodedProgram, outErrReason, outWarnings, workers);
+}
+
+DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
+                     std::string &outErrReason, std::string &outWarnings, ParallelForWorkers &workers) {
     if (decodedProgram.decodeStatus != DecodeError::Success) {
         outErrReason = "ProgramFromPatchtokens wasn't successfully decoded";
         return DecodeError::InvalidBinary;
@@ -85,14 +93,24 @@ DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
         return DecodeError::UnhandledBinary;
     }
 
-    for (const auto &decodedKernel : decodedProgram.kernels) {
+    // checksums hash whole kernel blobs, so these are calculated for all kernels concurrently
+    std::vector<uint8_t> invalidChecksums(decodedProgram.kernels.size(), 0u);
+    parallelFor(workers, decodedProgram.kernels.size(), getKernelsDecodeWorkersCount(decodedProgram.kernels.size()), [&](size_t kernelNum) {
+        const auto &decodedKernel = decodedProgram.kernels[kernelNum];
+        if ((decodedKernel.decodeStatus == DecodeError::Success) && (nullptr != decodedKernel.header) && (decodedKernel.blobs.kernelInfo.size() > sizeof(SKernelBinaryHeaderCommon))) {
+            invalidChecksums[kernelNum] = hasInvalidChecksum(decodedKernel);
+        }
+    });
+
+    for (size_t kernelNum = 0; kernelNum < decodedProgram.kernels.size(); kernelNum++) {
+        const auto &decodedKernel = decodedProgram.kernels[kernelNum];
         if (decodedKernel.decodeStatus != DecodeError::Success) {
             outErrReason = "KernelFromPatchtokens wasn't successfully decoded";
             return DecodeError::UnhandledBinary;
         }
 
         UNRECOVERABLE_IF(nullptr == decodedKernel.header);
-        if (hasInvalidChecksum(decodedKernel)) {
+        if (invalidChecksums[kernelNum] || (decodedKernel.blobs.kernelInfo.size() <= sizeof(SKernelBinaryHeaderCommon) && hasInvalidChecksum(decodedKernel))) {
             outErrReason = "KernelFromPatchtokens has invalid checksum";
             return DecodeError::UnhandledBinary;
         }
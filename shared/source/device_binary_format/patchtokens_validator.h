@@ -13,6 +13,8 @@
 
 namespace NEO {
 
+class ParallelForWorkers;
+
 namespace PatchTokenBinary {
 extern bool allowUnhandledTokens;
 
@@ -20,6 +22,8 @@ struct ProgramFromPatchtokens;
 
 DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
                      std::string &outErrReason, std::string &outWarnings);
+DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
+                     std::string &outErrReason, std::string &outWarnings, ParallelForWorkers &workers);
 
 } // namespace PatchTokenBinary
 
@@ -122,4 +122,14 @@ void BlitProperties::setupDependenciesForAuxTranslation(BlitPropertiesContainer
     blitPropertiesContainer[numObjects].csrDependencies.push_back(&kernelTimestamps);
 }
 
+void BlitProperties::setupCopyRegion(BlitProperties &blitProperties, const Vec3<size_t> &copyRegion,
+                                     size_t dstRowPitch, size_t dstSlicePitch, size_t srcRowPitch, size_t srcSlicePitch) {
+    blitProperties.copyRegion = copyRegion;
+    blitProperties.copySize = static_cast<uint64_t>(copyRegion.x) * copyRegion.y * copyRegion.z;
+    blitProperties.dstRowPitch = dstRowPitch;
+    blitProperties.dstSlicePitch = dstSlicePitch;
+    blitProperties.srcRowPitch = srcRowPitch;
+    blitProperties.srcSlicePitch = srcSlicePitch;
+}
+
 } // namespace NEO
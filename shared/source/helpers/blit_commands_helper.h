@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/command_stream/csr_deps.h"
 #include "shared/source/helpers/aux_translation.h"
+#include "shared/source/helpers/vec.h"
 #include "shared/source/memory_manager/memory_constants.h"
 #include "shared/source/utilities/stackvec.h"
 
@@ -47,6 +48,9 @@ struct BlitProperties {
                                                    TimestampPacketContainer &kernelTimestamps, const CsrDependencies &depsFromEvents,
                                                    CommandStreamReceiver &gpguCsr, CommandStreamReceiver &bcsCsr);
 
+    static void setupCopyRegion(BlitProperties &blitProperties, const Vec3<size_t> &copyRegion,
+                                size_t dstRowPitch, size_t dstSlicePitch, size_t srcRowPitch, size_t srcSlicePitch);
+
     static BlitterConstants::BlitDirection obtainBlitDirection(uint32_t commandType);
 
     TagNode<TimestampPacketStorage> *outputTimestampPacket = nullptr;
@@ -61,13 +65,30 @@ struct BlitProperties {
     uint64_t copySize = 0;
     size_t dstOffset = 0;
     size_t srcOffset = 0;
+
+    // 3D copy of copyRegion.x bytes per row, copyRegion.y rows and copyRegion.z slices, unused for linear copy of copySize bytes
+    Vec3<size_t> copyRegion = {0, 0, 0};
+    size_t dstRowPitch = 0;
+    size_t dstSlicePitch = 0;
+    size_t srcRowPitch = 0;
+    size_t srcSlicePitch = 0;
+
+    bool isRegionCopy() const { return copyRegion.z != 0; }
 };
 
 template <typename GfxFamily>
 struct BlitCommandsHelper {
     static size_t estimateBlitCommandsSize(uint64_t copySize, const CsrDependencies &csrDependencies, bool updateTimestampPacket);
+    static size_t estimateBlitCommandsSize(const BlitProperties &blitProperties);
     static size_t estimateBlitCommandsSize(const BlitPropertiesContainer &blitPropertiesContainer, const HardwareInfo &hwInfo);
+    static uint64_t getNumberOfBlitsForLinearCopy(uint64_t copySize);
+    static uint64_t getNumberOfBlitsForCopy(const BlitProperties &blitProperties);
+    static bool isPitchedCopySupported(const BlitProperties &blitProperties);
     static void dispatchBlitCommandsForBuffer(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static void dispatchBlitCommandsForLinearCopy(const BlitProperties &blitProperties, uint64_t dstAddress, uint64_t srcAddress, uint64_t copySize,
+                                                  LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static void dispatchBlitCommand(const BlitProperties &blitProperties, uint64_t dstAddress, uint64_t srcAddress, uint64_t width, uint64_t height,
+                                    uint64_t dstPitch, uint64_t srcPitch, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment);
     static void appendBlitCommandsForBuffer(const BlitProperties &blitProperties, typename GfxFamily::XY_COPY_BLT &blitCmd, const RootDeviceEnvironment &rootDeviceEnvironment);
 };
 } // namespace NEO
@@ -12,8 +12,8 @@
 namespace NEO {
 
 template <typename GfxFamily>
-size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(uint64_t copySize, const CsrDependencies &csrDependencies, bool updateTimestampPacket) {
-    size_t numberOfBlits = 0;
+uint64_t BlitCommandsHelper<GfxFamily>::getNumberOfBlitsForLinearCopy(uint64_t copySize) {
+    uint64_t numberOfBlits = 0;
     uint64_t sizeToBlit = copySize;
     uint64_t width = 1;
     uint64_t height = 1;
@@ -32,17 +32,55 @@ size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(uint64_t copySize
         numberOfBlits++;
     }
 
+    return numberOfBlits;
+}
+
+template <typename GfxFamily>
+uint64_t BlitCommandsHelper<GfxFamily>::getNumberOfBlitsForCopy(const BlitProperties &blitProperties) {
+    if (!blitProperties.isRegionCopy()) {
+        return getNumberOfBlitsForLinearCopy(blitProperties.copySize);
+    }
+
+    auto &copyRegion = blitProperties.copyRegion;
+    if (isPitchedCopySupported(blitProperties)) {
+        // one blit per maxBlitHeight rows of each slice
+        return copyRegion.z * ((copyRegion.y + BlitterConstants::maxBlitHeight - 1) / BlitterConstants::maxBlitHeight);
+    }
+    // each row is copied separately
+    return copyRegion.z * copyRegion.y * getNumberOfBlitsForLinearCopy(copyRegion.x);
+}
+
+template <typename GfxFamily>
+bool BlitCommandsHelper<GfxFamily>::isPitchedCopySupported(const BlitProperties &blitProperties) {
+    return (blitProperties.copyRegion.x <= BlitterConstants::maxBlitWidth) &&
+           (blitProperties.dstRowPitch <= BlitterConstants::maxBlitPitch) &&
+           (blitProperties.srcRowPitch <= BlitterConstants::maxBlitPitch);
+}
+
+template <typename GfxFamily>
+size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(uint64_t copySize, const CsrDependencies &csrDependencies, bool updateTimestampPacket) {
+    size_t numberOfBlits = static_cast<size_t>(getNumberOfBlitsForLinearCopy(copySize));
+
     return TimestampPacketHelper::getRequiredCmdStreamSize<GfxFamily>(csrDependencies) +
            (sizeof(typename GfxFamily::XY_COPY_BLT) * numberOfBlits) +
            (sizeof(typename GfxFamily::MI_FLUSH_DW) * static_cast<size_t>(updateTimestampPacket));
 }
 
+template <typename GfxFamily>
+size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(const BlitProperties &blitProperties) {
+    size_t numberOfBlits = static_cast<size_t>(getNumberOfBlitsForCopy(blitProperties));
+    bool updateTimestampPacket = blitProperties.outputTimestampPacket != nullptr;
+
+    return TimestampPacketHelper::getRequiredCmdStreamSize<GfxFamily>(blitProperties.csrDependencies) +
+           (sizeof(typename GfxFamily::XY_COPY_BLT) * numberOfBlits) +
+           (sizeof(typename GfxFamily::MI_FLUSH_DW) * static_cast<size_t>(updateTimestampPacket));
+}
+
 template <typename GfxFamily>
 size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(const BlitPropertiesContainer &blitPropertiesContainer, const HardwareInfo &hwInfo) {
     size_t size = 0;
     for (auto &blitProperties : blitPropertiesContainer) {
-        size += BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(blitProperties.copySize, blitProperties.csrDependencies,
-                                                                        blitProperties.outputTimestampPacket != nullptr);
+        size += BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(blitProperties);
     }
     size += MemorySynchronizationCommands<GfxFamily>::getSizeForAdditonalSynchronization(hwInfo);
     size += sizeof(typename GfxFamily::MI_FLUSH_DW) + sizeof(typename GfxFamily::MI_BATCH_BUFFER_END);
@@ -52,7 +90,42 @@ size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(const BlitPropert
 
 template <typename GfxFamily>
 void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBuffer(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment) {
-    uint64_t sizeToBlit = blitProperties.copySize;
+    auto dstAddress = blitProperties.dstGpuAddress + blitProperties.dstOffset;
+    auto srcAddress = blitProperties.srcGpuAddress + blitProperties.srcOffset;
+
+    if (!blitProperties.isRegionCopy()) {
+        dispatchBlitCommandsForLinearCopy(blitProperties, dstAddress, srcAddress, blitProperties.copySize, linearStream, rootDeviceEnvironment);
+        return;
+    }
+
+    auto &copyRegion = blitProperties.copyRegion;
+    bool pitchedCopy = isPitchedCopySupported(blitProperties);
+
+    for (size_t slice = 0; slice < copyRegion.z; slice++) {
+        auto dstSliceAddress = dstAddress + slice * blitProperties.dstSlicePitch;
+        auto srcSliceAddress = srcAddress + slice * blitProperties.srcSlicePitch;
+
+        if (pitchedCopy) {
+            // dispatch 2D blits: rowSize x (1 .. maxBlitHeight) with row pitches of both surfaces
+            uint64_t height = 1;
+            for (uint64_t row = 0; row < copyRegion.y; row += height) {
+                height = std::min(copyRegion.y - row, BlitterConstants::maxBlitHeight);
+                dispatchBlitCommand(blitProperties, dstSliceAddress + row * blitProperties.dstRowPitch, srcSliceAddress + row * blitProperties.srcRowPitch,
+                                    copyRegion.x, height, blitProperties.dstRowPitch, blitProperties.srcRowPitch, linearStream, rootDeviceEnvironment);
+            }
+        } else {
+            for (uint64_t row = 0; row < copyRegion.y; row++) {
+                dispatchBlitCommandsForLinearCopy(blitProperties, dstSliceAddress + row * blitProperties.dstRowPitch, srcSliceAddress + row * blitProperties.srcRowPitch,
+                                                  copyRegion.x, linearStream, rootDeviceEnvironment);
+            }
+        }
+    }
+}
+
+template <typename GfxFamily>
+void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForLinearCopy(const BlitProperties &blitProperties, uint64_t dstAddress, uint64_t srcAddress, uint64_t copySize,
+                                                                       LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    uint64_t sizeToBlit = copySize;
     uint64_t width = 1;
     uint64_t height = 1;
     uint64_t offset = 0;
@@ -68,19 +141,7 @@ void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBuffer(const BlitProp
             height = 1;
         }
 
-        auto bltCmd = linearStream.getSpaceForCmd<typename GfxFamily::XY_COPY_BLT>();
-        *bltCmd = GfxFamily::cmdInitXyCopyBlt;
-
-        bltCmd->setTransferWidth(static_cast<uint32_t>(width));
-        bltCmd->setTransferHeight(static_cast<uint32_t>(height));
-
-        bltCmd->setDestinationPitch(static_cast<uint32_t>(width));
-        bltCmd->setSourcePitch(static_cast<uint32_t>(width));
-
-        bltCmd->setDestinationBaseAddress(blitProperties.dstGpuAddress + blitProperties.dstOffset + offset);
-        bltCmd->setSourceBaseAddress(blitProperties.srcGpuAddress + blitProperties.srcOffset + offset);
-
-        appendBlitCommandsForBuffer(blitProperties, *bltCmd, rootDeviceEnvironment);
+        dispatchBlitCommand(blitProperties, dstAddress + offset, srcAddress + offset, width, height, width, width, linearStream, rootDeviceEnvironment);
 
         auto blitSize = width * height;
         sizeToBlit -= blitSize;
@@ -88,4 +149,22 @@ void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBuffer(const BlitProp
     }
 }
 
+template <typename GfxFamily>
+void BlitCommandsHelper<GfxFamily>::dispatchBlitCommand(const BlitProperties &blitProperties, uint64_t dstAddress, uint64_t srcAddress, uint64_t width, uint64_t height,
+                                                        uint64_t dstPitch, uint64_t srcPitch, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    auto bltCmd = linearStream.getSpaceForCmd<typename GfxFamily::XY_COPY_BLT>();
+    *bltCmd = GfxFamily::cmdInitXyCopyBlt;
+
+    bltCmd->setTransferWidth(static_cast<uint32_t>(width));
+    bltCmd->setTransferHeight(static_cast<uint32_t>(height));
+
+    bltCmd->setDestinationPitch(static_cast<uint32_t>(dstPitch));
+    bltCmd->setSourcePitch(static_cast<uint32_t>(srcPitch));
+
+    bltCmd->setDestinationBaseAddress(dstAddress);
+    bltCmd->setSourceBaseAddress(srcAddress);
+
+    appendBlitCommandsForBuffer(blitProperties, *bltCmd, rootDeviceEnvironment);
+}
+
 } // namespace NEO
@@ -96,3 +96,18 @@ bool fileExistsHasSize(const std::string &fileName) {
     }
     return pFile != nullptr && nsize > 0;
 }
+
+size_t getFileSize(const std::string &fileName) {
+    FILE *pFile = nullptr;
+    size_t nsize = 0;
+
+    DEBUG_BREAK_IF(fileName.empty());
+
+    fopen_s(&pFile, fileName.c_str(), "rb");
+    if (pFile) {
+        fseek(pFile, 0, SEEK_END);
+        nsize = (size_t)ftell(pFile);
+        fclose(pFile);
+    }
+    return nsize;
+}
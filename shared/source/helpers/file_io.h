@@ -22,3 +22,4 @@ size_t writeDataToFile(
 
 bool fileExists(const std::string &fileName);
 bool fileExistsHasSize(const std::string &fileName);
+size_t getFileSize(const std::string &fileName);
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash128.h"
+
+#include "shared/source/utilities/cpu_info.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace NEO {
+
+namespace {
+constexpr uint64_t prime32 = 0x9E3779B1ULL;
+constexpr uint64_t prime64a = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t prime64b = 0xC2B2AE3D27D4EB4FULL;
+
+// accumulation keys are consumed with a one-lane shift per stripe of a block
+constexpr size_t accumulateKeyCount = Hash128::stripesPerBlock + Hash128::lanesPerStripe - 1;
+const uint64_t accumulateKey[accumulateKeyCount] = {
+    0xc0e16b163a85a4dcULL, 0x890acd8dd443c47cULL, 0xb3889d8a6dc47761ULL, 0x6a0398e528f0ae6aULL,
+    0x048344ece48a855eULL, 0xf175cfea21871330ULL, 0x391ceef02702c2fdULL, 0x4baf8cac4784cb12ULL,
+    0x3547744583a3f88eULL, 0xd9cf2b15c6b6c90eULL, 0x961facc76d5fe21cULL, 0x0094ab49d50f11f9ULL,
+    0xe3211e37bdbeb6dcULL, 0x62fe6c274ff3511aULL, 0x5ac30b329fdf0574ULL, 0x1450582c6b65b406ULL,
+    0x7a30fcc7888eb791ULL, 0x5540f5ba6a15576eULL, 0x16cef0559096d3e9ULL, 0x2cf8f14b06874899ULL,
+    0xc9c9263b6e2ce103ULL, 0xd6ff920b0a9faa6dULL, 0x53192697db998dc1ULL};
+
+const uint64_t scrambleKey[Hash128::lanesPerStripe] = {
+    0x73ea9b9bc7cd18d7ULL, 0x102713f872c33fceULL, 0xf4183a0e5d2a033eULL, 0x71b63e307eebb517ULL,
+    0xda61f5713d036000ULL, 0x46eb7409ae691b21ULL, 0xb23ad691d6707698ULL, 0x67c8fe11d22fc4b9ULL};
+
+const uint64_t mergeKey[Hash128::lanesPerStripe] = {
+    0x7eb4661419481338ULL, 0x98077547fb070efcULL, 0x1ee63336c2e3a9a8ULL, 0xbc353656348c36f6ULL,
+    0xce3898cbf1bb1bd8ULL, 0x265b1c23c82915cbULL, 0xfd1948c91687e355ULL, 0xd976893961980ffaULL};
+
+const uint64_t initialAcc[Hash128::lanesPerStripe] = {
+    prime32, prime64a, prime64b, 0x165667B19E3779F9ULL,
+    0x85EBCA77C2B2AE63ULL, 0x27D4EB2F165667C5ULL, prime64b, prime32};
+
+uint64_t multiplyAndFold(uint64_t lhs, uint64_t rhs) {
+    uint64_t lo = (lhs & 0xFFFFFFFFU) * (rhs & 0xFFFFFFFFU);
+    uint64_t hiLo = (lhs >> 32) * (rhs & 0xFFFFFFFFU);
+    uint64_t loHi = (lhs & 0xFFFFFFFFU) * (rhs >> 32);
+    uint64_t hi = (lhs >> 32) * (rhs >> 32);
+
+    uint64_t cross = (lo >> 32) + (hiLo & 0xFFFFFFFFU) + loHi;
+    uint64_t upper = (hiLo >> 32) + (cross >> 32) + hi;
+    uint64_t lower = (cross << 32) | (lo & 0xFFFFFFFFU);
+    return upper ^ lower;
+}
+
+uint64_t avalanche(uint64_t value) {
+    value ^= value >> 37;
+    value *= 0x165667919E3779F9ULL;
+    value ^= value >> 32;
+    return value;
+}
+
+void scramble(uint64_t *acc) {
+    for (size_t i = 0; i < Hash128::lanesPerStripe; i++) {
+        acc[i] ^= acc[i] >> 47;
+        acc[i] ^= scrambleKey[i];
+        acc[i] *= prime32;
+    }
+}
+
+struct Hash128Initializer {
+    Hash128Initializer() {
+        if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+            Hash128::accumulateStripes = Hash128Accumulate::accumulateStripesAvx2;
+        } else if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureSsE42)) {
+            Hash128::accumulateStripes = Hash128Accumulate::accumulateStripesSse4;
+        }
+    }
+};
+} // namespace
+
+namespace Hash128Accumulate {
+void accumulateStripesScalar(uint64_t *acc, const uint8_t *data, const uint64_t *key, size_t numStripes) {
+    for (size_t stripe = 0; stripe < numStripes; stripe++) {
+        for (size_t lane = 0; lane < Hash128::lanesPerStripe; lane++) {
+            uint64_t value;
+            memcpy(&value, data + lane * sizeof(uint64_t), sizeof(uint64_t));
+            uint64_t keyed = value ^ key[lane];
+            acc[lane ^ 1] += value;
+            acc[lane] += (keyed & 0xFFFFFFFFU) * (keyed >> 32);
+        }
+        data += Hash128::stripeSize;
+        key++;
+    }
+}
+} // namespace Hash128Accumulate
+
+Hash128::AccumulateStripesFunc Hash128::accumulateStripes = Hash128Accumulate::accumulateStripesScalar;
+static Hash128Initializer hash128Initializer;
+
+std::string Hash128Value::toString() const {
+    std::stringstream stream;
+    stream << std::setfill('0') << std::hex
+           << std::setw(sizeof(high) * 2) << high
+           << std::setw(sizeof(low) * 2) << low;
+    return stream.str();
+}
+
+void Hash128::reset() {
+    memcpy(acc, initialAcc, sizeof(acc));
+    bufferedSize = 0U;
+    stripesInBlock = 0U;
+    totalLength = 0U;
+}
+
+void Hash128::consumeStripes(const uint8_t *data, size_t numStripes) {
+    while (numStripes > 0) {
+        size_t stripesToConsume = std::min(numStripes, stripesPerBlock - stripesInBlock);
+        accumulateStripes(acc, data, accumulateKey + stripesInBlock, stripesToConsume);
+        stripesInBlock += stripesToConsume;
+        if (stripesInBlock == stripesPerBlock) {
+            scramble(acc);
+            stripesInBlock = 0U;
+        }
+        data += stripesToConsume * stripeSize;
+        numStripes -= stripesToConsume;
+    }
+}
+
+void Hash128::update(const char *buff, size_t size) {
+    if ((buff == nullptr) || (size == 0U)) {
+        return;
+    }
+    auto data = reinterpret_cast<const uint8_t *>(buff);
+    totalLength += size;
+
+    if (bufferedSize > 0U) {
+        size_t toCopy = std::min(size, stripeSize - bufferedSize);
+        memcpy(buffer + bufferedSize, data, toCopy);
+        bufferedSize += toCopy;
+        data += toCopy;
+        size -= toCopy;
+        if (bufferedSize < stripeSize) {
+            return;
+        }
+        consumeStripes(buffer, 1U);
+        bufferedSize = 0U;
+    }
+
+    size_t numStripes = size / stripeSize;
+    consumeStripes(data, numStripes);
+    data += numStripes * stripeSize;
+    size -= numStripes * stripeSize;
+
+    if (size > 0U) {
+        memcpy(buffer, data, size);
+        bufferedSize = size;
+    }
+}
+
+Hash128Value Hash128::finish() const {
+    uint64_t finalAcc[lanesPerStripe];
+    memcpy(finalAcc, acc, sizeof(finalAcc));
+
+    if (bufferedSize > 0U) {
+        uint8_t lastStripe[stripeSize] = {};
+        memcpy(lastStripe, buffer, bufferedSize);
+        Hash128Accumulate::accumulateStripesScalar(finalAcc, lastStripe, accumulateKey + stripesInBlock, 1U);
+    }
+
+    Hash128Value ret;
+    ret.low = totalLength * prime64a;
+    ret.high = ~(totalLength * prime64b);
+    for (size_t i = 0; i < lanesPerStripe; i += 2) {
+        ret.low += multiplyAndFold(finalAcc[i] ^ mergeKey[i], finalAcc[i + 1] ^ mergeKey[i + 1]);
+        ret.high += multiplyAndFold(finalAcc[i] ^ mergeKey[lanesPerStripe - 1 - i], finalAcc[i + 1] ^ mergeKey[lanesPerStripe - 2 - i]);
+    }
+    ret.low = avalanche(ret.low);
+    ret.high = avalanche(ret.high ^ ret.low);
+    return ret;
+}
+
+} // namespace NEO
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace NEO {
+
+struct Hash128Value {
+    uint64_t low = 0U;
+    uint64_t high = 0U;
+
+    bool operator==(const Hash128Value &rhs) const {
+        return (low == rhs.low) && (high == rhs.high);
+    }
+    bool operator!=(const Hash128Value &rhs) const {
+        return !(*this == rhs);
+    }
+
+    std::string toString() const;
+};
+
+// Streaming 128-bit non-cryptographic hash.
+// Input is consumed in 64-byte stripes, so that the per-stripe work (independent 64-bit lanes)
+// can be vectorized. All accumulate variants produce bit-identical results.
+class Hash128 {
+  public:
+    static constexpr size_t stripeSize = 64U;
+    static constexpr size_t lanesPerStripe = stripeSize / sizeof(uint64_t);
+    static constexpr size_t stripesPerBlock = 16U;
+
+    using AccumulateStripesFunc = void (*)(uint64_t *acc, const uint8_t *data, const uint64_t *key, size_t numStripes);
+    static AccumulateStripesFunc accumulateStripes;
+
+    Hash128() {
+        reset();
+    }
+
+    void reset();
+    void update(const char *buff, size_t size);
+    Hash128Value finish() const;
+
+    static Hash128Value hash(const char *buff, size_t size) {
+        Hash128 hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+  protected:
+    void consumeStripes(const uint8_t *data, size_t numStripes);
+
+    uint64_t acc[lanesPerStripe];
+    uint8_t buffer[stripeSize];
+    size_t bufferedSize;
+    size_t stripesInBlock;
+    uint64_t totalLength;
+};
+
+namespace Hash128Accumulate {
+void accumulateStripesScalar(uint64_t *acc, const uint8_t *data, const uint64_t *key, size_t numStripes);
+void accumulateStripesSse4(uint64_t *acc, const uint8_t *data, const uint64_t *key, size_t numStripes);
+void accumulateStripesAvx2(uint64_t *acc, const uint8_t *data, const uint64_t *key, size_t numStripes);
+} // namespace Hash128Accumulate
+
+} // namespace NEO
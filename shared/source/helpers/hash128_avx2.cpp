@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash128.h"
+
+#if __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace NEO {
+namespace Hash128Accumulate {
+#if __AVX2__
+void accumulateStripesAvx2(uint64_t *acc, const uint8_t *data, const uint64_t *key, size_t numStripes) {
+    constexpr size_t lanesPerVector = sizeof(__m256i) / sizeof(uint64_t);
+    __m256i accVec[Hash128::lanesPerStripe / lanesPerVector];
+    for (size_t i = 0; i < Hash128::lanesPerStripe / lanesPerVector; i++) {
+        accVec[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc) + i);
+    }
+
+    for (size_t stripe = 0; stripe < numStripes; stripe++) {
+        for (size_t i = 0; i < Hash128::lanesPerStripe / lanesPerVector; i++) {
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data) + i);
+            __m256i keyed = _mm256_xor_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(key) + i));
+            __m256i keyedHigh = _mm256_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1));
+            __m256i product = _mm256_mul_epu32(keyed, keyedHigh);
+            __m256i swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+            accVec[i] = _mm256_add_epi64(accVec[i], _mm256_add_epi64(product, swapped));
+        }
+        data += Hash128::stripeSize;
+        key++;
+    }
+
+    for (size_t i = 0; i < Hash128::lanesPerStripe / lanesPerVector; i++) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc) + i, accVec[i]);
+    }
+}
+#else
+void accumulateStripesAvx2(uint64_t *acc, const uint8_t *data, const uint64_t *key, size_t numStripes) {
+    accumulateStripesSse4(acc, data, key, numStripes);
+}
+#endif
+} // namespace Hash128Accumulate
+} // namespace NEO
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash128.h"
+
+#if __SSE4_2__
+#include <immintrin.h>
+#endif
+
+namespace NEO {
+namespace Hash128Accumulate {
+#if __SSE4_2__
+void accumulateStripesSse4(uint64_t *acc, const uint8_t *data, const uint64_t *key, size_t numStripes) {
+    constexpr size_t lanesPerVector = sizeof(__m128i) / sizeof(uint64_t);
+    __m128i accVec[Hash128::lanesPerStripe / lanesPerVector];
+    for (size_t i = 0; i < Hash128::lanesPerStripe / lanesPerVector; i++) {
+        accVec[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(acc) + i);
+    }
+
+    for (size_t stripe = 0; stripe < numStripes; stripe++) {
+        for (size_t i = 0; i < Hash128::lanesPerStripe / lanesPerVector; i++) {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data) + i);
+            __m128i keyed = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i *>(key) + i));
+            __m128i keyedHigh = _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1));
+            __m128i product = _mm_mul_epu32(keyed, keyedHigh);
+            __m128i swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+            accVec[i] = _mm_add_epi64(accVec[i], _mm_add_epi64(product, swapped));
+        }
+        data += Hash128::stripeSize;
+        key++;
+    }
+
+    for (size_t i = 0; i < Hash128::lanesPerStripe / lanesPerVector; i++) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(acc) + i, accVec[i]);
+    }
+}
+#else
+void accumulateStripesSse4(uint64_t *acc, const uint8_t *data, const uint64_t *key, size_t numStripes) {
+    accumulateStripesScalar(acc, data, key, numStripes);
+}
+#endif
+} // namespace Hash128Accumulate
+} // namespace NEO
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/pitched_copy.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/cpu_info.h"
+#include "shared/source/utilities/parallel_for.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace NEO {
+
+namespace {
+struct PitchedCopyInitializer {
+    PitchedCopyInitializer() {
+        if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+            PitchedCopy::copyRowsNonTemporal = PitchedCopyRows::copyRowsAvx2;
+        } else if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureSsE42)) {
+            PitchedCopy::copyRowsNonTemporal = PitchedCopyRows::copyRowsSse4;
+        }
+    }
+};
+} // namespace
+
+namespace PitchedCopyRows {
+void copyRowsScalar(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount) {
+    for (size_t row = 0; row < rowsCount; row++) {
+        memcpy(ptrOffset(dst, row * dstRowPitch), ptrOffset(src, row * srcRowPitch), rowSize);
+    }
+}
+} // namespace PitchedCopyRows
+
+constexpr size_t PitchedCopy::nonTemporalCopyMinSize;
+constexpr size_t PitchedCopy::minCopySizePerWorker;
+constexpr size_t PitchedCopy::maxWorkersCount;
+
+PitchedCopy::CopyRowsFunc PitchedCopy::copyRowsNonTemporal = PitchedCopyRows::copyRowsScalar;
+static PitchedCopyInitializer pitchedCopyInitializer;
+
+void PitchedCopy::copy(void *dst, size_t dstRowPitch, size_t dstSlicePitch,
+                       const void *src, size_t srcRowPitch, size_t srcSlicePitch,
+                       size_t rowSize, size_t rowsCount, size_t slicesCount) {
+    auto copySize = rowSize * rowsCount * slicesCount;
+    if (copySize == 0) {
+        return;
+    }
+
+    auto copyRows = (copySize >= nonTemporalCopyMinSize) ? copyRowsNonTemporal : PitchedCopyRows::copyRowsScalar;
+    auto workersCount = getWorkersCount(copySize);
+
+    if (workersCount <= 1) {
+        for (size_t slice = 0; slice < slicesCount; slice++) {
+            copyRows(ptrOffset(dst, slice * dstSlicePitch), dstRowPitch,
+                     ptrOffset(src, slice * srcSlicePitch), srcRowPitch, rowSize, rowsCount);
+        }
+        return;
+    }
+
+    // each worker copies a band of consecutive rows, a band may span multiple slices
+    auto totalRowsCount = rowsCount * slicesCount;
+    auto rowsPerBand = (totalRowsCount + workersCount - 1) / workersCount;
+
+    parallelFor(workersCount, workersCount, [&](size_t band) {
+        auto firstRow = band * rowsPerBand;
+        auto endRow = std::min(totalRowsCount, firstRow + rowsPerBand);
+
+        while (firstRow < endRow) {
+            auto slice = firstRow / rowsCount;
+            auto row = firstRow % rowsCount;
+            auto rowsToCopy = std::min(rowsCount - row, endRow - firstRow);
+
+            copyRows(ptrOffset(dst, slice * dstSlicePitch + row * dstRowPitch), dstRowPitch,
+                     ptrOffset(src, slice * srcSlicePitch + row * srcRowPitch), srcRowPitch, rowSize, rowsToCopy);
+            firstRow += rowsToCopy;
+        }
+    });
+}
+
+size_t PitchedCopy::getWorkersCount(size_t copySize) {
+    if (DebugManager.flags.PitchedCopyWorkersCount.get() != -1) {
+        return std::max(1, DebugManager.flags.PitchedCopyWorkersCount.get());
+    }
+    // memory bandwidth is saturated by a few threads, and starting one pays off only for big copies
+    return std::max<size_t>(1u, std::min({copySize / minCopySizePerWorker, maxWorkersCount, static_cast<size_t>(std::thread::hardware_concurrency())}));
+}
+
+} // namespace NEO
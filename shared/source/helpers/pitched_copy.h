@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/memory_manager/memory_constants.h"
+
+#include <cstddef>
+
+namespace NEO {
+
+// Copies slicesCount x rowsCount rows of rowSize bytes between surfaces with different row and slice pitches.
+// Big copies use vectorized non-temporal stores, which bypass CPU caches, and are split between worker threads.
+class PitchedCopy {
+  public:
+    using CopyRowsFunc = void (*)(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount);
+    static CopyRowsFunc copyRowsNonTemporal;
+
+    // smaller copies are likely to be read back soon, so they are kept in CPU caches
+    static constexpr size_t nonTemporalCopyMinSize = 2 * MemoryConstants::megaByte;
+    static constexpr size_t minCopySizePerWorker = 8 * MemoryConstants::megaByte;
+    static constexpr size_t maxWorkersCount = 4u;
+
+    static void copy(void *dst, size_t dstRowPitch, size_t dstSlicePitch,
+                     const void *src, size_t srcRowPitch, size_t srcSlicePitch,
+                     size_t rowSize, size_t rowsCount, size_t slicesCount);
+
+    static size_t getWorkersCount(size_t copySize);
+};
+
+namespace PitchedCopyRows {
+void copyRowsScalar(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount);
+void copyRowsSse4(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount);
+void copyRowsAvx2(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount);
+} // namespace PitchedCopyRows
+
+} // namespace NEO
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/pitched_copy.h"
+
+#if __AVX2__
+#include "shared/source/helpers/ptr_math.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#endif
+
+namespace NEO {
+namespace PitchedCopyRows {
+#if __AVX2__
+void copyRowsAvx2(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount) {
+    constexpr size_t vectorSize = sizeof(__m256i);
+    constexpr size_t vectorsPerIteration = 4u;
+
+    for (size_t row = 0; row < rowsCount; row++) {
+        auto dstRow = static_cast<uint8_t *>(ptrOffset(dst, row * dstRowPitch));
+        auto srcRow = static_cast<const uint8_t *>(ptrOffset(src, row * srcRowPitch));
+
+        // streaming stores require aligned destination
+        size_t offset = std::min(rowSize, (vectorSize - reinterpret_cast<uintptr_t>(dstRow) % vectorSize) % vectorSize);
+        memcpy(dstRow, srcRow, offset);
+
+        for (; offset + vectorsPerIteration * vectorSize <= rowSize; offset += vectorsPerIteration * vectorSize) {
+            auto srcVectors = reinterpret_cast<const __m256i *>(srcRow + offset);
+            auto dstVectors = reinterpret_cast<__m256i *>(dstRow + offset);
+            __m256i value0 = _mm256_loadu_si256(srcVectors);
+            __m256i value1 = _mm256_loadu_si256(srcVectors + 1);
+            __m256i value2 = _mm256_loadu_si256(srcVectors + 2);
+            __m256i value3 = _mm256_loadu_si256(srcVectors + 3);
+            _mm256_stream_si256(dstVectors, value0);
+            _mm256_stream_si256(dstVectors + 1, value1);
+            _mm256_stream_si256(dstVectors + 2, value2);
+            _mm256_stream_si256(dstVectors + 3, value3);
+        }
+        for (; offset + vectorSize <= rowSize; offset += vectorSize) {
+            _mm256_stream_si256(reinterpret_cast<__m256i *>(dstRow + offset), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcRow + offset)));
+        }
+        memcpy(dstRow + offset, srcRow + offset, rowSize - offset);
+    }
+
+    // make streamed data visible to other threads before returning
+    _mm_sfence();
+}
+#else
+void copyRowsAvx2(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount) {
+    copyRowsSse4(dst, dstRowPitch, src, srcRowPitch, rowSize, rowsCount);
+}
+#endif
+} // namespace PitchedCopyRows
+} // namespace NEO
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/pitched_copy.h"
+
+#if __SSE4_2__
+#include "shared/source/helpers/ptr_math.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#endif
+
+namespace NEO {
+namespace PitchedCopyRows {
+#if __SSE4_2__
+void copyRowsSse4(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount) {
+    constexpr size_t vectorSize = sizeof(__m128i);
+    constexpr size_t vectorsPerIteration = 4u;
+
+    for (size_t row = 0; row < rowsCount; row++) {
+        auto dstRow = static_cast<uint8_t *>(ptrOffset(dst, row * dstRowPitch));
+        auto srcRow = static_cast<const uint8_t *>(ptrOffset(src, row * srcRowPitch));
+
+        // streaming stores require aligned destination
+        size_t offset = std::min(rowSize, (vectorSize - reinterpret_cast<uintptr_t>(dstRow) % vectorSize) % vectorSize);
+        memcpy(dstRow, srcRow, offset);
+
+        for (; offset + vectorsPerIteration * vectorSize <= rowSize; offset += vectorsPerIteration * vectorSize) {
+            auto srcVectors = reinterpret_cast<const __m128i *>(srcRow + offset);
+            auto dstVectors = reinterpret_cast<__m128i *>(dstRow + offset);
+            __m128i value0 = _mm_loadu_si128(srcVectors);
+            __m128i value1 = _mm_loadu_si128(srcVectors + 1);
+            __m128i value2 = _mm_loadu_si128(srcVectors + 2);
+            __m128i value3 = _mm_loadu_si128(srcVectors + 3);
+            _mm_stream_si128(dstVectors, value0);
+            _mm_stream_si128(dstVectors + 1, value1);
+            _mm_stream_si128(dstVectors + 2, value2);
+            _mm_stream_si128(dstVectors + 3, value3);
+        }
+        for (; offset + vectorSize <= rowSize; offset += vectorSize) {
+            _mm_stream_si128(reinterpret_cast<__m128i *>(dstRow + offset), _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcRow + offset)));
+        }
+        memcpy(dstRow + offset, srcRow + offset, rowSize - offset);
+    }
+
+    // make streamed data visible to other threads before returning
+    _mm_sfence();
+}
+#else
+void copyRowsSse4(void *dst, size_t dstRowPitch, const void *src, size_t srcRowPitch, size_t rowSize, size_t rowsCount) {
+    copyRowsScalar(dst, dstRowPitch, src, srcRowPitch, rowSize, rowsCount);
+}
+#endif
+} // namespace PitchedCopyRows
+} // namespace NEO
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/dirty_page_tracker.h"
+
+namespace NEO {
+
+constexpr size_t DirtyPageTracker::pageSize;
+constexpr size_t DirtyPageTracker::pagesPerWord;
+
+DirtyPageTracker::~DirtyPageTracker() {
+    delete[] dirtyPages.load();
+}
+
+std::atomic<uint64_t> *DirtyPageTracker::getDirtyPages(size_t allocationSize) {
+    auto words = dirtyPages.load();
+    if (words != nullptr) {
+        return words;
+    }
+
+    // bitmap is sized once for the whole allocation and never reallocated, so it can be used without locks
+    auto pages = (allocationSize + pageSize - 1) / pageSize;
+    auto newWords = new std::atomic<uint64_t>[(pages + pagesPerWord - 1) / pagesPerWord]();
+    pagesCount = pages;
+    if (dirtyPages.compare_exchange_strong(words, newWords)) {
+        return newWords;
+    }
+    delete[] newWords;
+    return words;
+}
+
+void DirtyPageTracker::clearDirtyPages() {
+    auto words = dirtyPages.load();
+    if (words == nullptr) {
+        return;
+    }
+    auto pages = pagesCount.load();
+    for (size_t wordIndex = 0; wordIndex * pagesPerWord < pages; wordIndex++) {
+        words[wordIndex] = 0u;
+    }
+}
+
+void DirtyPageTracker::markRange(size_t allocationSize, size_t offset, size_t size) {
+    if (size == 0u || offset >= allocationSize) {
+        return;
+    }
+    auto words = getDirtyPages(allocationSize);
+    auto pages = pagesCount.load();
+    if (offset >= pages * pageSize) {
+        // allocation grew since the bitmap was created
+        markAll();
+        return;
+    }
+
+    auto firstPage = offset / pageSize;
+    auto lastPage = (size > pages * pageSize - offset) ? pages - 1 : (offset + size - 1) / pageSize;
+    for (auto wordIndex = firstPage / pagesPerWord; wordIndex <= lastPage / pagesPerWord; wordIndex++) {
+        auto wordFirstPage = wordIndex * pagesPerWord;
+        auto firstBit = (firstPage > wordFirstPage) ? firstPage - wordFirstPage : 0u;
+        auto lastBit = (lastPage < wordFirstPage + pagesPerWord - 1) ? lastPage - wordFirstPage : pagesPerWord - 1;
+        auto mask = (~0ull >> (pagesPerWord - 1 - lastBit)) & (~0ull << firstBit);
+        words[wordIndex].fetch_or(mask);
+    }
+}
+
+bool DirtyPageTracker::isPageDirty(size_t pageIndex) const {
+    auto words = dirtyPages.load();
+    if (words == nullptr || pageIndex >= pagesCount.load()) {
+        return false;
+    }
+    return (words[pageIndex / pagesPerWord].load() >> (pageIndex % pagesPerWord)) & 1u;
+}
+
+size_t DirtyPageTracker::getDirtyPagesCount() const {
+    auto words = dirtyPages.load();
+    if (words == nullptr) {
+        return 0u;
+    }
+    size_t count = 0u;
+    auto pages = pagesCount.load();
+    for (size_t wordIndex = 0; wordIndex * pagesPerWord < pages; wordIndex++) {
+        for (auto word = words[wordIndex].load(); word != 0u; word &= word - 1) {
+            count++;
+        }
+    }
+    return count;
+}
+
+} // namespace NEO
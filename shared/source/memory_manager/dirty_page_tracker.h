@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/memory_manager/memory_constants.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+
+// Pages of allocation modified by CPU since the allocation was last uploaded to simulation.
+// Pages are marked by api threads while CSR takes them, so the bitmap is allocated once and
+// only modified with atomic operations. Until the first upload whole allocation is dirty.
+class DirtyPageTracker {
+  public:
+    static constexpr size_t pageSize = MemoryConstants::pageSize;
+
+    DirtyPageTracker() = default;
+    ~DirtyPageTracker();
+    DirtyPageTracker(const DirtyPageTracker &) = delete;
+    DirtyPageTracker &operator=(const DirtyPageTracker &) = delete;
+
+    // false when whole allocation has to be uploaded
+    bool isTracking() const { return !allPagesDirty.load(); }
+
+    void markAll() { allPagesDirty = true; }
+    void markRange(size_t allocationSize, size_t offset, size_t size);
+    bool isPageDirty(size_t pageIndex) const;
+    size_t getDirtyPagesCount() const;
+
+    // calls rangeFunc(offset, size) for each contiguous run of dirty pages and clears them, ranges are clipped to allocationSize;
+    // pages are cleared before rangeFunc is called, so pages marked meanwhile stay dirty
+    template <typename RangeFuncT>
+    void takeDirtyRanges(size_t allocationSize, RangeFuncT &&rangeFunc);
+
+  protected:
+    static constexpr size_t pagesPerWord = 64u;
+
+    std::atomic<uint64_t> *getDirtyPages(size_t allocationSize);
+    void clearDirtyPages();
+
+    std::atomic<std::atomic<uint64_t> *> dirtyPages{nullptr};
+    std::atomic<size_t> pagesCount{0u};
+    std::atomic<bool> allPagesDirty{true};
+};
+
+template <typename RangeFuncT>
+void DirtyPageTracker::takeDirtyRanges(size_t allocationSize, RangeFuncT &&rangeFunc) {
+    if (allPagesDirty.exchange(false)) {
+        clearDirtyPages();
+        rangeFunc(0u, allocationSize);
+        return;
+    }
+
+    auto words = dirtyPages.load();
+    if (words == nullptr) {
+        return;
+    }
+    auto pages = pagesCount.load();
+    auto emitRange = [&](size_t firstPage, size_t endPage) {
+        auto offset = firstPage * pageSize;
+        if (offset < allocationSize) {
+            auto endOffset = endPage * pageSize;
+            rangeFunc(offset, (endOffset < allocationSize ? endOffset : allocationSize) - offset);
+        }
+    };
+
+    size_t runStart = pages;
+    for (size_t wordIndex = 0; wordIndex * pagesPerWord < pages; wordIndex++) {
+        auto word = words[wordIndex].exchange(0u);
+        bool inRun = runStart != pages;
+        if ((word == 0u && !inRun) || (word == ~0ull && inRun)) {
+            continue;
+        }
+        for (size_t bit = 0; bit < pagesPerWord; bit++) {
+            auto pageIndex = wordIndex * pagesPerWord + bit;
+            bool dirty = (word >> bit) & 1u;
+            if (dirty && runStart == pages) {
+                runStart = pageIndex;
+            } else if (!dirty && runStart != pages) {
+                emitRange(runStart, pageIndex);
+                runStart = pages;
+            }
+        }
+    }
+    if (runStart != pages) {
+        emitRange(runStart, pages);
+    }
+}
+
+} // namespace NEO
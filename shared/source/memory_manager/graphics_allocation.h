@@ -9,6 +9,7 @@
 
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/dirty_page_tracker.h"
 #include "shared/source/memory_manager/host_ptr_defines.h"
 #include "shared/source/memory_manager/memory_constants.h"
 #include "shared/source/memory_manager/memory_pool.h"
@@ -146,6 +147,10 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     bool isAubWritable(uint32_t banks) const;
     void setTbxWritable(bool writable, uint32_t banks);
     bool isTbxWritable(uint32_t banks) const;
+    void setAubWritableRange(size_t offset, size_t size, uint32_t banks);
+    void setTbxWritableRange(size_t offset, size_t size, uint32_t banks);
+    DirtyPageTracker &getAubDirtyPages() { return aubInfo.aubDirtyPages; }
+    DirtyPageTracker &getTbxDirtyPages() { return aubInfo.tbxDirtyPages; }
     void setAllocDumpable(bool dumpable) { aubInfo.allocDumpable = dumpable; }
     bool isAllocDumpable() const { return aubInfo.allocDumpable; }
     bool isMemObjectsAllocationWithWritableFlags() const { return aubInfo.memObjectsAllocationWithWritableFlags; }
@@ -233,8 +238,12 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
         uint32_t inspectionId = 0u;
     };
     struct AubInfo {
-        uint32_t aubWritable = std::numeric_limits<uint32_t>::max();
-        uint32_t tbxWritable = std::numeric_limits<uint32_t>::max();
+        // set by api threads and cleared by CSR uploading the allocation
+        std::atomic<uint32_t> aubWritable{std::numeric_limits<uint32_t>::max()};
+        std::atomic<uint32_t> tbxWritable{std::numeric_limits<uint32_t>::max()};
+        // pages to upload when allocation became writable again after a CPU write of known range
+        DirtyPageTracker aubDirtyPages;
+        DirtyPageTracker tbxDirtyPages;
         bool allocDumpable = false;
         bool memObjectsAllocationWithWritableFlags = false;
     };
@@ -9,9 +9,41 @@
 
 namespace NEO {
 
-void GraphicsAllocation::setAubWritable(bool writable, uint32_t banks) { aubInfo.aubWritable = writable; }
+// Pages are marked before the allocation is made writable and CSR makes one time writable allocation
+// not writable before taking its dirty pages, so no CPU write marked concurrently with upload is lost.
+void GraphicsAllocation::setAubWritable(bool writable, uint32_t banks) {
+    if (writable) {
+        aubInfo.aubDirtyPages.markAll();
+    }
+    aubInfo.aubWritable = writable;
+}
 bool GraphicsAllocation::isAubWritable(uint32_t banks) const { return (aubInfo.aubWritable != 0); }
-void GraphicsAllocation::setTbxWritable(bool writable, uint32_t banks) { aubInfo.tbxWritable = writable; }
+void GraphicsAllocation::setTbxWritable(bool writable, uint32_t banks) {
+    if (writable) {
+        aubInfo.tbxDirtyPages.markAll();
+    }
+    aubInfo.tbxWritable = writable;
+}
 bool GraphicsAllocation::isTbxWritable(uint32_t banks) const { return (aubInfo.tbxWritable != 0); }
 
+void GraphicsAllocation::setAubWritableRange(size_t offset, size_t size, uint32_t banks) {
+    if (isAubWritable(banks) && !aubInfo.aubDirtyPages.isTracking()) {
+        // whole allocation is uploaded anyway
+        return;
+    }
+    aubInfo.aubDirtyPages.markRange(this->size, offset, size);
+    if (!isAubWritable(banks)) {
+        aubInfo.aubWritable = true;
+    }
+}
+void GraphicsAllocation::setTbxWritableRange(size_t offset, size_t size, uint32_t banks) {
+    if (isTbxWritable(banks) && !aubInfo.tbxDirtyPages.isTracking()) {
+        return;
+    }
+    aubInfo.tbxDirtyPages.markRange(this->size, offset, size);
+    if (!isTbxWritable(banks)) {
+        aubInfo.tbxWritable = true;
+    }
+}
+
 } // namespace NEO
@@ -52,6 +52,8 @@ constexpr uint64_t maxSvmAddress = is64bit ? maxNBitValue(47) : maxNBitValue(32)
 namespace BlitterConstants {
 constexpr uint64_t maxBlitWidth = 0x7FC0; // 0x7FFF aligned to cacheline size
 constexpr uint64_t maxBlitHeight = 0x7FFF;
+constexpr uint64_t maxBlitPitch = 0x7FFF;
+constexpr uint64_t minSplitCopySize = 64 * MemoryConstants::megaByte;
 enum class BlitDirection : uint32_t {
     BufferToHostPtr,
     HostPtrToBuffer,
@@ -473,6 +473,8 @@ bool MemoryManager::copyMemoryToAllocation(GraphicsAllocation *graphicsAllocatio
         return false;
     }
     memcpy_s(graphicsAllocation->getUnderlyingBuffer(), graphicsAllocation->getUnderlyingBufferSize(), memoryToCopy, sizeToCopy);
+    graphicsAllocation->setAubWritableRange(0u, sizeToCopy, GraphicsAllocation::defaultBank);
+    graphicsAllocation->setTbxWritableRange(0u, sizeToCopy, GraphicsAllocation::defaultBank);
     return true;
 }
 
@@ -13,43 +13,142 @@
 
 #include "opencl/source/mem_obj/mem_obj_helper.h"
 
+#include <algorithm>
+
 namespace NEO {
 
+namespace {
+uint32_t getReaderSlotIndex() {
+    static std::atomic<uint32_t> nextReaderSlot{0u};
+    static thread_local uint32_t readerSlot = nextReaderSlot++ % SVMAllocsManager::MapBasedAllocationTracker::numReaderSlots;
+    return readerSlot;
+}
+} // namespace
+
+constexpr uint32_t SVMAllocsManager::MapBasedAllocationTracker::numReaderSlots;
+constexpr size_t SVMAllocsManager::MapBasedAllocationTracker::allocationsPerLockedLookup;
+
+SVMAllocsManager::MapBasedAllocationTracker::~MapBasedAllocationTracker() {
+    delete snapshot.load();
+    for (auto retiredSnapshot : retiredSnapshots) {
+        delete retiredSnapshot;
+    }
+    for (auto retiredSnapshot : gracePeriodSnapshots) {
+        delete retiredSnapshot;
+    }
+}
+
 void SVMAllocsManager::MapBasedAllocationTracker::insert(SvmAllocationData allocationsPair) {
+    std::lock_guard<SpinLock> lock(snapshotLock);
     allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.gpuAllocation->getGpuAddress()), allocationsPair));
+    snapshotOutdated = true;
 }
 
 void SVMAllocsManager::MapBasedAllocationTracker::remove(SvmAllocationData allocationsPair) {
+    std::lock_guard<SpinLock> lock(snapshotLock);
     SvmAllocationContainer::iterator iter;
     iter = allocations.find(reinterpret_cast<void *>(allocationsPair.gpuAllocation->getGpuAddress()));
     allocations.erase(iter);
+    snapshotOutdated = true;
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
-    SvmAllocationContainer::iterator Iter, End;
-    SvmAllocationData *svmAllocData;
     if (ptr == nullptr)
         return nullptr;
-    End = allocations.end();
-    Iter = allocations.lower_bound(ptr);
-    if (((Iter != End) && (Iter->first != ptr)) ||
-        (Iter == End)) {
-        if (Iter == allocations.begin()) {
-            Iter = End;
-        } else {
-            Iter--;
+
+    if (snapshotOutdated.load()) {
+        std::lock_guard<SpinLock> lock(snapshotLock);
+        if (snapshotOutdated.load()) {
+            // rebuilding on every lookup would make interleaved allocs, lookups and frees O(n) each
+            if (++lockedLookups <= allocations.size() / allocationsPerLockedLookup) {
+                return getLocked(ptr);
+            }
+            publishSnapshot();
         }
     }
-    if (Iter != End) {
-        svmAllocData = &Iter->second;
-        char *charPtr = reinterpret_cast<char *>(svmAllocData->gpuAllocation->getGpuAddress());
-        if (ptr < (charPtr + svmAllocData->size)) {
-            return svmAllocData;
+
+    auto &readerSlot = readerSlots[getReaderSlotIndex()];
+    auto epochIndex = enterReadSection(readerSlot);
+
+    SvmAllocationData *svmAllocData = nullptr;
+    auto currentSnapshot = snapshot.load();
+    if (currentSnapshot) {
+        auto address = reinterpret_cast<uintptr_t>(ptr);
+        auto entry = std::upper_bound(currentSnapshot->begin(), currentSnapshot->end(), address,
+                                      [](uintptr_t lookupAddress, const LookupEntry &lookupEntry) { return lookupAddress < lookupEntry.begin; });
+        if (entry != currentSnapshot->begin()) {
+            entry--;
+            if (address < entry->end) {
+                svmAllocData = entry->allocationData;
+            }
         }
     }
+
+    readerSlot.activeReaders[epochIndex]--;
+    return svmAllocData;
+}
+
+SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::getLocked(const void *ptr) {
+    auto iter = allocations.upper_bound(ptr);
+    if (iter == allocations.begin()) {
+        return nullptr;
+    }
+    iter--;
+    if (reinterpret_cast<uintptr_t>(ptr) < reinterpret_cast<uintptr_t>(iter->first) + iter->second.size) {
+        return &iter->second;
+    }
     return nullptr;
 }
 
+uint32_t SVMAllocsManager::MapBasedAllocationTracker::enterReadSection(ReaderSlot &readerSlot) {
+    // register under the current epoch, retry when the epoch advanced meanwhile so
+    // reclamation never misses a reader that loads the snapshot afterwards
+    while (true) {
+        auto currentEpoch = epoch.load();
+        auto epochIndex = static_cast<uint32_t>(currentEpoch & 1u);
+        readerSlot.activeReaders[epochIndex]++;
+        if (epoch.load() == currentEpoch) {
+            return epochIndex;
+        }
+        readerSlot.activeReaders[epochIndex]--;
+    }
+}
+
+void SVMAllocsManager::MapBasedAllocationTracker::publishSnapshot() {
+    auto newSnapshot = new LookupSnapshot;
+    newSnapshot->reserve(allocations.size());
+    for (auto &allocation : allocations) {
+        auto begin = reinterpret_cast<uintptr_t>(allocation.first);
+        newSnapshot->push_back({begin, begin + allocation.second.size, &allocation.second});
+    }
+
+    auto oldSnapshot = snapshot.exchange(newSnapshot);
+    snapshotOutdated = false;
+    lockedLookups = 0u;
+    if (oldSnapshot) {
+        retiredSnapshots.push_back(oldSnapshot);
+    }
+    reclaimSnapshots();
+}
+
+void SVMAllocsManager::MapBasedAllocationTracker::reclaimSnapshots() {
+    // snapshots in the grace period were replaced before the current epoch started, so only
+    // readers registered under the previous epoch can still use them; check without waiting
+    auto previousEpochIndex = static_cast<uint32_t>((epoch.load() + 1u) & 1u);
+    for (auto &readerSlot : readerSlots) {
+        if (readerSlot.activeReaders[previousEpochIndex].load() != 0u) {
+            return;
+        }
+    }
+
+    for (auto retiredSnapshot : gracePeriodSnapshots) {
+        delete retiredSnapshot;
+    }
+    gracePeriodSnapshots.swap(retiredSnapshots);
+    retiredSnapshots.clear();
+    epoch++;
+}
+
 void SVMAllocsManager::MapOperationsTracker::insert(SvmMapOperation mapOperation) {
     operations.insert(std::make_pair(mapOperation.regionSvmPtr, mapOperation));
 }
@@ -85,7 +184,6 @@ void *SVMAllocsManager::createSVMAlloc(uint32_t rootDeviceIndex, size_t size, co
     if (size == 0)
         return nullptr;
 
-    std::unique_lock<SpinLock> lock(mtx);
     if (!memoryManager->isLocalMemorySupported(rootDeviceIndex)) {
         return createZeroCopySvmAllocation(rootDeviceIndex, size, svmProperties);
     } else {
@@ -158,7 +256,6 @@ void *SVMAllocsManager::createSharedUnifiedMemoryAllocation(uint32_t rootDeviceI
 }
 
 SvmAllocationData *SVMAllocsManager::getSVMAlloc(const void *ptr) {
-    std::unique_lock<SpinLock> lock(mtx);
     return SVMAllocs.get(ptr);
 }
 
@@ -201,6 +298,7 @@ void *SVMAllocsManager::createZeroCopySvmAllocation(uint32_t rootDeviceIndex, si
     allocData.gpuAllocation = allocation;
     allocData.size = size;
 
+    std::unique_lock<SpinLock> lock(mtx);
     this->SVMAllocs.insert(allocData);
     return allocation->getUnderlyingBuffer();
 }
@@ -242,6 +340,7 @@ void *SVMAllocsManager::createUnifiedAllocationWithDeviceStorage(uint32_t rootDe
     allocData.device = unifiedMemoryProperties.device;
     allocData.size = size;
 
+    std::unique_lock<SpinLock> lock(mtx);
     this->SVMAllocs.insert(allocData);
     return svmPtr;
 }
@@ -7,14 +7,18 @@
 
 #pragma once
 #include "shared/source/helpers/common_types.h"
+#include "shared/source/memory_manager/memory_constants.h"
 #include "shared/source/unified_memory/unified_memory.h"
 #include "shared/source/utilities/spinlock.h"
 
 #include "memory_properties_flags.h"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <mutex>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -45,13 +49,52 @@ class SVMAllocsManager {
 
       public:
         using SvmAllocationContainer = std::map<const void *, SvmAllocationData>;
+        static constexpr uint32_t numReaderSlots = 16u;
+        // while the snapshot is outdated lookups search the map under the lock, the snapshot is rebuilt
+        // after one such lookup per this many tracked allocations, spreading the rebuild over lookups
+        static constexpr size_t allocationsPerLockedLookup = 16u;
+
+        MapBasedAllocationTracker() = default;
+        ~MapBasedAllocationTracker();
+        MapBasedAllocationTracker(const MapBasedAllocationTracker &) = delete;
+        MapBasedAllocationTracker &operator=(const MapBasedAllocationTracker &) = delete;
+
+        // get is lock-free while the lookup snapshot is up to date, insert and remove only mark it outdated
         void insert(SvmAllocationData);
         void remove(SvmAllocationData);
         SvmAllocationData *get(const void *);
         size_t getNumAllocs() const { return allocations.size(); };
 
       protected:
+        struct LookupEntry {
+            uintptr_t begin;
+            uintptr_t end;
+            SvmAllocationData *allocationData;
+        };
+        using LookupSnapshot = std::vector<LookupEntry>;
+
+        struct ReaderSlot {
+            std::atomic<uint32_t> activeReaders[2] = {{0u}, {0u}};
+            uint8_t padding[MemoryConstants::cacheLineSize - 2 * sizeof(std::atomic<uint32_t>)];
+        };
+
+        uint32_t enterReadSection(ReaderSlot &readerSlot);
+        SvmAllocationData *getLocked(const void *ptr);
+        void publishSnapshot();
+        void reclaimSnapshots();
+
         SvmAllocationContainer allocations;
+        std::atomic<LookupSnapshot *> snapshot{nullptr};
+        std::atomic<bool> snapshotOutdated{false};
+        size_t lockedLookups = 0u;
+        SpinLock snapshotLock;
+
+        // snapshots replaced during the current epoch and before its start, freed once
+        // no reader of an epoch preceding their replacement is left
+        std::atomic<uint64_t> epoch{0u};
+        std::vector<LookupSnapshot *> retiredSnapshots;
+        std::vector<LookupSnapshot *> gracePeriodSnapshots;
+        std::array<ReaderSlot, numReaderSlots> readerSlots;
     };
 
     struct MapOperationsTracker {
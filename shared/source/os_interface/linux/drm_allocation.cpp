@@ -24,6 +24,8 @@ std::string DrmAllocation::getAllocationInfoString() const {
 }
 
 uint64_t DrmAllocation::peekInternalHandle(MemoryManager *memoryManager) {
+    // exported buffer object must not be reused by another allocation
+    getBO()->setCacheable(false);
     return static_cast<uint64_t>((static_cast<DrmMemoryManager *>(memoryManager))->obtainFdFromHandle(getBO()->peekHandle(), this->rootDeviceIndex));
 }
 } // namespace NEO
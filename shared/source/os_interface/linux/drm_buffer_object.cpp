@@ -29,6 +29,8 @@
 
 namespace NEO {
 
+std::atomic<uint64_t> BufferObject::destroyedCount{0u};
+
 BufferObject::BufferObject(Drm *drm, int handle, size_t size, uint32_t rootDeviceIndex) : drm(drm), refCount(1), handle(handle), size(size), rootDeviceIndex(rootDeviceIndex), isReused(false) {
     this->tiling_mode = I915_TILING_NONE;
     this->lockedAddress = nullptr;
@@ -102,10 +104,32 @@ void BufferObject::fillExecObject(drm_i915_gem_exec_object2 &execObject, uint32_
     execObject.rsvd2 = 0;
 }
 
+bool BufferObject::isExecObjectFilled(const drm_i915_gem_exec_object2 &execObject, uint32_t drmContextId) const {
+    return execObject.handle == static_cast<uint32_t>(this->handle) &&
+           execObject.offset == this->gpuAddress &&
+           execObject.rsvd1 == drmContextId &&
+           (execObject.flags & EXEC_OBJECT_PINNED);
+}
+
+void BufferObject::fillExecObjects(BufferObject *const residency[], size_t residencyCount, const BufferObject *execObjectsOwners[], drm_i915_gem_exec_object2 *execObjectsStorage, uint32_t drmContextId) {
+    // BO may be destroyed and other one created at the same address, hence its handle and address are compared too
+    for (size_t i = 0; i < residencyCount; i++) {
+        auto bo = residency[i];
+        if (execObjectsOwners[i] != bo || !bo->isExecObjectFilled(execObjectsStorage[i], drmContextId)) {
+            bo->fillExecObject(execObjectsStorage[i], drmContextId);
+            execObjectsOwners[i] = bo;
+        }
+    }
+}
+
 int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, uint32_t drmContextId, BufferObject *const residency[], size_t residencyCount, drm_i915_gem_exec_object2 *execObjectsStorage) {
     for (size_t i = 0; i < residencyCount; i++) {
         residency[i]->fillExecObject(execObjectsStorage[i], drmContextId);
     }
+    return this->exec(used, startOffset, flags, requiresCoherency, drmContextId, residencyCount, execObjectsStorage);
+}
+
+int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, uint32_t drmContextId, size_t residencyCount, drm_i915_gem_exec_object2 *execObjectsStorage) {
     this->fillExecObject(execObjectsStorage[residencyCount], drmContextId);
 
     drm_i915_gem_execbuffer2 execbuf{};
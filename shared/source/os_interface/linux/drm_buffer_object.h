@@ -24,13 +24,22 @@ class BufferObject {
   public:
     BufferObject(Drm *drm, int handle, uint32_t rootDeviceIndex);
     BufferObject(Drm *drm, int handle, size_t size, uint32_t rootDeviceIndex);
-    MOCKABLE_VIRTUAL ~BufferObject(){};
+    MOCKABLE_VIRTUAL ~BufferObject() { destroyedCount++; };
 
     bool setTiling(uint32_t mode, uint32_t stride);
 
     MOCKABLE_VIRTUAL int pin(BufferObject *const boToPin[], size_t numberOfBos, uint32_t drmContextId);
 
     int exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, uint32_t drmContextId, BufferObject *const residency[], size_t residencyCount, drm_i915_gem_exec_object2 *execObjectsStorage);
+    // exec objects of residency must be already filled in execObjectsStorage, only exec object of this BO is filled
+    int exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, uint32_t drmContextId, size_t residencyCount, drm_i915_gem_exec_object2 *execObjectsStorage);
+
+    MOCKABLE_VIRTUAL void fillExecObject(drm_i915_gem_exec_object2 &execObject, uint32_t drmContextId);
+    bool isExecObjectFilled(const drm_i915_gem_exec_object2 &execObject, uint32_t drmContextId) const;
+    // fills exec objects of residency, skipping entries whose owner is the same BO and whose content is still valid
+    static void fillExecObjects(BufferObject *const residency[], size_t residencyCount, const BufferObject *execObjectsOwners[], drm_i915_gem_exec_object2 *execObjectsStorage, uint32_t drmContextId);
+    // exec objects kept for a BO pointer are valid only as long as no BO was destroyed, since another one may be created at the same address
+    static uint64_t getDestroyedCount() { return destroyedCount.load(); }
 
     int wait(int64_t timeoutNs);
     bool close();
@@ -49,9 +58,13 @@ class BufferObject {
     void setUnmapSize(uint64_t unmapSize) { this->unmapSize = unmapSize; }
     uint64_t peekUnmapSize() const { return unmapSize; }
     bool peekIsReusableAllocation() const { return this->isReused; }
+    void setCacheable(bool cacheable) { this->cacheable = cacheable; }
+    bool peekIsCacheable() const { return this->cacheable; }
     uint32_t peekRootDeviceIndex() { return rootDeviceIndex; }
 
   protected:
+    static std::atomic<uint64_t> destroyedCount;
+
     Drm *drm = nullptr;
 
     std::atomic<uint32_t> refCount;
@@ -60,12 +73,11 @@ class BufferObject {
     uint64_t size;
     uint32_t rootDeviceIndex = 0;
     bool isReused;
+    bool cacheable = false; // may be kept in buffer object cache after its allocation is freed
 
     //Tiling
     uint32_t tiling_mode;
 
-    MOCKABLE_VIRTUAL void fillExecObject(drm_i915_gem_exec_object2 &execObject, uint32_t drmContextId);
-
     uint64_t gpuAddress = 0llu;
 
     void *lockedAddress; // CPU side virtual address
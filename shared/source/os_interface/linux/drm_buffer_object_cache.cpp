@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_buffer_object_cache.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/memory_manager/memory_constants.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+constexpr size_t DrmBufferObjectCache::sizeClassesPerPowerOfTwo;
+
+size_t DrmBufferObjectCache::getSizeClass(size_t size) {
+    size = alignUp(std::max(size, MemoryConstants::pageSize), MemoryConstants::pageSize);
+    if (size <= sizeClassesPerPowerOfTwo * MemoryConstants::pageSize) {
+        return size;
+    }
+    auto granularity = static_cast<size_t>(Math::prevPowerOfTwo(static_cast<uint64_t>(size - 1))) / sizeClassesPerPowerOfTwo;
+    return alignUp(size, granularity);
+}
+
+bool DrmBufferObjectCache::take(size_t size, size_t alignment, const std::function<bool(const Entry &)> &isCompleted, Entry &entry) {
+    auto sizeClass = getSizeClass(size);
+    std::lock_guard<std::mutex> lock(mtx);
+    auto bucket = buckets.find(sizeClass);
+    if (bucket != buckets.end()) {
+        auto &entries = bucket->second;
+        for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+            if (isAligned(reinterpret_cast<uintptr_t>(it->cpuPtr), alignment) && isCompleted(*it)) {
+                entry = std::move(*it);
+                entries.erase(std::next(it).base());
+                if (entries.empty()) {
+                    buckets.erase(bucket);
+                }
+                cachedSize -= sizeClass;
+                hitsCount++;
+                return true;
+            }
+        }
+    }
+    missesCount++;
+    return false;
+}
+
+bool DrmBufferObjectCache::store(Entry &&entry, size_t size, std::vector<Entry> &evictedEntries) {
+    auto sizeClass = getSizeClass(size);
+    if (sizeClass != size || size > maxSize) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    trimLocked(maxSize - size, evictedEntries);
+    buckets[sizeClass].push_back(std::move(entry));
+    cachedSize += sizeClass;
+    return true;
+}
+
+void DrmBufferObjectCache::trim(size_t targetSize, std::vector<Entry> &evictedEntries) {
+    std::lock_guard<std::mutex> lock(mtx);
+    trimLocked(targetSize, evictedEntries);
+}
+
+void DrmBufferObjectCache::trimLocked(size_t targetSize, std::vector<Entry> &evictedEntries) {
+    // oldest entries of the biggest size classes go first, so that fewest buffer objects are released
+    while (cachedSize > targetSize) {
+        auto bucket = std::prev(buckets.end());
+        auto &entries = bucket->second;
+        evictedEntries.push_back(std::move(entries.front()));
+        entries.erase(entries.begin());
+        cachedSize -= bucket->first;
+        evictionsCount++;
+        if (entries.empty()) {
+            buckets.erase(bucket);
+        }
+    }
+}
+
+size_t DrmBufferObjectCache::getCachedSize() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return cachedSize;
+}
+
+size_t DrmBufferObjectCache::getCachedEntriesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    size_t count = 0u;
+    for (auto &bucket : buckets) {
+        count += bucket.second.size();
+    }
+    return count;
+}
+
+uint64_t DrmBufferObjectCache::getHitsCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return hitsCount;
+}
+
+uint64_t DrmBufferObjectCache::getMissesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return missesCount;
+}
+
+uint64_t DrmBufferObjectCache::getEvictionsCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return evictionsCount;
+}
+
+} // namespace NEO
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/utilities/stackvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+class BufferObject;
+
+// Buffer objects of freed allocations kept for reuse by allocations of the same size class.
+// Cache does not own any resources, evicted entries are returned to the caller for release.
+class DrmBufferObjectCache {
+  public:
+    struct Entry {
+        BufferObject *bo = nullptr;
+        void *cpuPtr = nullptr;
+        void *reservedAddress = nullptr;
+        size_t reservedSize = 0u;
+        // os context id and task count that has to be completed before the buffer object is reused
+        StackVec<std::pair<uint32_t, uint32_t>, 4> pendingTaskCounts;
+    };
+
+    static constexpr size_t sizeClassesPerPowerOfTwo = 4u;
+
+    DrmBufferObjectCache(size_t maxSize) : maxSize(maxSize) {}
+
+    // sizes up to 4 pages are page granular, bigger sizes are rounded up to 1/4 of previous power of two
+    static size_t getSizeClass(size_t size);
+
+    // takes most recently stored entry of size class of given size that is completed and satisfies alignment
+    bool take(size_t size, size_t alignment, const std::function<bool(const Entry &)> &isCompleted, Entry &entry);
+    // returns false when entry does not fit the cache, otherwise oldest entries are evicted to make room for it
+    bool store(Entry &&entry, size_t size, std::vector<Entry> &evictedEntries);
+    // evicts entries until total size of cached buffer objects is not bigger than targetSize
+    void trim(size_t targetSize, std::vector<Entry> &evictedEntries);
+
+    size_t getMaxSize() const { return maxSize; }
+    size_t getCachedSize() const;
+    size_t getCachedEntriesCount() const;
+    uint64_t getHitsCount() const;
+    uint64_t getMissesCount() const;
+    uint64_t getEvictionsCount() const;
+
+  protected:
+    void trimLocked(size_t targetSize, std::vector<Entry> &evictedEntries);
+
+    const size_t maxSize;
+    size_t cachedSize = 0u;
+    uint64_t hitsCount = 0u;
+    uint64_t missesCount = 0u;
+    uint64_t evictionsCount = 0u;
+    // size class -> entries ordered from least to most recently stored
+    std::map<size_t, std::vector<Entry>> buckets;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
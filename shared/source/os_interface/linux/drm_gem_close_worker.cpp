@@ -15,12 +15,18 @@
 #include "opencl/source/os_interface/linux/drm_command_stream.h"
 
 #include <atomic>
-#include <iostream>
-#include <queue>
-#include <stdio.h>
 
 namespace NEO {
 
+namespace {
+template <typename T>
+void updateMax(std::atomic<T> &maxValue, T value) {
+    T current = maxValue.load();
+    while (current < value && !maxValue.compare_exchange_weak(current, value)) {
+    }
+}
+} // namespace
+
 DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
     thread = Thread::create(worker, reinterpret_cast<void *>(this));
 }
@@ -42,15 +48,26 @@ DrmGemCloseWorker::~DrmGemCloseWorker() {
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
-    std::unique_lock<std::mutex> lock(closeWorkerMutex);
-    workCount++;
-    queue.push(bo);
-    lock.unlock();
+    auto previousHead = head.load(std::memory_order_relaxed);
+    auto item = new WorkItem{bo, Clock::now(), previousHead};
+    updateMax(statistics.maxQueueDepth, ++workCount);
+    while (!head.compare_exchange_weak(previousHead, item, std::memory_order_release, std::memory_order_relaxed)) {
+        item->next = previousHead;
+    }
+
+    // item may be already taken by the worker here
+    if (previousHead == nullptr) {
+        // worker may be going to sleep on an empty list, synchronize with its predicate check
+        std::lock_guard<std::mutex> lock(closeWorkerMutex);
+    }
     condition.notify_one();
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
-    active = false;
+    {
+        std::lock_guard<std::mutex> lock(closeWorkerMutex);
+        active = false;
+    }
     condition.notify_all();
     if (blocking) {
         closeThread();
@@ -61,47 +78,64 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
-inline void DrmGemCloseWorker::close(BufferObject *bo) {
-    bo->wait(-1);
-    memoryManager.unreference(bo, false);
-    workCount--;
-}
+DrmGemCloseWorker::WorkItem *DrmGemCloseWorker::takeAll() {
+    WorkItem *item = head.exchange(nullptr, std::memory_order_acquire);
 
-void *DrmGemCloseWorker::worker(void *arg) {
-    DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    BufferObject *workItem = nullptr;
-    std::queue<BufferObject *> localQueue;
-    std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
-    lock.unlock();
+    // list is built newest first, restore push order
+    WorkItem *batch = nullptr;
+    while (item) {
+        auto next = item->next;
+        item->next = batch;
+        batch = item;
+        item = next;
+    }
+    return batch;
+}
 
-    while (self->active) {
-        lock.lock();
-        workItem = nullptr;
+void DrmGemCloseWorker::closeBatch(WorkItem *batch) {
+    if (batch == nullptr) {
+        return;
+    }
 
-        while (self->queue.empty() && self->active) {
-            self->condition.wait(lock);
+    // every item holds a reference, so all BOs in the batch stay alive until the second pass
+    // and the same batch buffer pushed by many flushes is waited on once
+    waitedBufferObjects.clear();
+    for (auto item = batch; item; item = item->next) {
+        if (waitedBufferObjects.insert(item->bo).second) {
+            item->bo->wait(-1);
         }
+    }
 
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
-        }
+    while (batch) {
+        auto item = batch;
+        batch = item->next;
 
-        lock.unlock();
-        while (!localQueue.empty()) {
-            workItem = localQueue.front();
-            localQueue.pop();
-            self->close(workItem);
-        }
+        memoryManager.unreference(item->bo, false);
+
+        auto latency = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - item->pushTime).count());
+        statistics.totalCloseLatencyNs += latency;
+        updateMax(statistics.maxCloseLatencyNs, latency);
+        statistics.closedBufferObjects++;
+        delete item;
+        workCount--;
     }
+    statistics.processedBatches++;
+}
+
+void *DrmGemCloseWorker::worker(void *arg) {
+    DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
 
-    lock.lock();
-    while (!self->queue.empty()) {
-        workItem = self->queue.front();
-        self->queue.pop();
-        self->close(workItem);
+    while (self->active) {
+        auto batch = self->takeAll();
+        if (batch == nullptr) {
+            std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
+            self->condition.wait(lock, [self]() { return self->head.load() != nullptr || !self->active; });
+            continue;
+        }
+        self->closeBatch(batch);
     }
 
-    lock.unlock();
+    self->closeBatch(self->takeAll());
     self->workerDone.store(true);
     return nullptr;
 }
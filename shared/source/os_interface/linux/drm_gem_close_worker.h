@@ -7,12 +7,12 @@
 
 #pragma once
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
-#include <map>
+#include <memory>
 #include <mutex>
-#include <queue>
-#include <set>
+#include <unordered_set>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -24,6 +24,14 @@ enum class gemCloseWorkerMode {
     gemCloseWorkerActive
 };
 
+struct DrmGemCloseWorkerStatistics {
+    std::atomic<uint64_t> closedBufferObjects{0u};
+    std::atomic<uint64_t> processedBatches{0u};
+    std::atomic<uint32_t> maxQueueDepth{0u};
+    std::atomic<uint64_t> totalCloseLatencyNs{0u}; // from push to unreference
+    std::atomic<uint64_t> maxCloseLatencyNs{0u};
+};
+
 class DrmGemCloseWorker {
   public:
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
@@ -36,17 +44,31 @@ class DrmGemCloseWorker {
     void close(bool blocking);
 
     bool isEmpty();
+    uint32_t getQueueDepth() const { return workCount.load(); }
+    const DrmGemCloseWorkerStatistics &getStatistics() const { return statistics; }
 
   protected:
-    void close(BufferObject *workItem);
+    using Clock = std::chrono::steady_clock;
+
+    // producers push with a CAS on the head, the worker detaches the whole list at once
+    struct WorkItem {
+        BufferObject *bo;
+        Clock::time_point pushTime;
+        WorkItem *next;
+    };
+
+    WorkItem *takeAll();
+    void closeBatch(WorkItem *batch);
     void closeThread();
     static void *worker(void *arg);
-    bool active = true;
+    std::atomic<bool> active{true};
 
     std::unique_ptr<Thread> thread;
 
-    std::queue<BufferObject *> queue;
+    std::atomic<WorkItem *> head{nullptr};
     std::atomic<uint32_t> workCount{0};
+    DrmGemCloseWorkerStatistics statistics;
+    std::unordered_set<BufferObject *> waitedBufferObjects;
 
     DrmMemoryManager &memoryManager;
 
@@ -21,6 +21,7 @@
 #include "shared/source/os_interface/linux/allocator_helper.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/linux/os_interface.h"
+#include "shared/source/os_interface/os_context.h"
 
 #include "drm/i915_drm.h"
 
@@ -59,9 +60,22 @@ DrmMemoryManager::DrmMemoryManager(gemCloseWorkerMode mode,
             pinBBs.push_back(nullptr);
         }
     }
+
+    if (DebugManager.flags.EnableBufferObjectCache.get()) {
+        size_t maxCacheSize = 128 * MemoryConstants::megaByte;
+        if (DebugManager.flags.BufferObjectCacheMaxSize.get() != -1) {
+            maxCacheSize = static_cast<size_t>(DebugManager.flags.BufferObjectCacheMaxSize.get()) * MemoryConstants::megaByte;
+        }
+        for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < gfxPartitions.size(); ++rootDeviceIndex) {
+            bufferObjectCaches.push_back(std::make_unique<DrmBufferObjectCache>(maxCacheSize));
+        }
+    }
 }
 
 DrmMemoryManager::~DrmMemoryManager() {
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < bufferObjectCaches.size(); ++rootDeviceIndex) {
+        trimBufferObjectCache(rootDeviceIndex);
+    }
     for (auto &memoryForPinBB : memoryForPinBBs) {
         if (memoryForPinBB) {
             MemoryManager::alignedFreeWrapper(memoryForPinBB);
@@ -79,6 +93,13 @@ void DrmMemoryManager::commonCleanup() {
         }
     }
     pinBBs.clear();
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < bufferObjectCaches.size(); ++rootDeviceIndex) {
+        auto cache = bufferObjectCaches[rootDeviceIndex].get();
+        printDebugString(DebugManager.flags.PrintDebugMessages.get(), stdout, "Buffer object cache of root device %u: hits %llu, misses %llu, evictions %llu\n",
+                         rootDeviceIndex, static_cast<unsigned long long>(cache->getHitsCount()), static_cast<unsigned long long>(cache->getMissesCount()),
+                         static_cast<unsigned long long>(cache->getEvictionsCount()));
+        trimBufferObjectCache(rootDeviceIndex);
+    }
 }
 
 void DrmMemoryManager::eraseSharedBufferObject(NEO::BufferObject *bo) {
@@ -181,23 +202,41 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignment(const Alloc
     // When size == 0 allocate allocationAlignment
     // It's needed to prevent overlapping pages with user pointers
     size_t cSize = std::max(alignUp(allocationData.size, minAlignment), minAlignment);
+    auto svmCpuAllocation = allocationData.type == GraphicsAllocation::AllocationType::SVM_CPU;
 
-    auto res = alignedMallocWrapper(cSize, cAlignment);
+    // buffer objects kept in cache are allocated with size of whole size class, so that they can be reused by allocations of similar size
+    auto cacheable = !svmCpuAllocation && getBufferObjectCache(allocationData.rootDeviceIndex);
+    size_t boSize = cSize;
+    if (cacheable) {
+        auto allocation = allocateGraphicsMemoryFromBufferObjectCache(allocationData, cSize, cAlignment);
+        if (allocation) {
+            return allocation;
+        }
+        boSize = DrmBufferObjectCache::getSizeClass(cSize);
+    }
+
+    auto res = alignedMallocWrapper(boSize, cAlignment);
+    if (!res && cacheable && trimBufferObjectCache(allocationData.rootDeviceIndex)) {
+        res = alignedMallocWrapper(boSize, cAlignment);
+    }
 
     if (!res)
         return nullptr;
 
-    BufferObject *bo = allocUserptr(reinterpret_cast<uintptr_t>(res), cSize, 0, allocationData.rootDeviceIndex);
+    BufferObject *bo = allocUserptr(reinterpret_cast<uintptr_t>(res), boSize, 0, allocationData.rootDeviceIndex);
+    if (!bo && cacheable && trimBufferObjectCache(allocationData.rootDeviceIndex)) {
+        bo = allocUserptr(reinterpret_cast<uintptr_t>(res), boSize, 0, allocationData.rootDeviceIndex);
+    }
 
     if (!bo) {
         alignedFreeWrapper(res);
         return nullptr;
     }
+    bo->setCacheable(cacheable);
 
     // if limitedRangeAlloction is enabled, memory allocation for bo in the limited Range heap is required
     uint64_t gpuAddress = 0;
-    size_t alignedSize = cSize;
-    auto svmCpuAllocation = allocationData.type == GraphicsAllocation::AllocationType::SVM_CPU;
+    size_t alignedSize = boSize;
     if (svmCpuAllocation) {
         //add 2MB padding in case reserved addr is not 2MB aligned
         alignedSize = alignUp(cSize, cAlignment) + cAlignment;
@@ -229,6 +268,19 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignment(const Alloc
     return allocation;
 }
 
+DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryFromBufferObjectCache(const AllocationData &allocationData, size_t size, size_t alignment) {
+    DrmBufferObjectCache::Entry entry;
+    auto isCompleted = [this](const DrmBufferObjectCache::Entry &cachedEntry) { return isCacheEntryCompleted(cachedEntry); };
+    if (!getBufferObjectCache(allocationData.rootDeviceIndex)->take(size, alignment, isCompleted, entry)) {
+        return nullptr;
+    }
+
+    auto allocation = new DrmAllocation(allocationData.rootDeviceIndex, allocationData.type, entry.bo, entry.cpuPtr, entry.bo->peekAddress(), size, MemoryPool::System4KBPages);
+    allocation->setDriverAllocatedCpuPtr(entry.cpuPtr);
+    allocation->setReservedAddressRange(entry.reservedAddress, entry.reservedSize);
+    return allocation;
+}
+
 DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithHostPtr(const AllocationData &allocationData) {
     auto res = static_cast<DrmAllocation *>(MemoryManager::allocateGraphicsMemoryWithHostPtr(allocationData));
 
@@ -553,6 +605,33 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
         }
     }
 
+    if (isCacheable(*gfxAllocation)) {
+        DrmBufferObjectCache::Entry entry;
+        entry.bo = static_cast<DrmAllocation *>(gfxAllocation)->getBO();
+        entry.cpuPtr = gfxAllocation->getDriverAllocatedCpuPtr();
+        entry.reservedAddress = gfxAllocation->getReservedAddressPtr();
+        entry.reservedSize = gfxAllocation->getReservedAddressSize();
+        for (auto &engine : getRegisteredEngines()) {
+            auto osContextId = engine.osContext->getContextId();
+            auto allocationTaskCount = gfxAllocation->getTaskCount(osContextId);
+            if (gfxAllocation->isUsedByOsContext(osContextId) &&
+                allocationTaskCount > *engine.commandStreamReceiver->getTagAddress()) {
+                entry.pendingTaskCounts.push_back({osContextId, allocationTaskCount});
+            }
+        }
+
+        std::vector<DrmBufferObjectCache::Entry> evictedEntries;
+        auto bufferObjectCache = getBufferObjectCache(gfxAllocation->getRootDeviceIndex());
+        auto boSize = static_cast<size_t>(entry.bo->peekSize());
+        if (bufferObjectCache->store(std::move(entry), boSize, evictedEntries)) {
+            releaseCacheEntries(evictedEntries);
+            delete gfxAllocation;
+            return;
+        }
+        // buffer object does not fit the cache, it may be still used by GPU
+        static_cast<DrmAllocation *>(gfxAllocation)->getBO()->wait(-1);
+    }
+
     if (gfxAllocation->fragmentsStorage.fragmentCount) {
         cleanGraphicsMemoryCreatedFromHostPtr(gfxAllocation);
     } else {
@@ -572,9 +651,64 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
 }
 
 void DrmMemoryManager::handleFenceCompletion(GraphicsAllocation *allocation) {
+    // cached buffer objects are not reused until their task counts are completed
+    if (isCacheable(*allocation)) {
+        return;
+    }
     static_cast<DrmAllocation *>(allocation)->getBO()->wait(-1);
 }
 
+DrmBufferObjectCache *DrmMemoryManager::getBufferObjectCache(uint32_t rootDeviceIndex) const {
+    return rootDeviceIndex < bufferObjectCaches.size() ? bufferObjectCaches[rootDeviceIndex].get() : nullptr;
+}
+
+bool DrmMemoryManager::trimBufferObjectCache(uint32_t rootDeviceIndex) {
+    auto bufferObjectCache = getBufferObjectCache(rootDeviceIndex);
+    if (!bufferObjectCache) {
+        return false;
+    }
+    std::vector<DrmBufferObjectCache::Entry> evictedEntries;
+    bufferObjectCache->trim(0u, evictedEntries);
+    releaseCacheEntries(evictedEntries);
+    return !evictedEntries.empty();
+}
+
+bool DrmMemoryManager::isCacheable(GraphicsAllocation &graphicsAllocation) const {
+    if (graphicsAllocation.fragmentsStorage.fragmentCount || !getBufferObjectCache(graphicsAllocation.getRootDeviceIndex())) {
+        return false;
+    }
+    auto bo = static_cast<DrmAllocation &>(graphicsAllocation).getBO();
+    return bo && bo->peekIsCacheable() && bo->getRefCount() == 1 &&
+           graphicsAllocation.peekSharedHandle() == Sharing::nonSharedResource;
+}
+
+bool DrmMemoryManager::isCacheEntryCompleted(const DrmBufferObjectCache::Entry &entry) {
+    for (auto &pendingTaskCount : entry.pendingTaskCounts) {
+        auto &engines = getRegisteredEngines();
+        auto engine = std::find_if(engines.begin(), engines.end(), [&](const EngineControl &registeredEngine) {
+            return registeredEngine.osContext->getContextId() == pendingTaskCount.first;
+        });
+        // completion cannot be checked when engine is already gone
+        if (engine == engines.end() || *engine->commandStreamReceiver->getTagAddress() < pendingTaskCount.second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DrmMemoryManager::releaseCacheEntries(std::vector<DrmBufferObjectCache::Entry> &entries) {
+    for (auto &entry : entries) {
+        // engines of pending task counts may be already gone, buffer object is waited for directly
+        if (entry.pendingTaskCounts.size() > 0) {
+            entry.bo->wait(-1);
+        }
+        auto rootDeviceIndex = entry.bo->peekRootDeviceIndex();
+        unreference(entry.bo, true);
+        releaseGpuRange(entry.reservedAddress, entry.reservedSize, rootDeviceIndex);
+        alignedFreeWrapper(entry.cpuPtr);
+    }
+}
+
 uint64_t DrmMemoryManager::getSystemSharedMemory(uint32_t rootDeviceIndex) {
     uint64_t hostMemorySize = MemoryConstants::pageSize * (uint64_t)(sysconf(_SC_PHYS_PAGES));
 
@@ -9,6 +9,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
+#include "shared/source/os_interface/linux/drm_buffer_object_cache.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
 
 #include "drm_gem_close_worker.h"
@@ -55,6 +56,10 @@ class DrmMemoryManager : public MemoryManager {
 
     int obtainFdFromHandle(int boHandle, uint32_t rootDeviceindex);
 
+    DrmBufferObjectCache *getBufferObjectCache(uint32_t rootDeviceIndex) const;
+    // releases cached buffer objects of given root device, returns false when cache was empty
+    bool trimBufferObjectCache(uint32_t rootDeviceIndex);
+
   protected:
     BufferObject *findAndReferenceSharedBufferObject(int boHandle);
     BufferObject *createSharedBufferObject(int boHandle, size_t size, bool requireSpecificBitness, uint32_t rootDeviceIndex);
@@ -66,6 +71,10 @@ class DrmMemoryManager : public MemoryManager {
     MOCKABLE_VIRTUAL void releaseGpuRange(void *address, size_t size, uint32_t rootDeviceIndex);
     void emitPinningRequest(BufferObject *bo, const AllocationData &allocationData) const;
     uint32_t getDefaultDrmContextId() const;
+    bool isCacheable(GraphicsAllocation &graphicsAllocation) const;
+    bool isCacheEntryCompleted(const DrmBufferObjectCache::Entry &entry);
+    void releaseCacheEntries(std::vector<DrmBufferObjectCache::Entry> &entries);
+    DrmAllocation *allocateGraphicsMemoryFromBufferObjectCache(const AllocationData &allocationData, size_t size, size_t alignment);
 
     DrmAllocation *createGraphicsAllocation(OsHandleStorage &handleStorage, const AllocationData &allocationData) override;
     DrmAllocation *allocateGraphicsMemoryForNonSvmHostPtr(const AllocationData &allocationData) override;
@@ -94,6 +103,7 @@ class DrmMemoryManager : public MemoryManager {
     decltype(&lseek) lseekFunction = lseek;
     decltype(&close) closeFunction = close;
     std::vector<BufferObject *> sharingBufferObjects;
+    std::vector<std::unique_ptr<DrmBufferObjectCache>> bufferObjectCaches;
     std::mutex mtx;
 };
 } // namespace NEO
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/os_file_lock_linux.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+namespace NEO {
+
+std::unique_ptr<OsFileLock> OsFileLock::lock(const std::string &fileName) {
+    int fd = ::open(fileName.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    int ret = 0;
+    do {
+        ret = flock(fd, LOCK_EX);
+    } while (ret != 0 && errno == EINTR);
+    if (ret != 0) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    return std::make_unique<OsFileLockLinux>(fd);
+}
+
+OsFileLockLinux::OsFileLockLinux(int fd) : fd(fd) {}
+
+OsFileLockLinux::~OsFileLockLinux() {
+    flock(fd, LOCK_UN);
+    ::close(fd);
+}
+
+} // namespace NEO
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/os_mapped_file_linux.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace NEO {
+
+std::unique_ptr<OsMappedFile> OsMappedFile::open(const std::string &fileName) {
+    int fd = ::open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat fileStat = {};
+    if ((fstat(fd, &fileStat) != 0) || (fileStat.st_size <= 0)) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    auto mappedSize = static_cast<size_t>(fileStat.st_size);
+    void *mappedData = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    // mapping keeps its own reference to the file, descriptor is not needed anymore
+    ::close(fd);
+    if (mappedData == MAP_FAILED) {
+        return nullptr;
+    }
+
+    return std::make_unique<OsMappedFileLinux>(mappedData, mappedSize);
+}
+
+OsMappedFileLinux::OsMappedFileLinux(void *mappedData, size_t mappedSize) {
+    data = static_cast<const char *>(mappedData);
+    size = mappedSize;
+}
+
+OsMappedFileLinux::~OsMappedFileLinux() {
+    munmap(const_cast<char *>(data), size);
+}
+
+} // namespace NEO
@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/os_interface/os_mapped_file.h"
+
+namespace NEO {
+
+class OsMappedFileLinux : public OsMappedFile {
+  public:
+    OsMappedFileLinux(void *mappedData, size_t mappedSize);
+    ~OsMappedFileLinux() override;
+};
+
+} // namespace NEO
@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <memory>
+#include <string>
+
+namespace NEO {
+
+// Exclusive advisory lock of a file, shared by all processes that lock the same file.
+// Lock is released when the object is destroyed.
+class OsFileLock {
+  public:
+    static std::unique_ptr<OsFileLock> lock(const std::string &fileName);
+
+    virtual ~OsFileLock() = default;
+};
+
+} // namespace NEO
@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace NEO {
+
+class OsMappedFile {
+  public:
+    static std::unique_ptr<OsMappedFile> open(const std::string &fileName);
+
+    virtual ~OsMappedFile() = default;
+
+    ArrayRef<const char> getData() const {
+        return ArrayRef<const char>(data, size);
+    }
+
+  protected:
+    const char *data = nullptr;
+    size_t size = 0U;
+};
+
+} // namespace NEO
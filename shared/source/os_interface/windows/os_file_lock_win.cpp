@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/windows/os_file_lock_win.h"
+
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
+namespace NEO {
+
+std::unique_ptr<OsFileLock> OsFileLock::lock(const std::string &fileName) {
+    HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                              OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    OVERLAPPED overlapped = {};
+    if (FALSE == LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    return std::make_unique<OsFileLockWindows>(file);
+}
+
+OsFileLockWindows::OsFileLockWindows(void *file) : file(file) {}
+
+OsFileLockWindows::~OsFileLockWindows() {
+    OVERLAPPED overlapped = {};
+    UnlockFileEx(file, 0, MAXDWORD, MAXDWORD, &overlapped);
+    CloseHandle(file);
+}
+
+} // namespace NEO
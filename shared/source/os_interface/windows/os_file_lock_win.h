@@ -0,0 +1,22 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/os_interface/os_file_lock.h"
+
+namespace NEO {
+
+class OsFileLockWindows : public OsFileLock {
+  public:
+    OsFileLockWindows(void *file);
+    ~OsFileLockWindows() override;
+
+  protected:
+    void *file;
+};
+
+} // namespace NEO
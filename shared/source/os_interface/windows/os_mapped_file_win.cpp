@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/windows/os_mapped_file_win.h"
+
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
+namespace NEO {
+
+std::unique_ptr<OsMappedFile> OsMappedFile::open(const std::string &fileName) {
+    HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize = {};
+    if ((FALSE == GetFileSizeEx(file, &fileSize)) || (fileSize.QuadPart <= 0)) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        return nullptr;
+    }
+
+    // view keeps its own reference to the mapping object
+    const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == nullptr) {
+        return nullptr;
+    }
+
+    return std::make_unique<OsMappedFileWindows>(view, static_cast<size_t>(fileSize.QuadPart));
+}
+
+OsMappedFileWindows::OsMappedFileWindows(const void *mappedView, size_t mappedSize) {
+    data = static_cast<const char *>(mappedView);
+    size = mappedSize;
+}
+
+OsMappedFileWindows::~OsMappedFileWindows() {
+    UnmapViewOfFile(data);
+}
+
+} // namespace NEO
@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/os_interface/os_mapped_file.h"
+
+namespace NEO {
+
+class OsMappedFileWindows : public OsMappedFile {
+  public:
+    OsMappedFileWindows(const void *mappedView, size_t mappedSize);
+    ~OsMappedFileWindows() override;
+};
+
+} // namespace NEO
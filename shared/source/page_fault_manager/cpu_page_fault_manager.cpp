@@ -7,18 +7,28 @@
 
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
+#include <algorithm>
 #include <mutex>
 
 namespace NEO {
+PageFaultManager::PageFaultManager() : migrationGranularity(2 * MemoryConstants::megaByte) {
+    if (DebugManager.flags.UnifiedMemoryMigrationGranularity.get() > 0) {
+        migrationGranularity = alignUp(static_cast<size_t>(DebugManager.flags.UnifiedMemoryMigrationGranularity.get()), MemoryConstants::pageSize);
+    }
+}
+
 void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ) {
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, false}));
+    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, false, {{0u, size}}}));
     this->transferToCpu(ptr, size, cmdQ);
+    statistics.bytesTransferredToCpu += size;
 }
 
 void PageFaultManager::removeAllocation(void *ptr) {
@@ -26,7 +36,11 @@ void PageFaultManager::removeAllocation(void *ptr) {
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
-        if (pageFaultData.isInGpuDomain) {
+        size_t cpuAccessibleSize = 0u;
+        for (auto &region : pageFaultData.cpuRegions) {
+            cpuAccessibleSize += region.size;
+        }
+        if (pageFaultData.isInGpuDomain || cpuAccessibleSize < pageFaultData.size) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         }
         this->memoryData.erase(ptr);
@@ -39,10 +53,7 @@ void PageFaultManager::moveAllocationToGpuDomain(void *ptr) {
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
         if (pageFaultData.isInGpuDomain == false) {
-            this->setAubWritable(false, ptr, pageFaultData.unifiedMemoryManager);
-            this->transferToGpu(ptr, pageFaultData.cmdQ);
-            this->protectCPUMemoryAccess(ptr, pageFaultData.size);
-            pageFaultData.isInGpuDomain = true;
+            this->migrateToGpuDomain(ptr, pageFaultData);
         }
     }
 }
@@ -53,28 +64,62 @@ void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocs
         auto allocPtr = alloc.first;
         auto &pageFaultData = alloc.second;
         if (pageFaultData.unifiedMemoryManager == unifiedMemoryManager && pageFaultData.isInGpuDomain == false) {
-            this->setAubWritable(false, allocPtr, pageFaultData.unifiedMemoryManager);
-            this->transferToGpu(allocPtr, pageFaultData.cmdQ);
-            this->protectCPUMemoryAccess(allocPtr, pageFaultData.size);
-            pageFaultData.isInGpuDomain = true;
+            this->migrateToGpuDomain(allocPtr, pageFaultData);
         }
     }
 }
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->allowCPUMemoryAccess(allocPtr, pageFaultData.size);
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            this->transferToCpu(allocPtr, pageFaultData.size, pageFaultData.cmdQ);
-            pageFaultData.isInGpuDomain = false;
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc == this->memoryData.begin()) {
+        return false;
+    }
+    --alloc;
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    if (ptr >= ptrOffset(allocPtr, pageFaultData.size)) {
+        return false;
+    }
+
+    auto faultOffset = ptrDiff(ptr, allocPtr);
+    for (auto &region : pageFaultData.cpuRegions) {
+        if (faultOffset >= region.offset && faultOffset < region.offset + region.size) {
+            // already migrated while handling concurrent fault
             return true;
         }
     }
-    return false;
+
+    auto chunkOffset = (faultOffset / migrationGranularity) * migrationGranularity;
+    auto chunkSize = std::min(migrationGranularity, pageFaultData.size - chunkOffset);
+    auto chunkPtr = ptrOffset(allocPtr, chunkOffset);
+
+    this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+    this->transferToCpu(chunkPtr, chunkSize, pageFaultData.cmdQ);
+    pageFaultData.cpuRegions.push_back({chunkOffset, chunkSize});
+    pageFaultData.isInGpuDomain = false;
+
+    statistics.bytesTransferredToCpu += chunkSize;
+    statistics.pageFaultsHandled++;
+    return true;
+}
+
+void PageFaultManager::migrateToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
+    this->setAubWritable(false, ptr, pageFaultData.unifiedMemoryManager);
+    for (auto &region : pageFaultData.cpuRegions) {
+        auto regionPtr = ptrOffset(ptr, region.offset);
+        this->transferToGpu(regionPtr, pageFaultData.cmdQ);
+        this->protectCPUMemoryAccess(regionPtr, region.size);
+        statistics.bytesTransferredToGpu += region.size;
+    }
+    pageFaultData.cpuRegions.clear();
+    pageFaultData.isInGpuDomain = true;
+}
+
+PageFaultManager::MigrationStatistics PageFaultManager::getMigrationStatistics() {
+    std::unique_lock<SpinLock> lock{mtx};
+    return statistics;
 }
 
 void PageFaultManager::setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) {
@@ -10,8 +10,10 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <cstdint>
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class SVMAllocsManager;
@@ -20,6 +22,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
   public:
     static std::unique_ptr<PageFaultManager> create();
 
+    PageFaultManager();
     virtual ~PageFaultManager() = default;
 
     void moveAllocationToGpuDomain(void *ptr);
@@ -27,12 +30,25 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     void insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ);
     void removeAllocation(void *ptr);
 
+    struct MigrationStatistics {
+        uint64_t bytesTransferredToCpu = 0u;
+        uint64_t bytesTransferredToGpu = 0u;
+        uint64_t pageFaultsHandled = 0u;
+    };
+    MigrationStatistics getMigrationStatistics();
+
   protected:
+    struct MigratedRegion {
+        size_t offset;
+        size_t size;
+    };
+
     struct PageFaultData {
         size_t size;
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         bool isInGpuDomain;
+        std::vector<MigratedRegion> cpuRegions; // accessible from cpu, transferred back on move to gpu domain
     };
 
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
@@ -43,7 +59,12 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    void migrateToGpuDomain(void *ptr, PageFaultData &pageFaultData);
+
+    // ordered by base address, so faulting address is resolved with a single lookup
+    std::map<void *, PageFaultData> memoryData;
+    MigrationStatistics statistics;
+    size_t migrationGranularity;
     SpinLock mtx;
 };
 } // namespace NEO
@@ -11,6 +11,7 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/program/program_info.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "opencl/source/program/kernel_info.h"
 #include "opencl/source/program/kernel_info_from_patchtokens.h"
@@ -26,12 +27,7 @@ bool requiresLocalMemoryWindowVA(const PatchTokenBinary::ProgramFromPatchtokens
     return false;
 }
 
-void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t kernelNum) {
-    auto kernelInfo = std::make_unique<KernelInfo>();
-    const PatchTokenBinary::KernelFromPatchtokens &decodedKernel = decodedProgram.kernels[kernelNum];
-
-    NEO::populateKernelInfo(*kernelInfo, decodedKernel, decodedProgram.header->GPUPointerSizeInBytes);
-
+void populateKernelLinkerInput(ProgramInfo &dst, const PatchTokenBinary::KernelFromPatchtokens &decodedKernel, uint32_t kernelNum) {
     if (decodedKernel.tokens.programSymbolTable) {
         dst.prepareLinkerInputStorage();
         dst.linkerInput->decodeExportedFunctionsSymbolTable(decodedKernel.tokens.programSymbolTable + 1, decodedKernel.tokens.programSymbolTable->NumEntries, kernelNum);
@@ -41,13 +37,24 @@ void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramF
         dst.prepareLinkerInputStorage();
         dst.linkerInput->decodeRelocationTable(decodedKernel.tokens.programRelocationTable + 1, decodedKernel.tokens.programRelocationTable->NumEntries, kernelNum);
     }
-
-    dst.kernelInfos.push_back(kernelInfo.release());
 }
 
 void populateProgramInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &src) {
+    ParallelForWorkers workers;
+    populateProgramInfo(dst, src, workers);
+}
+
+void populateProgramInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &src, ParallelForWorkers &workers) {
+    // kernel infos are independent and populated concurrently, linker input is shared and updated in kernels order
+    auto firstKernelInfo = dst.kernelInfos.size();
+    dst.kernelInfos.resize(firstKernelInfo + src.kernels.size(), nullptr);
+    parallelFor(workers, src.kernels.size(), PatchTokenBinary::getKernelsDecodeWorkersCount(src.kernels.size()), [&](size_t kernelNum) {
+        auto kernelInfo = new KernelInfo();
+        NEO::populateKernelInfo(*kernelInfo, src.kernels[kernelNum], src.header->GPUPointerSizeInBytes);
+        dst.kernelInfos[firstKernelInfo + kernelNum] = kernelInfo;
+    });
     for (uint32_t i = 0; i < src.kernels.size(); ++i) {
-        populateSingleKernelInfo(dst, src, i);
+        populateKernelLinkerInput(dst, src.kernels[i], i);
     }
 
     if (src.programScopeTokens.allocateConstantMemorySurface.empty() == false) {
@@ -11,6 +11,7 @@
 
 namespace NEO {
 
+class ParallelForWorkers;
 struct ProgramInfo;
 
 namespace PatchTokenBinary {
@@ -25,5 +26,6 @@ inline uint64_t readMisalignedUint64(const uint64_t *address) {
 bool requiresLocalMemoryWindowVA(const PatchTokenBinary::ProgramFromPatchtokens &src);
 
 void populateProgramInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &src);
+void populateProgramInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &src, ParallelForWorkers &workers);
 
 } // namespace NEO
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/binary_log.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+
+namespace NEO {
+
+namespace {
+std::atomic<uint64_t> nextWriterId{1u};
+} // namespace
+
+thread_local BinaryLogWriter::ThreadRingBuffers BinaryLogWriter::threadRingBuffers;
+thread_local bool BinaryLogWriter::threadRingBuffersExited = false;
+
+BinaryLogWriter::ThreadRingBuffers::~ThreadRingBuffers() {
+    threadRingBuffersExited = true;
+    cachedWriterId = 0u;
+    cachedRingBuffer = nullptr;
+    for (auto &weakRing : rings) {
+        if (auto ring = weakRing.lock()) {
+            ring->producerExited.store(true, std::memory_order_release);
+        }
+    }
+}
+
+constexpr size_t BinaryLogWriter::defaultRingBufferSize;
+constexpr uint32_t BinaryLogWriter::flushIntervalMs;
+
+BinaryLogWriter::BinaryLogWriter(const std::string &fileName, size_t ringBufferSize)
+    : ringBufferSize(std::max(ringBufferSize, 4 * sizeof(BinaryLog::RecordHeader))), writerId(nextWriterId++) {
+    file = fopen(fileName.c_str(), "wb");
+    if (file == nullptr) {
+        return;
+    }
+    BinaryLog::FileHeader header = {BinaryLog::magic, BinaryLog::version};
+    writeToFile(reinterpret_cast<const uint8_t *>(&header), sizeof(header));
+    flusher = Thread::create(flusherThread, reinterpret_cast<void *>(this));
+}
+
+BinaryLogWriter::~BinaryLogWriter() {
+    if (flusher) {
+        {
+            std::lock_guard<std::mutex> lock(flusherMutex);
+            stopFlusher = true;
+        }
+        flusherCondition.notify_one();
+        flusher->join();
+        flusher.reset();
+    }
+    if (file) {
+        drain();
+        fclose(file);
+        file = nullptr;
+    }
+}
+
+BinaryLogWriter::RingBuffer &BinaryLogWriter::getThreadRingBuffer() {
+    auto &threadRings = threadRingBuffers;
+    if (threadRings.cachedWriterId == writerId) {
+        return *threadRings.cachedRingBuffer;
+    }
+
+    std::shared_ptr<RingBuffer> ring;
+    auto &weakRings = threadRings.rings;
+    weakRings.erase(std::remove_if(weakRings.begin(), weakRings.end(), [](const std::weak_ptr<RingBuffer> &weakRing) { return weakRing.expired(); }), weakRings.end());
+    for (auto &weakRing : weakRings) {
+        auto threadRing = weakRing.lock();
+        if (threadRing && threadRing->writerId == writerId) {
+            ring = std::move(threadRing);
+            break;
+        }
+    }
+    if (ring == nullptr) {
+        ring = std::make_shared<RingBuffer>(ringBufferSize, writerId);
+        weakRings.push_back(ring);
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        rings.push_back(ring);
+    }
+    threadRings.cachedWriterId = writerId;
+    threadRings.cachedRingBuffer = ring.get();
+    return *ring;
+}
+
+void BinaryLogWriter::copyToRing(RingBuffer &ring, uint64_t position, const void *src, size_t size) {
+    auto offset = static_cast<size_t>(position % ring.size);
+    auto firstPart = std::min(size, ring.size - offset);
+    memcpy(ring.data.get() + offset, src, firstPart);
+    memcpy(ring.data.get(), reinterpret_cast<const uint8_t *>(src) + firstPart, size - firstPart);
+}
+
+void BinaryLogWriter::write(BinaryLog::RecordType type, int32_t value, const char *payload, size_t payloadSize) {
+    if (file == nullptr) {
+        return;
+    }
+
+    // records are at most half of the ring, so producer never waits for space that can not be freed
+    auto maxPayloadSize = ringBufferSize / 2 - sizeof(BinaryLog::RecordHeader);
+    if (payloadSize > maxPayloadSize) {
+        payloadSize = maxPayloadSize;
+        truncatedRecords++;
+    }
+    auto recordSize = BinaryLog::getRecordSize(payloadSize);
+
+    BinaryLog::RecordHeader header = {};
+    header.timestampNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    header.threadId = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    header.value = value;
+    header.payloadSize = static_cast<uint32_t>(payloadSize);
+    header.type = static_cast<uint16_t>(type);
+
+    if (threadRingBuffersExited) {
+        writeToFileDirectly(header, payload);
+        return;
+    }
+
+    auto &ring = getThreadRingBuffer();
+    auto head = ring.head.load(std::memory_order_relaxed);
+    while (ring.size - (head - ring.tail.load(std::memory_order_acquire)) < recordSize) {
+        requestFlush();
+        std::this_thread::yield();
+    }
+
+    copyToRing(ring, head, &header, sizeof(header));
+    copyToRing(ring, head + sizeof(header), payload, payloadSize);
+    ring.head.store(head + recordSize, std::memory_order_release);
+
+    if (head + recordSize - ring.tail.load(std::memory_order_relaxed) > ring.size / 2) {
+        requestFlush();
+    }
+}
+
+void BinaryLogWriter::writeToFileDirectly(const BinaryLog::RecordHeader &header, const char *payload) {
+    // drain writes rings to the file under the same lock, so records are not interleaved
+    std::lock_guard<std::mutex> drainLock(drainMutex);
+    const uint8_t padding[8] = {};
+    writeToFile(reinterpret_cast<const uint8_t *>(&header), sizeof(header));
+    writeToFile(reinterpret_cast<const uint8_t *>(payload), header.payloadSize);
+    writeToFile(padding, BinaryLog::getRecordSize(header.payloadSize) - sizeof(header) - header.payloadSize);
+}
+
+void BinaryLogWriter::flush() {
+    if (file) {
+        drain();
+    }
+}
+
+void BinaryLogWriter::requestFlush() {
+    if (false == flushRequested.exchange(true)) {
+        flusherCondition.notify_one();
+    }
+}
+
+void BinaryLogWriter::drain() {
+    std::lock_guard<std::mutex> drainLock(drainMutex);
+
+    std::vector<RingBuffer *> ringsSnapshot;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        ringsSnapshot.reserve(rings.size());
+        for (auto &ring : rings) {
+            ringsSnapshot.push_back(ring.get());
+        }
+    }
+
+    std::vector<RingBuffer *> exitedRings;
+    for (auto ring : ringsSnapshot) {
+        // producer writes nothing after marking exit, so its ring stays empty once drained
+        if (ring->producerExited.load(std::memory_order_acquire)) {
+            exitedRings.push_back(ring);
+        }
+        auto tail = ring->tail.load(std::memory_order_relaxed);
+        auto head = ring->head.load(std::memory_order_acquire);
+        if (head == tail) {
+            continue;
+        }
+        auto size = static_cast<size_t>(head - tail);
+        auto offset = static_cast<size_t>(tail % ring->size);
+        auto firstPart = std::min(size, ring->size - offset);
+        writeToFile(ring->data.get() + offset, firstPart);
+        if (size > firstPart) {
+            writeToFile(ring->data.get(), size - firstPart);
+        }
+        ring->tail.store(head, std::memory_order_release);
+    }
+    fflush(file);
+
+    if (false == exitedRings.empty()) {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        rings.erase(std::remove_if(rings.begin(), rings.end(), [&exitedRings](const std::shared_ptr<RingBuffer> &ring) {
+                        return std::find(exitedRings.begin(), exitedRings.end(), ring.get()) != exitedRings.end();
+                    }),
+                    rings.end());
+    }
+}
+
+void BinaryLogWriter::writeToFile(const uint8_t *data, size_t size) {
+    fwrite(data, 1, size, file);
+}
+
+void *BinaryLogWriter::flusherThread(void *arg) {
+    auto writer = reinterpret_cast<BinaryLogWriter *>(arg);
+
+    std::unique_lock<std::mutex> lock(writer->flusherMutex);
+    while (false == writer->stopFlusher) {
+        writer->flusherCondition.wait_for(lock, std::chrono::milliseconds(flushIntervalMs),
+                                          [writer]() { return writer->stopFlusher || writer->flushRequested.load(); });
+        writer->flushRequested = false;
+
+        lock.unlock();
+        writer->drain();
+        lock.lock();
+    }
+    return nullptr;
+}
+
+} // namespace NEO
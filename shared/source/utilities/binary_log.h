@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/utilities/arrayref.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+namespace BinaryLog {
+constexpr uint32_t magic = 0x474f4c4e; // "NLOG"
+constexpr uint32_t version = 1u;
+
+enum class RecordType : uint16_t {
+    ApiEnter = 1,
+    ApiLeave = 2,
+    Text = 3
+};
+
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+};
+
+// each record is followed by payloadSize bytes of payload and padded to 8 bytes
+struct RecordHeader {
+    uint64_t timestampNs;
+    uint64_t threadId;
+    int32_t value; // error code for ApiLeave
+    uint32_t payloadSize;
+    uint16_t type;
+    uint16_t reserved[3];
+};
+static_assert(sizeof(RecordHeader) == 32, "");
+
+inline size_t getRecordSize(size_t payloadSize) {
+    return (sizeof(RecordHeader) + payloadSize + 7) & ~static_cast<size_t>(7);
+}
+
+// Converts binary log to the text format of synchronous logging, records are ordered by timestamp.
+bool decode(ArrayRef<const uint8_t> binaryLog, std::string &outText);
+} // namespace BinaryLog
+
+// Logs records through per thread single producer ring buffers, drained to the file by a background thread.
+// Producers do not take locks unless their buffer is full or it is the first record of the thread.
+// Ring buffer of an exited thread is drained one last time and freed.
+// Records logged by a thread after its ring buffers were released (e.g. from other thread_local destructors) are written to the file directly.
+class BinaryLogWriter {
+  public:
+    static constexpr size_t defaultRingBufferSize = 256 * 1024;
+    static constexpr uint32_t flushIntervalMs = 10u;
+
+    BinaryLogWriter(const std::string &fileName, size_t ringBufferSize);
+    BinaryLogWriter(const std::string &fileName) : BinaryLogWriter(fileName, defaultRingBufferSize) {}
+    MOCKABLE_VIRTUAL ~BinaryLogWriter();
+
+    BinaryLogWriter(const BinaryLogWriter &) = delete;
+    BinaryLogWriter &operator=(const BinaryLogWriter &) = delete;
+
+    void write(BinaryLog::RecordType type, int32_t value, const char *payload, size_t payloadSize);
+    void flush();
+
+    bool isOpened() const { return file != nullptr; }
+    uint64_t getTruncatedRecords() const { return truncatedRecords.load(); }
+
+  protected:
+    struct RingBuffer {
+        RingBuffer(size_t size, uint64_t writerId) : data(new uint8_t[size]()), size(size), writerId(writerId) {}
+        std::unique_ptr<uint8_t[]> data;
+        const size_t size;
+        const uint64_t writerId;
+        std::atomic<uint64_t> head{0u};          // advanced by producer
+        std::atomic<uint64_t> tail{0u};          // advanced by flusher
+        std::atomic<bool> producerExited{false}; // set by producer thread on exit
+    };
+
+    // rings used by the current thread, marked as exited when the thread ends
+    struct ThreadRingBuffers {
+        ~ThreadRingBuffers();
+        uint64_t cachedWriterId = 0u;
+        RingBuffer *cachedRingBuffer = nullptr;
+        std::vector<std::weak_ptr<RingBuffer>> rings;
+    };
+    static thread_local ThreadRingBuffers threadRingBuffers;
+    static thread_local bool threadRingBuffersExited; // trivially destructible, valid until the thread ends
+
+    RingBuffer &getThreadRingBuffer();
+    void writeToFileDirectly(const BinaryLog::RecordHeader &header, const char *payload);
+    void copyToRing(RingBuffer &ring, uint64_t position, const void *src, size_t size);
+    void requestFlush();
+    void drain();
+    MOCKABLE_VIRTUAL void writeToFile(const uint8_t *data, size_t size);
+    static void *flusherThread(void *arg);
+
+    const size_t ringBufferSize;
+    const uint64_t writerId;
+    FILE *file = nullptr;
+
+    std::mutex ringsMutex;
+    std::vector<std::shared_ptr<RingBuffer>> rings; // only drain removes rings
+
+    std::mutex drainMutex;
+
+    std::mutex flusherMutex;
+    std::condition_variable flusherCondition;
+    std::atomic<bool> flushRequested{false};
+    bool stopFlusher = false;
+    std::unique_ptr<Thread> flusher;
+
+    std::atomic<uint64_t> truncatedRecords{0u};
+};
+
+} // namespace NEO
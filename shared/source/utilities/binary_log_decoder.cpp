@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/binary_log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+namespace NEO {
+namespace BinaryLog {
+bool decode(ArrayRef<const uint8_t> binaryLog, std::string &outText) {
+    FileHeader fileHeader = {};
+    if (binaryLog.size() < sizeof(fileHeader)) {
+        return false;
+    }
+    memcpy(&fileHeader, binaryLog.begin(), sizeof(fileHeader));
+    if ((fileHeader.magic != magic) || (fileHeader.version != version)) {
+        return false;
+    }
+
+    struct Record {
+        RecordHeader header;
+        const char *payload;
+    };
+    std::vector<Record> records;
+    size_t offset = sizeof(fileHeader);
+    while (offset < binaryLog.size()) {
+        Record record = {};
+        if (binaryLog.size() - offset < sizeof(RecordHeader)) {
+            return false;
+        }
+        memcpy(&record.header, binaryLog.begin() + offset, sizeof(RecordHeader));
+        auto recordSize = getRecordSize(record.header.payloadSize);
+        if (recordSize > binaryLog.size() - offset) {
+            return false;
+        }
+        record.payload = reinterpret_cast<const char *>(binaryLog.begin() + offset + sizeof(RecordHeader));
+        records.push_back(record);
+        offset += recordSize;
+    }
+
+    // each thread logs to its own buffer, restore global order
+    std::stable_sort(records.begin(), records.end(), [](const Record &lhs, const Record &rhs) {
+        return lhs.header.timestampNs < rhs.header.timestampNs;
+    });
+
+    std::stringstream ss;
+    for (auto &record : records) {
+        std::string payload(record.payload, record.header.payloadSize);
+        switch (static_cast<RecordType>(record.header.type)) {
+        case RecordType::ApiEnter:
+            ss << "ThreadID: " << record.header.threadId << " Function Enter: " << payload << std::endl;
+            break;
+        case RecordType::ApiLeave:
+            ss << "ThreadID: " << record.header.threadId << " Function Leave (" << record.header.value << "): " << payload << std::endl;
+            break;
+        case RecordType::Text:
+            ss << payload;
+            break;
+        default:
+            return false;
+        }
+    }
+    outText = ss.str();
+    return true;
+}
+} // namespace BinaryLog
+} // namespace NEO
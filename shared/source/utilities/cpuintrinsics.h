@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace NEO {
 namespace CpuIntrinsics {
 
@@ -14,5 +16,7 @@ void clFlush(void const *ptr);
 
 void pause();
 
+uint64_t rdtsc();
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -7,9 +7,339 @@
 
 #include "shared/source/utilities/heap_allocator.h"
 
+#include "shared/source/helpers/basic_math.h"
+
+#include <algorithm>
+
 namespace NEO {
 
+namespace {
+uint32_t getHighestSetBit(uint64_t value) {
+    static const uint8_t multiplyDeBruijnBitPosition[64] = {
+        63, 0, 58, 1, 59, 47, 53, 2, 60, 39, 48, 27, 54, 33, 42, 3,
+        61, 51, 37, 40, 49, 18, 28, 20, 55, 30, 34, 11, 43, 14, 22, 4,
+        62, 57, 46, 52, 38, 26, 32, 41, 50, 36, 17, 19, 29, 10, 13, 21,
+        56, 45, 25, 31, 35, 16, 9, 12, 44, 24, 15, 8, 23, 7, 6, 5};
+    value |= value >> 1;
+    value |= value >> 2;
+    value |= value >> 4;
+    value |= value >> 8;
+    value |= value >> 16;
+    value |= value >> 32;
+    return multiplyDeBruijnBitPosition[((value - (value >> 1)) * 0x07EDD5E59A4E28C2ull) >> 58];
+}
+
+uint32_t getLowestSetBit(uint64_t value) {
+    auto lowBits = static_cast<uint32_t>(value);
+    if (lowBits != 0u) {
+        return Math::getMinLsbSet(lowBits);
+    }
+    return 32u + Math::getMinLsbSet(static_cast<uint32_t>(value >> 32));
+}
+} // namespace
+
 bool operator<(const HeapChunk &hc1, const HeapChunk &hc2) {
     return hc1.ptr < hc2.ptr;
 }
+
+constexpr uint32_t HeapChunkBins::secondLevelBits;
+constexpr uint32_t HeapChunkBins::numSecondLevelBins;
+constexpr uint32_t HeapChunkBins::numFirstLevelBins;
+constexpr uint32_t HeapChunkBins::numBins;
+constexpr uint32_t HeapChunkBins::invalidBin;
+
+HeapChunkBins::HeapChunkBins() {
+    bins.fill(nullptr);
+    secondLevelBitmaps.fill(0u);
+}
+
+uint32_t HeapChunkBins::getBinIndex(size_t size) {
+    uint64_t size64 = size;
+    uint32_t firstLevel = getHighestSetBit(size64);
+    uint64_t secondLevel = (firstLevel >= secondLevelBits) ? (size64 >> (firstLevel - secondLevelBits)) : (size64 << (secondLevelBits - firstLevel));
+    return firstLevel * numSecondLevelBins + static_cast<uint32_t>(secondLevel & (numSecondLevelBins - 1));
+}
+
+uint32_t HeapChunkBins::findNonEmptyBin(uint32_t minBin) const {
+    if (minBin >= numBins) {
+        return invalidBin;
+    }
+    uint32_t firstLevel = minBin / numSecondLevelBins;
+    uint32_t secondLevelMap = secondLevelBitmaps[firstLevel] & (~0u << (minBin % numSecondLevelBins));
+    if (secondLevelMap == 0u) {
+        if (firstLevel + 1 >= numFirstLevelBins) {
+            return invalidBin;
+        }
+        uint64_t firstLevelMap = firstLevelBitmap & (~0ull << (firstLevel + 1));
+        if (firstLevelMap == 0u) {
+            return invalidBin;
+        }
+        firstLevel = getLowestSetBit(firstLevelMap);
+        secondLevelMap = secondLevelBitmaps[firstLevel];
+    }
+    return firstLevel * numSecondLevelBins + Math::getMinLsbSet(secondLevelMap);
+}
+
+HeapChunkBins::FreeChunk *HeapChunkBins::findChunk(size_t size) {
+    // best fit from the request's own size class first
+    FreeChunk *bestChunk = nullptr;
+    for (auto chunk = bins[getBinIndex(size)]; chunk != nullptr; chunk = chunk->nextInBin) {
+        if (chunk->size >= size && (bestChunk == nullptr || chunk->size < bestChunk->size)) {
+            bestChunk = chunk;
+            if (chunk->size == size) {
+                break;
+            }
+        }
+    }
+    if (bestChunk != nullptr) {
+        return bestChunk;
+    }
+
+    // otherwise take any chunk from the smallest non-empty bigger size class, every chunk there fits
+    auto bin = findNonEmptyBin(getBinIndex(size) + 1);
+    if (bin != invalidBin) {
+        return bins[bin];
+    }
+    return nullptr;
+}
+
+void HeapChunkBins::insertIntoBin(FreeChunk &chunk) {
+    auto bin = getBinIndex(chunk.size);
+    chunk.bin = bin;
+    chunk.prevInBin = nullptr;
+    chunk.nextInBin = bins[bin];
+    if (bins[bin] != nullptr) {
+        bins[bin]->prevInBin = &chunk;
+    }
+    bins[bin] = &chunk;
+
+    auto firstLevel = bin / numSecondLevelBins;
+    secondLevelBitmaps[firstLevel] |= 1u << (bin % numSecondLevelBins);
+    firstLevelBitmap |= 1ull << firstLevel;
+}
+
+void HeapChunkBins::removeFromBin(FreeChunk &chunk) {
+    auto bin = chunk.bin;
+    if (chunk.prevInBin != nullptr) {
+        chunk.prevInBin->nextInBin = chunk.nextInBin;
+    } else {
+        bins[bin] = chunk.nextInBin;
+    }
+    if (chunk.nextInBin != nullptr) {
+        chunk.nextInBin->prevInBin = chunk.prevInBin;
+    }
+
+    if (bins[bin] == nullptr) {
+        auto firstLevel = bin / numSecondLevelBins;
+        secondLevelBitmaps[firstLevel] &= ~(1u << (bin % numSecondLevelBins));
+        if (secondLevelBitmaps[firstLevel] == 0u) {
+            firstLevelBitmap &= ~(1ull << firstLevel);
+        }
+    }
+}
+
+void HeapChunkBins::remove(FreeChunksContainer::iterator chunk) {
+    removeFromBin(chunk->second);
+    chunks.erase(chunk);
+}
+
+void HeapChunkBins::store(uint64_t ptr, size_t size) {
+    if (size == 0u) {
+        return;
+    }
+
+    auto next = chunks.lower_bound(ptr);
+    bool mergeWithNext = (next != chunks.end()) && (next->second.ptr == ptr + size);
+    if (next != chunks.begin()) {
+        auto &prev = std::prev(next)->second;
+        if (prev.ptr + prev.size == ptr) {
+            // grow the preceding chunk in place
+            removeFromBin(prev);
+            prev.size += size;
+            if (mergeWithNext) {
+                prev.size += next->second.size;
+                remove(next);
+            }
+            insertIntoBin(prev);
+            return;
+        }
+    }
+    if (mergeWithNext) {
+        size += next->second.size;
+        remove(next);
+    }
+
+    auto &chunk = chunks.emplace(ptr, FreeChunk{ptr, size, 0u, nullptr, nullptr}).first->second;
+    insertIntoBin(chunk);
+}
+
+uint64_t HeapChunkBins::take(size_t size, size_t &sizeOfFreedChunk) {
+    sizeOfFreedChunk = 0;
+    if (size == 0u) {
+        return 0llu;
+    }
+
+    auto chunk = findChunk(size);
+    if (chunk == nullptr) {
+        return 0llu;
+    }
+
+    if (chunk->size < (size << 1)) {
+        auto ptr = chunk->ptr;
+        sizeOfFreedChunk = chunk->size;
+        remove(chunks.find(ptr));
+        return ptr;
+    }
+
+    size_t sizeDelta = chunk->size - size;
+    removeFromBin(*chunk);
+    chunk->size = sizeDelta;
+    insertIntoBin(*chunk);
+    return chunk->ptr + sizeDelta;
+}
+
+bool HeapChunkBins::takeChunkStartingAt(uint64_t ptr, size_t &chunkSize) {
+    auto chunk = chunks.find(ptr);
+    if (chunk == chunks.end()) {
+        return false;
+    }
+    chunkSize = chunk->second.size;
+    remove(chunk);
+    return true;
+}
+
+bool HeapChunkBins::takeChunkEndingAt(uint64_t endPtr, uint64_t &chunkPtr, size_t &chunkSize) {
+    auto chunk = chunks.lower_bound(endPtr);
+    if (chunk == chunks.begin()) {
+        return false;
+    }
+    chunk--;
+    if (chunk->second.ptr + chunk->second.size != endPtr) {
+        return false;
+    }
+    chunkPtr = chunk->second.ptr;
+    chunkSize = chunk->second.size;
+    remove(chunk);
+    return true;
+}
+
+size_t HeapChunkBins::getLargestChunkSize() const {
+    if (firstLevelBitmap == 0u) {
+        return 0u;
+    }
+    auto firstLevel = getHighestSetBit(firstLevelBitmap);
+    auto bin = firstLevel * numSecondLevelBins + getHighestSetBit(secondLevelBitmaps[firstLevel]);
+
+    size_t largestSize = 0u;
+    for (auto chunk = bins[bin]; chunk != nullptr; chunk = chunk->nextInBin) {
+        largestSize = std::max(largestSize, chunk->size);
+    }
+    return largestSize;
+}
+
+std::vector<HeapChunk> HeapChunkBins::getChunks() const {
+    std::vector<HeapChunk> ret;
+    ret.reserve(chunks.size());
+    for (auto &chunk : chunks) {
+        ret.emplace_back(chunk.second.ptr, chunk.second.size);
+    }
+    return ret;
+}
+
+uint64_t HeapAllocator::allocate(size_t &sizeToAllocate) {
+    sizeToAllocate = alignUp(sizeToAllocate, allocationAlignment);
+
+    std::lock_guard<std::mutex> lock(mtx);
+    DBG_LOG(PrintDebugMessages, __FUNCTION__, "Allocator usage == ", this->getUsage());
+    if (availableSize < sizeToAllocate) {
+        return 0llu;
+    }
+
+    bool bigAllocation = sizeToAllocate > sizeThreshold;
+    HeapChunkBins &freedChunks = bigAllocation ? freedChunksBig : freedChunksSmall;
+
+    size_t sizeOfFreedChunk = 0;
+    uint64_t ptrReturn = freedChunks.take(sizeToAllocate, sizeOfFreedChunk);
+
+    if (ptrReturn == 0llu) {
+        if (bigAllocation) {
+            if (pLeftBound + sizeToAllocate <= pRightBound) {
+                ptrReturn = pLeftBound;
+                pLeftBound += sizeToAllocate;
+            }
+        } else {
+            if (pRightBound - sizeToAllocate >= pLeftBound) {
+                pRightBound -= sizeToAllocate;
+                ptrReturn = pRightBound;
+            }
+        }
+    }
+
+    if (ptrReturn == 0llu) {
+        DBG_LOG(PrintDebugMessages, __FUNCTION__, "Allocation failed, fragmentation == ", this->collectStatistics().fragmentation);
+        return 0llu;
+    }
+
+    if (sizeOfFreedChunk > 0) {
+        availableSize -= sizeOfFreedChunk;
+        sizeToAllocate = sizeOfFreedChunk;
+    } else {
+        availableSize -= sizeToAllocate;
+    }
+    return ptrReturn;
+}
+
+void HeapAllocator::free(uint64_t ptr, size_t size) {
+    if (ptr == 0llu)
+        return;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    DBG_LOG(PrintDebugMessages, __FUNCTION__, "Allocator usage == ", this->getUsage());
+
+    if (ptr == pRightBound) {
+        pRightBound = ptr + size;
+        mergeFreedChunksIntoBounds();
+    } else if (ptr == pLeftBound - size) {
+        pLeftBound = ptr;
+        mergeFreedChunksIntoBounds();
+    } else if (ptr < pLeftBound) {
+        DEBUG_BREAK_IF(size <= sizeThreshold);
+        freedChunksBig.store(ptr, size);
+    } else {
+        freedChunksSmall.store(ptr, size);
+    }
+    availableSize += size;
+}
+
+void HeapAllocator::mergeFreedChunksIntoBounds() {
+    // freed chunks are coalesced on store, so at most one chunk borders each bound
+    size_t chunkSize = 0;
+    if (freedChunksSmall.takeChunkStartingAt(pRightBound, chunkSize)) {
+        pRightBound += chunkSize;
+    }
+    uint64_t chunkPtr = 0;
+    if (freedChunksBig.takeChunkEndingAt(pLeftBound, chunkPtr, chunkSize)) {
+        pLeftBound = chunkPtr;
+    }
+}
+
+HeapAllocatorStatistics HeapAllocator::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return collectStatistics();
+}
+
+HeapAllocatorStatistics HeapAllocator::collectStatistics() const {
+    HeapAllocatorStatistics statistics;
+    statistics.size = size;
+    statistics.usedSize = size - availableSize;
+    statistics.freeSize = availableSize;
+    statistics.freedChunksCount = freedChunksSmall.size() + freedChunksBig.size();
+    statistics.largestFreeBlock = std::max({pRightBound - pLeftBound,
+                                            static_cast<uint64_t>(freedChunksSmall.getLargestChunkSize()),
+                                            static_cast<uint64_t>(freedChunksBig.getLargestChunkSize())});
+    if (statistics.freeSize > 0u) {
+        statistics.fragmentation = 1.0 - static_cast<double>(statistics.largestFreeBlock) / static_cast<double>(statistics.freeSize);
+    }
+    return statistics;
+}
 } // namespace NEO
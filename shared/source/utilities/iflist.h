@@ -129,6 +129,16 @@ class IFList {
         return rest;
     }
 
+    template <bool C = ThreadSafe>
+    typename std::enable_if<!C, NodeObjectType *>::type removeFrontOne() {
+        NodeObjectType *front = head;
+        if (front != nullptr) {
+            head = front->next;
+            front->next = nullptr;
+        }
+        return front;
+    }
+
     template <bool C = ThreadSafe>
     typename std::enable_if<!C, void>::type splice(NodeObjectType &nodes) {
         if (head == nullptr) {
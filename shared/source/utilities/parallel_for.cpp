@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+ParallelForWorkers::~ParallelForWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopWorkers = true;
+    }
+    jobReady.notify_all();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+void ParallelForWorkers::run(size_t count, size_t workersCount, const std::function<void(size_t)> &func) {
+    auto numThreads = std::min(workersCount, count);
+    if (numThreads <= 1) {
+        for (size_t index = 0; index < count; index++) {
+            func(index);
+        }
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    jobFunc = &func;
+    jobCount = count;
+    nextIndex = 0u;
+    while (threads.size() < numThreads - 1) {
+        threads.emplace_back([this]() { workerLoop(); });
+    }
+    freeWorkerSlots = numThreads - 1;
+    lock.unlock();
+    jobReady.notify_all();
+
+    processIndices();
+
+    // workers which did not pick the job up yet are not waited for
+    lock.lock();
+    freeWorkerSlots = 0u;
+    jobDone.wait(lock, [this]() { return busyWorkers == 0u; });
+    jobFunc = nullptr;
+}
+
+void ParallelForWorkers::workerLoop() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        jobReady.wait(lock, [this]() { return stopWorkers || freeWorkerSlots > 0u; });
+        if (stopWorkers) {
+            return;
+        }
+        freeWorkerSlots--;
+        busyWorkers++;
+        lock.unlock();
+
+        processIndices();
+
+        lock.lock();
+        if (--busyWorkers == 0u) {
+            jobDone.notify_one();
+        }
+    }
+}
+
+void ParallelForWorkers::processIndices() {
+    for (auto index = nextIndex++; index < jobCount; index = nextIndex++) {
+        (*jobFunc)(index);
+    }
+}
+
+void parallelFor(ParallelForWorkers &workers, size_t count, size_t workersCount, const std::function<void(size_t)> &func) {
+    workers.run(count, workersCount, func);
+}
+
+void parallelFor(size_t count, size_t workersCount, const std::function<void(size_t)> &func) {
+    ParallelForWorkers workers;
+    workers.run(count, workersCount, func);
+}
+
+} // namespace NEO
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+// Worker threads shared by consecutive parallelFor calls of one caller thread.
+// Threads are started on first use and joined when the workers object is destroyed.
+class ParallelForWorkers : NonCopyableOrMovableClass {
+  public:
+    ParallelForWorkers() = default;
+    ~ParallelForWorkers();
+
+    void run(size_t count, size_t workersCount, const std::function<void(size_t)> &func);
+    size_t getThreadsCount() const { return threads.size(); }
+
+  protected:
+    void workerLoop();
+    void processIndices();
+
+    std::vector<std::thread> threads;
+    std::mutex mtx;
+    std::condition_variable jobReady;
+    std::condition_variable jobDone;
+    const std::function<void(size_t)> *jobFunc = nullptr;
+    size_t jobCount = 0u;
+    std::atomic<size_t> nextIndex{0u};
+    size_t freeWorkerSlots = 0u;
+    size_t busyWorkers = 0u;
+    bool stopWorkers = false;
+};
+
+// Calls func(index) for each index in [0, count) on up to workersCount threads, calling thread included.
+// Indices are handed out dynamically, so func must be safe to call concurrently for different indices.
+void parallelFor(ParallelForWorkers &workers, size_t count, size_t workersCount, const std::function<void(size_t)> &func);
+
+// Same as above with threads started for this call only.
+void parallelFor(size_t count, size_t workersCount, const std::function<void(size_t)> &func);
+
+} // namespace NEO
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/spinlock.h"
+
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace NEO {
+namespace {
+struct ParkingBucket {
+    std::mutex mtx;
+    std::condition_variable condition;
+};
+
+constexpr size_t numParkingBuckets = 64u;
+ParkingBucket parkingBuckets[numParkingBuckets];
+
+ParkingBucket &getParkingBucket(const SpinLock *spinLock) {
+    return parkingBuckets[(reinterpret_cast<uintptr_t>(spinLock) / sizeof(SpinLock)) % numParkingBuckets];
+}
+} // namespace
+
+void SpinLock::lockContended() {
+    contendedLocks.fetch_add(1u, std::memory_order_relaxed);
+
+    uint32_t pauses = 1u;
+    for (uint32_t iteration = 0u; iteration < maxSpinIterations; iteration++) {
+        // wait for release without hammering the cache line, then try to take it
+        if (state.load(std::memory_order_relaxed) == unlocked) {
+            uint32_t expected = unlocked;
+            if (state.compare_exchange_weak(expected, locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+        for (uint32_t i = 0u; i < pauses; i++) {
+            CpuIntrinsics::pause();
+        }
+        if (pauses < maxPausesPerIteration) {
+            pauses *= 2;
+        }
+    }
+
+    // the lock is held for longer than the spin budget, stop burning the cpu;
+    // the lock is taken as lockedWithWaiters, as other threads may still be parked
+    auto &parkingBucket = getParkingBucket(this);
+    std::unique_lock<std::mutex> parkingLock(parkingBucket.mtx);
+    while (state.exchange(lockedWithWaiters, std::memory_order_acquire) != unlocked) {
+        parkedWaits.fetch_add(1u, std::memory_order_relaxed);
+        parkingBucket.condition.wait(parkingLock);
+    }
+}
+
+void SpinLock::wakeWaiter() {
+    // taking the bucket mutex orders the notification after the waiter started waiting;
+    // all waiters are woken, as the bucket may be shared with waiters for other locks
+    auto &parkingBucket = getParkingBucket(this);
+    std::lock_guard<std::mutex> parkingLock(parkingBucket.mtx);
+    parkingBucket.condition.notify_all();
+}
+
+} // namespace NEO
@@ -7,8 +7,68 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <mutex>
 
 namespace NEO {
-using SpinLock = std::mutex;
+
+struct SpinLockStatistics {
+    uint64_t contendedLocks = 0u;
+    uint64_t parkedWaits = 0u;
+};
+
+// Lock for short critical sections. Uncontended lock/unlock is a single atomic operation,
+// contended lock spins with exponential PAUSE backoff and parks the thread when the
+// owner does not release the lock within the spin budget.
+// Parked threads wait on a parking bucket shared with other locks, so that the lock holds
+// only atomics and can be constant initialized, as std::mutex can.
+class SpinLock {
+  public:
+    static constexpr uint32_t maxSpinIterations = 64u;
+    static constexpr uint32_t maxPausesPerIteration = 32u;
+
+    constexpr SpinLock() = default;
+    SpinLock(const SpinLock &) = delete;
+    SpinLock &operator=(const SpinLock &) = delete;
+
+    void lock() {
+        uint32_t expected = unlocked;
+        if (!state.compare_exchange_strong(expected, locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+            lockContended();
+        }
+    }
+
+    bool try_lock() {
+        uint32_t expected = unlocked;
+        return state.compare_exchange_strong(expected, locked, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    void unlock() {
+        if (state.exchange(unlocked, std::memory_order_release) == lockedWithWaiters) {
+            wakeWaiter();
+        }
+    }
+
+    SpinLockStatistics getStatistics() const {
+        SpinLockStatistics statistics;
+        statistics.contendedLocks = contendedLocks.load(std::memory_order_relaxed);
+        statistics.parkedWaits = parkedWaits.load(std::memory_order_relaxed);
+        return statistics;
+    }
+
+  protected:
+    enum : uint32_t {
+        unlocked = 0u,
+        locked = 1u,
+        lockedWithWaiters = 2u
+    };
+
+    void lockContended();
+    void wakeWaiter();
+
+    std::atomic<uint32_t> state{unlocked};
+    std::atomic<uint64_t> contendedLocks{0u};
+    std::atomic<uint64_t> parkedWaits{0u};
+};
 } // namespace NEO
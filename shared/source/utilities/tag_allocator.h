@@ -10,6 +10,8 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/idlist.h"
+#include "shared/source/utilities/iflist.h"
+#include "shared/source/utilities/spinlock.h"
 
 #include <atomic>
 #include <cstdint>
@@ -87,17 +89,17 @@ class TagAllocator {
         tagPoolMemory.clear();
     }
 
+    // allocators are owned by a CSR and tags are taken under its ownership lock, so this lock is not contended
     NodeType *getTag() {
-        if (freeTags.peekIsEmpty()) {
-            releaseDeferredTags();
-        }
-        NodeType *node = freeTags.removeFrontOne().release();
-        if (!node) {
-            std::unique_lock<std::mutex> lock(allocatorMutex);
-            populateFreeTags();
-            node = freeTags.removeFrontOne().release();
+        NodeType *node = nullptr;
+        {
+            std::unique_lock<SpinLock> lock(freeTagsCacheLock);
+            node = freeTagsCache.removeFrontOne();
+            if (!node) {
+                refillFreeTagsCache();
+                node = freeTagsCache.removeFrontOne();
+            }
         }
-        usedTags.pushFrontOne(*node);
         node->incRefCount();
         node->tagForCpuAccess->initialize();
         return node;
@@ -114,9 +116,12 @@ class TagAllocator {
     }
 
   protected:
-    IDList<NodeType> freeTags;
-    IDList<NodeType> usedTags;
-    IDList<NodeType> deferredTags;
+    // tags returned by any thread are pushed without locking and moved to
+    // the cache all at once, only the cache is accessed under lock
+    IFList<NodeType, true> freeTags;
+    IFList<NodeType, false> freeTagsCache;
+    // kept in order of returning, oldest first, guarded by deferredTagsLock
+    IDList<NodeType, false> deferredTags;
     std::vector<GraphicsAllocation *> gfxAllocations;
     std::vector<NodeType *> tagPoolMemory;
 
@@ -127,19 +132,26 @@ class TagAllocator {
     size_t tagSize;
     bool doNotReleaseNodes = false;
 
-    std::mutex allocatorMutex;
+    SpinLock freeTagsCacheLock;
+    SpinLock deferredTagsLock;
 
     MOCKABLE_VIRTUAL void returnTagToFreePool(NodeType *node) {
-        NodeType *usedNode = usedTags.removeOne(*node).release();
-        DEBUG_BREAK_IF(usedNode == nullptr);
-        UNUSED_VARIABLE(usedNode);
         freeTags.pushFrontOne(*node);
     }
 
     void returnTagToDeferredPool(NodeType *node) {
-        NodeType *usedNode = usedTags.removeOne(*node).release();
-        DEBUG_BREAK_IF(!usedNode);
-        deferredTags.pushFrontOne(*usedNode);
+        std::unique_lock<SpinLock> lock(deferredTagsLock);
+        deferredTags.pushTailOne(*node);
+    }
+
+    void refillFreeTagsCache() {
+        if (freeTags.peekIsEmpty()) {
+            releaseDeferredTags();
+        }
+        if (freeTags.peekIsEmpty()) {
+            populateFreeTags();
+        }
+        freeTagsCache.splice(*freeTags.detachNodes());
     }
 
     void populateFreeTags() {
@@ -162,35 +174,41 @@ class TagAllocator {
             nodesMemory[i].tagForCpuAccess = reinterpret_cast<TagType *>(Start);
             nodesMemory[i].gpuAddress = gpuBaseAddress + (i * tagSize);
             nodesMemory[i].setDoNotReleaseNodes(doNotReleaseNodes);
-            freeTags.pushTailOne(nodesMemory[i]);
             Start += tagSize;
         }
         DEBUG_BREAK_IF(Start > End);
         UNUSED_VARIABLE(End);
+        for (size_t i = tagCount; i > 0; --i) {
+            freeTags.pushFrontOne(nodesMemory[i - 1]);
+        }
         tagPoolMemory.push_back(nodesMemory);
     }
 
     void releaseDeferredTags() {
-        IDList<NodeType, false> pendingFreeTags;
-        IDList<NodeType, false> pendingDeferredTags;
-        auto currentNode = deferredTags.detachNodes();
+        std::unique_lock<SpinLock> lock(deferredTagsLock);
+
+        // tags are usually returned in submission order, so stop at the first one not completed yet
+        bool released = false;
+        auto currentNode = deferredTags.peekHead();
+        while (currentNode != nullptr && currentNode->canBeReleased()) {
+            deferredTags.removeFrontOne().release();
+            freeTags.pushFrontOne(*currentNode);
+            released = true;
+            currentNode = deferredTags.peekHead();
+        }
+        if (released) {
+            return;
+        }
 
+        // otherwise release completed tags from the whole list, pending ones keep their order
         while (currentNode != nullptr) {
             auto nextNode = currentNode->next;
             if (currentNode->canBeReleased()) {
-                pendingFreeTags.pushFrontOne(*currentNode);
-            } else {
-                pendingDeferredTags.pushFrontOne(*currentNode);
+                deferredTags.removeOne(*currentNode).release();
+                freeTags.pushFrontOne(*currentNode);
             }
             currentNode = nextNode;
         }
-
-        if (!pendingFreeTags.peekIsEmpty()) {
-            freeTags.splice(*pendingFreeTags.detachNodes());
-        }
-        if (!pendingDeferredTags.peekIsEmpty()) {
-            deferredTags.splice(*pendingDeferredTags.detachNodes());
-        }
     }
 };
 } // namespace NEO
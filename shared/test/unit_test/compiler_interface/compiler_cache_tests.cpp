@@ -8,9 +8,12 @@
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/os_file_lock.h"
+#include "shared/source/os_interface/os_mapped_file.h"
 
 #include "opencl/source/compiler_interface/default_cl_cache_config.h"
 #include "opencl/test/unit_test/fixtures/device_fixture.h"
@@ -19,9 +22,14 @@
 #include "opencl/test/unit_test/mocks/mock_program.h"
 #include "test.h"
 
+#include "os_inc.h"
+
 #include <array>
+#include <cstdio>
 #include <list>
 #include <memory>
+#include <thread>
+#include <vector>
 
 using namespace NEO;
 using namespace std;
@@ -40,8 +48,26 @@ class CompilerCacheMock : public CompilerCache {
         return loadResult ? std::unique_ptr<char[]>{new char[1]} : nullptr;
     }
 
+    std::unique_ptr<OsMappedFile> mapCachedBinary(const std::string kernelFileHash) override {
+        mapInvoked++;
+        return loadResult ? std::make_unique<MockMappedFile>() : nullptr;
+    }
+
+    void enableMapping() {
+        config.mapCachedBinaries = true;
+    }
+
+    struct MockMappedFile : OsMappedFile {
+        MockMappedFile() {
+            data = binary;
+            size = sizeof(binary);
+        }
+        char binary[1] = {};
+    };
+
     bool cacheResult = false;
     uint32_t cacheInvoked = 0u;
+    uint32_t mapInvoked = 0u;
     bool loadResult = false;
 };
 
@@ -218,6 +244,7 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     string hash = CompilerCache::getCachedFileName(hwInfo, src, apiOptions, internalOptions);
     string hash2 = CompilerCache::getCachedFileName(hwInfo, src, apiOptions, internalOptions);
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
+    EXPECT_EQ(32u, hash.size());
 }
 
 TEST(CompilerCacheTests, GivenEmptyBinaryWhenCachingThenBinaryIsNotCached) {
@@ -254,6 +281,317 @@ TEST(CompilerCacheTests, GivenExistingConfigWhenLoadingFromCacheThenBinaryIsLoad
     EXPECT_NE(0U, size);
 }
 
+CompilerCacheConfig getLruTestCacheConfig(size_t cacheSize) {
+    auto config = getDefaultClCompilerCacheConfig();
+    config.cacheFileExtension = ".lru_test_cache";
+    config.cacheSize = cacheSize;
+    return config;
+}
+
+void removeLruTestCacheFiles(const CompilerCacheConfig &config, std::initializer_list<const char *> hashes) {
+    for (auto hash : hashes) {
+        std::remove((config.cacheDir + PATH_SEPARATOR + hash + config.cacheFileExtension).c_str());
+    }
+    std::remove((config.cacheDir + PATH_SEPARATOR + "index" + config.cacheFileExtension + "_index").c_str());
+    std::remove((config.cacheDir + PATH_SEPARATOR + "index" + config.cacheFileExtension + "_lock").c_str());
+}
+
+class CompilerCacheWithIndexStore : public CompilerCache {
+  public:
+    using CompilerCache::indexDirty;
+    using CompilerCache::indexStoreInterval;
+
+    CompilerCacheWithIndexStore(const CompilerCacheConfig &config) : CompilerCache(config) {}
+
+    std::unique_ptr<OsFileLock> lockIndexFile() override {
+        return failIndexLock ? nullptr : CompilerCache::lockIndexFile();
+    }
+
+    bool storeIndex(std::vector<std::string> &victims) override {
+        storeIndexCalled++;
+        return CompilerCache::storeIndex(victims);
+    }
+
+    bool failIndexLock = false;
+    uint32_t storeIndexCalled = 0u;
+};
+
+TEST(CompilerCacheTests, GivenCachedAndMissingBinariesWhenLoadingFromCacheThenStatisticsAreUpdated) {
+    auto config = getLruTestCacheConfig(0u);
+    {
+        CompilerCache cache(config);
+        char data[16] = {};
+
+        EXPECT_TRUE(cache.cacheBinary("STATS_HASH", data, sizeof(data)));
+        EXPECT_EQ(sizeof(data), cache.getStatistics().bytesStored);
+
+        size_t size = 0u;
+        EXPECT_NE(nullptr, cache.loadCachedBinary("STATS_HASH", size));
+        EXPECT_EQ(nullptr, cache.loadCachedBinary("STATS_HASH_MISSING", size));
+
+        EXPECT_EQ(1u, cache.getStatistics().hits);
+        EXPECT_EQ(1u, cache.getStatistics().misses);
+        EXPECT_EQ(sizeof(data), cache.getStatistics().bytesLoaded);
+        EXPECT_EQ(0u, cache.getStatistics().evictions);
+        EXPECT_EQ(sizeof(data), cache.getUsedBytes());
+    }
+    removeLruTestCacheFiles(config, {"STATS_HASH"});
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenCachingBinariesOverLimitThenLeastRecentlyUsedBinaryIsEvicted) {
+    auto config = getLruTestCacheConfig(64u);
+    {
+        CompilerCache cache(config);
+        char data[32] = {};
+        size_t size = 0u;
+
+        EXPECT_TRUE(cache.cacheBinary("LRU_HASH_A", data, sizeof(data)));
+        EXPECT_TRUE(cache.cacheBinary("LRU_HASH_B", data, sizeof(data)));
+        EXPECT_NE(nullptr, cache.loadCachedBinary("LRU_HASH_A", size));
+
+        EXPECT_TRUE(cache.cacheBinary("LRU_HASH_C", data, sizeof(data)));
+        EXPECT_EQ(1u, cache.getStatistics().evictions);
+        EXPECT_EQ(64u, cache.getUsedBytes());
+
+        EXPECT_EQ(nullptr, cache.loadCachedBinary("LRU_HASH_B", size));
+        EXPECT_NE(nullptr, cache.loadCachedBinary("LRU_HASH_A", size));
+        EXPECT_NE(nullptr, cache.loadCachedBinary("LRU_HASH_C", size));
+    }
+    removeLruTestCacheFiles(config, {"LRU_HASH_A", "LRU_HASH_B", "LRU_HASH_C"});
+}
+
+TEST(CompilerCacheTests, GivenBinaryBiggerThanCacheSizeLimitWhenCachingThenBinaryIsKept) {
+    auto config = getLruTestCacheConfig(16u);
+    {
+        CompilerCache cache(config);
+        char data[32] = {};
+        size_t size = 0u;
+
+        EXPECT_TRUE(cache.cacheBinary("BIG_HASH", data, sizeof(data)));
+        EXPECT_EQ(0u, cache.getStatistics().evictions);
+        EXPECT_NE(nullptr, cache.loadCachedBinary("BIG_HASH", size));
+    }
+    removeLruTestCacheFiles(config, {"BIG_HASH"});
+}
+
+TEST(CompilerCacheTests, GivenDestroyedCacheWhenNewCacheUsesSameDirectoryThenIndexIsRestored) {
+    auto config = getLruTestCacheConfig(64u);
+    char data[32] = {};
+    {
+        CompilerCache cache(config);
+        EXPECT_TRUE(cache.cacheBinary("INDEX_HASH_A", data, sizeof(data)));
+        EXPECT_TRUE(cache.cacheBinary("INDEX_HASH_B", data, sizeof(data)));
+    }
+    {
+        CompilerCache cache(config);
+        EXPECT_EQ(64u, cache.getUsedBytes());
+
+        EXPECT_TRUE(cache.cacheBinary("INDEX_HASH_C", data, sizeof(data)));
+        EXPECT_EQ(1u, cache.getStatistics().evictions);
+
+        size_t size = 0u;
+        EXPECT_EQ(nullptr, cache.loadCachedBinary("INDEX_HASH_A", size));
+        EXPECT_NE(nullptr, cache.loadCachedBinary("INDEX_HASH_B", size));
+    }
+    removeLruTestCacheFiles(config, {"INDEX_HASH_A", "INDEX_HASH_B", "INDEX_HASH_C"});
+}
+
+TEST(CompilerCacheTests, GivenMultipleThreadsWhenCachingAndLoadingBinariesThenAllBinariesAreConsistent) {
+    auto config = getLruTestCacheConfig(0u);
+    static const char *hashes[] = {"MT_HASH_0", "MT_HASH_1", "MT_HASH_2", "MT_HASH_3"};
+    {
+        CompilerCache cache(config);
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < 4; t++) {
+            threads.push_back(std::thread([&cache, t] {
+                std::array<char, 256> data;
+                data.fill(static_cast<char>(t));
+                for (uint32_t i = 0; i < 16; i++) {
+                    EXPECT_TRUE(cache.cacheBinary(hashes[t], data.data(), static_cast<uint32_t>(data.size())));
+                    size_t size = 0u;
+                    auto loaded = cache.loadCachedBinary(hashes[t], size);
+                    ASSERT_NE(nullptr, loaded);
+                    EXPECT_EQ(data.size(), size);
+                    EXPECT_EQ(0, memcmp(data.data(), loaded.get(), data.size()));
+                }
+            }));
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(64u, cache.getStatistics().hits);
+        EXPECT_EQ(4u * 256u, cache.getUsedBytes());
+    }
+    removeLruTestCacheFiles(config, {hashes[0], hashes[1], hashes[2], hashes[3]});
+}
+
+TEST(CompilerCacheTests, GivenCachesSharingDirectoryWhenEachCachesBinariesThenIndexKeepsBinariesOfAllCaches) {
+    auto config = getLruTestCacheConfig(64u);
+    char data[32] = {};
+    {
+        CompilerCacheWithIndexStore firstCache(config);
+        CompilerCacheWithIndexStore secondCache(config);
+        firstCache.indexStoreInterval = 1u;
+        secondCache.indexStoreInterval = 1u;
+
+        EXPECT_TRUE(firstCache.cacheBinary("SHARED_HASH_A", data, sizeof(data)));
+        EXPECT_TRUE(secondCache.cacheBinary("SHARED_HASH_B", data, sizeof(data)));
+        EXPECT_EQ(0u, secondCache.getStatistics().evictions);
+
+        EXPECT_TRUE(firstCache.cacheBinary("SHARED_HASH_C", data, sizeof(data)));
+        EXPECT_EQ(1u, firstCache.getStatistics().evictions);
+        EXPECT_EQ(64u, firstCache.getUsedBytes());
+    }
+    {
+        CompilerCache cache(config);
+        EXPECT_EQ(64u, cache.getUsedBytes());
+
+        size_t size = 0u;
+        EXPECT_EQ(nullptr, cache.loadCachedBinary("SHARED_HASH_A", size));
+        EXPECT_NE(nullptr, cache.loadCachedBinary("SHARED_HASH_B", size));
+        EXPECT_NE(nullptr, cache.loadCachedBinary("SHARED_HASH_C", size));
+    }
+    removeLruTestCacheFiles(config, {"SHARED_HASH_A", "SHARED_HASH_B", "SHARED_HASH_C"});
+}
+
+TEST(CompilerCacheTests, GivenIndexStoreIntervalWhenCachingBinariesThenIndexFileIsUpdatedOncePerInterval) {
+    auto config = getLruTestCacheConfig(0u);
+    auto indexFilePath = config.cacheDir + PATH_SEPARATOR + "index" + config.cacheFileExtension + "_index";
+    char data[32] = {};
+    {
+        CompilerCacheWithIndexStore cache(config);
+        cache.indexStoreInterval = 4u;
+
+        EXPECT_TRUE(cache.cacheBinary("BATCH_HASH_A", data, sizeof(data)));
+        EXPECT_TRUE(cache.cacheBinary("BATCH_HASH_B", data, sizeof(data)));
+        EXPECT_TRUE(cache.cacheBinary("BATCH_HASH_C", data, sizeof(data)));
+        EXPECT_EQ(0u, cache.storeIndexCalled);
+        EXPECT_FALSE(fileExists(indexFilePath));
+
+        EXPECT_TRUE(cache.cacheBinary("BATCH_HASH_D", data, sizeof(data)));
+        EXPECT_EQ(1u, cache.storeIndexCalled);
+        EXPECT_TRUE(fileExists(indexFilePath));
+        EXPECT_FALSE(cache.indexDirty);
+
+        EXPECT_TRUE(cache.cacheBinary("BATCH_HASH_E", data, sizeof(data)));
+        EXPECT_EQ(1u, cache.storeIndexCalled);
+        EXPECT_TRUE(cache.indexDirty);
+    }
+    {
+        CompilerCache cache(config);
+        EXPECT_EQ(5u * sizeof(data), cache.getUsedBytes());
+    }
+    removeLruTestCacheFiles(config, {"BATCH_HASH_A", "BATCH_HASH_B", "BATCH_HASH_C", "BATCH_HASH_D", "BATCH_HASH_E"});
+}
+
+TEST(CompilerCacheTests, GivenIndexFileLockNotTakenWhenStoringIndexThenIndexFileIsNotWrittenAndChangesAreKept) {
+    auto config = getLruTestCacheConfig(0u);
+    auto indexFilePath = config.cacheDir + PATH_SEPARATOR + "index" + config.cacheFileExtension + "_index";
+    char data[32] = {};
+    {
+        CompilerCacheWithIndexStore cache(config);
+        cache.indexStoreInterval = 1u;
+        cache.failIndexLock = true;
+
+        EXPECT_TRUE(cache.cacheBinary("LOCK_HASH_A", data, sizeof(data)));
+        EXPECT_EQ(1u, cache.storeIndexCalled);
+        EXPECT_FALSE(fileExists(indexFilePath));
+        EXPECT_TRUE(cache.indexDirty);
+
+        cache.failIndexLock = false;
+        EXPECT_TRUE(cache.cacheBinary("LOCK_HASH_B", data, sizeof(data)));
+        EXPECT_EQ(2u, cache.storeIndexCalled);
+        EXPECT_TRUE(fileExists(indexFilePath));
+        EXPECT_FALSE(cache.indexDirty);
+    }
+    {
+        CompilerCache cache(config);
+        EXPECT_EQ(2u * sizeof(data), cache.getUsedBytes());
+    }
+    removeLruTestCacheFiles(config, {"LOCK_HASH_A", "LOCK_HASH_B"});
+}
+
+TEST(CompilerCacheTests, GivenBinaryNotListedInIndexWhenCacheIsUsedThenBinaryCountsAgainstLimitAndIsEvictedFirst) {
+    auto config = getLruTestCacheConfig(64u);
+    char data[32] = {};
+    auto unlistedFilePath = config.cacheDir + PATH_SEPARATOR + "UNLISTED_HASH" + config.cacheFileExtension;
+    ASSERT_EQ(sizeof(data), writeDataToFile(unlistedFilePath.c_str(), data, sizeof(data)));
+    {
+        CompilerCache cache(config);
+        EXPECT_EQ(sizeof(data), cache.getUsedBytes());
+
+        EXPECT_TRUE(cache.cacheBinary("LISTED_HASH_A", data, sizeof(data)));
+        EXPECT_EQ(0u, cache.getStatistics().evictions);
+        EXPECT_TRUE(cache.cacheBinary("LISTED_HASH_B", data, sizeof(data)));
+        EXPECT_EQ(1u, cache.getStatistics().evictions);
+        EXPECT_FALSE(fileExists(unlistedFilePath));
+        EXPECT_EQ(64u, cache.getUsedBytes());
+    }
+    removeLruTestCacheFiles(config, {"UNLISTED_HASH", "LISTED_HASH_A", "LISTED_HASH_B"});
+}
+
+TEST(CompilerCacheTests, GivenBinaryCachedWithLegacyKeyWhenCacheIsUsedThenBinaryIsKeptUntilEvicted) {
+    auto config = getLruTestCacheConfig(64u);
+    char data[32] = {};
+    auto legacyFilePath = config.cacheDir + PATH_SEPARATOR + "0123456789abcdef" + config.cacheFileExtension;
+    ASSERT_EQ(sizeof(data), writeDataToFile(legacyFilePath.c_str(), data, sizeof(data)));
+    {
+        CompilerCache cache(config);
+        EXPECT_EQ(sizeof(data), cache.getUsedBytes());
+        EXPECT_TRUE(fileExists(legacyFilePath));
+
+        EXPECT_TRUE(cache.cacheBinary("LEGACY_TEST_HASH_A", data, sizeof(data)));
+        EXPECT_TRUE(fileExists(legacyFilePath));
+        EXPECT_TRUE(cache.cacheBinary("LEGACY_TEST_HASH_B", data, sizeof(data)));
+        EXPECT_EQ(1u, cache.getStatistics().evictions);
+        EXPECT_FALSE(fileExists(legacyFilePath));
+    }
+    removeLruTestCacheFiles(config, {"0123456789abcdef", "LEGACY_TEST_HASH_A", "LEGACY_TEST_HASH_B"});
+}
+
+TEST(CompilerCacheTests, GivenCachedBinaryWhenMappingFromCacheThenMappedDataMatchesCachedBinary) {
+    auto config = getLruTestCacheConfig(0u);
+    config.mapCachedBinaries = true;
+    {
+        CompilerCache cache(config);
+        EXPECT_TRUE(cache.isMappingEnabled());
+        char data[32];
+        for (size_t i = 0; i < sizeof(data); i++) {
+            data[i] = static_cast<char>(i);
+        }
+
+        EXPECT_TRUE(cache.cacheBinary("MAP_HASH", data, sizeof(data)));
+        auto mapped = cache.mapCachedBinary("MAP_HASH");
+        ASSERT_NE(nullptr, mapped);
+        ASSERT_EQ(sizeof(data), mapped->getData().size());
+        EXPECT_EQ(0, memcmp(data, mapped->getData().begin(), sizeof(data)));
+
+        EXPECT_EQ(nullptr, cache.mapCachedBinary("MAP_HASH_MISSING"));
+        EXPECT_EQ(1u, cache.getStatistics().hits);
+        EXPECT_EQ(1u, cache.getStatistics().misses);
+        EXPECT_EQ(sizeof(data), cache.getStatistics().bytesLoaded);
+    }
+    removeLruTestCacheFiles(config, {"MAP_HASH"});
+}
+
+TEST(CompilerCacheTests, GivenMappedCachedBinaryWhenBinaryIsEvictedThenMappingStaysValid) {
+    auto config = getLruTestCacheConfig(32u);
+    config.mapCachedBinaries = true;
+    {
+        CompilerCache cache(config);
+        char data[32] = {1, 2, 3, 4};
+
+        EXPECT_TRUE(cache.cacheBinary("MAP_EVICT_HASH_A", data, sizeof(data)));
+        auto mapped = cache.mapCachedBinary("MAP_EVICT_HASH_A");
+        ASSERT_NE(nullptr, mapped);
+
+        EXPECT_TRUE(cache.cacheBinary("MAP_EVICT_HASH_B", data, sizeof(data)));
+        EXPECT_EQ(1u, cache.getStatistics().evictions);
+        EXPECT_EQ(0, memcmp(data, mapped->getData().begin(), sizeof(data)));
+    }
+    removeLruTestCacheFiles(config, {"MAP_EVICT_HASH_A", "MAP_EVICT_HASH_B"});
+}
+
 TEST(CompilerInterfaceCachedTests, GivenNoCachedBinaryWhenBuildingThenErrorIsReturned) {
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
 
@@ -312,6 +650,40 @@ TEST(CompilerInterfaceCachedTests, GivenCachedBinaryWhenBuildingThenSuccessIsRet
     gEnvironment->igcPopDebugVars();
 }
 
+TEST(CompilerInterfaceCachedTests, GivenCachedBinaryAndMappingEnabledWhenBuildingThenMappedBinaryIsReturned) {
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+
+    auto src = "#include \"header.h\"\n__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    std::unique_ptr<CompilerCacheMock> cache(new CompilerCacheMock());
+    cache->loadResult = true;
+    cache->enableMapping();
+    auto cachePtr = cache.get();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+
+    TranslationOutput translationOutput;
+    inputArgs.allowCaching = true;
+    MockDevice device;
+    auto err = compilerInterface->build(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_EQ(1u, cachePtr->mapInvoked);
+    EXPECT_NE(nullptr, translationOutput.mappedDeviceBinary);
+    EXPECT_EQ(nullptr, translationOutput.deviceBinary.mem);
+
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+}
+
 TEST(CompilerInterfaceCachedTests, givenKernelWithoutIncludesAndBinaryInCacheWhenCompilationRequestedThenFCLIsNotCalled) {
     MockClDevice device{new MockDevice};
     MockContext context(&device, true);
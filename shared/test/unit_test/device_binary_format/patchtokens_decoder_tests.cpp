@@ -7,6 +7,7 @@
 
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/helpers/hash.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "test.h"
 
@@ -1212,3 +1213,85 @@ TEST(ProgramDecoder, GivenProgramWithMultipleKernelsWhenFailsToDecodeKernelThenD
     EXPECT_EQ(2U, decodedProgram.header->NumberOfKernels);
     EXPECT_EQ(1U, decodedProgram.kernels.size());
 }
+
+TEST(ProgramDecoder, GivenProgramWithManyKernelsWhenDecodedByMultipleWorkersThenAllKernelsAreDecodedInOrder) {
+    DebugManagerStateRestore restore;
+    NEO::DebugManager.flags.PatchtokensDecodeWorkersCount.set(4);
+
+    PatchTokensTestData::ValidProgramWithKernelUsingSlm programToEncode;
+    auto kernelOffset = programToEncode.kernOffset;
+    std::vector<uint8_t> kernelBlob(programToEncode.kernels[0].blobs.kernelInfo.begin(), programToEncode.kernels[0].blobs.kernelInfo.end());
+    constexpr uint32_t numKernels = 64;
+    programToEncode.headerMutable->NumberOfKernels = numKernels;
+    for (uint32_t i = 1; i < numKernels; i++) {
+        programToEncode.storage.insert(programToEncode.storage.end(), kernelBlob.begin(), kernelBlob.end());
+    }
+
+    NEO::PatchTokenBinary::ProgramFromPatchtokens decodedProgram;
+    bool decodeSuccess = NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(programToEncode.storage, decodedProgram);
+    EXPECT_TRUE(decodeSuccess);
+    EXPECT_EQ(NEO::DecodeError::Success, decodedProgram.decodeStatus);
+    ASSERT_EQ(numKernels, decodedProgram.kernels.size());
+    for (uint32_t i = 0; i < numKernels; i++) {
+        auto &decodedKernel = decodedProgram.kernels[i];
+        EXPECT_EQ(NEO::DecodeError::Success, decodedKernel.decodeStatus);
+        EXPECT_EQ(programToEncode.storage.data() + kernelOffset + i * kernelBlob.size(), decodedKernel.blobs.kernelInfo.begin());
+        EXPECT_EQ(kernelBlob.size(), decodedKernel.blobs.kernelInfo.size());
+        EXPECT_NE(nullptr, decodedKernel.tokens.allocateLocalSurface);
+    }
+}
+
+TEST(ProgramDecoder, GivenProgramWithManyKernelsWhenDecodedByMultipleWorkersAndOneKernelFailsThenKernelsAfterInvalidOneAreDropped) {
+    DebugManagerStateRestore restore;
+    NEO::DebugManager.flags.PatchtokensDecodeWorkersCount.set(4);
+
+    PatchTokensTestData::ValidProgramWithKernelUsingSlm programToEncode;
+    auto kernelOffset = programToEncode.kernOffset;
+    auto slmTokenOffset = ptrDiff(programToEncode.slmMutable, programToEncode.kernels[0].blobs.kernelInfo.begin());
+    std::vector<uint8_t> kernelBlob(programToEncode.kernels[0].blobs.kernelInfo.begin(), programToEncode.kernels[0].blobs.kernelInfo.end());
+    constexpr uint32_t numKernels = 64;
+    constexpr uint32_t invalidKernelNum = 40;
+    programToEncode.headerMutable->NumberOfKernels = numKernels;
+    for (uint32_t i = 1; i < numKernels; i++) {
+        programToEncode.storage.insert(programToEncode.storage.end(), kernelBlob.begin(), kernelBlob.end());
+    }
+    auto invalidSlmToken = reinterpret_cast<iOpenCL::SPatchAllocateLocalSurface *>(programToEncode.storage.data() + kernelOffset + invalidKernelNum * kernelBlob.size() + slmTokenOffset);
+    invalidSlmToken->Size = 0U;
+
+    NEO::PatchTokenBinary::ProgramFromPatchtokens decodedProgram;
+    bool decodeSuccess = NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(programToEncode.storage, decodedProgram);
+    EXPECT_FALSE(decodeSuccess);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, decodedProgram.decodeStatus);
+    ASSERT_EQ(invalidKernelNum + 1, decodedProgram.kernels.size());
+    EXPECT_EQ(NEO::DecodeError::Success, decodedProgram.kernels[invalidKernelNum - 1].decodeStatus);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, decodedProgram.kernels[invalidKernelNum].decodeStatus);
+}
+
+TEST(ProgramDecoder, GivenProgramWithTruncatedLastKernelWhenDecodingThenDecodingFails) {
+    PatchTokensTestData::ValidProgramWithKernelUsingSlm programToEncode;
+    std::vector<uint8_t> kernelBlob(programToEncode.kernels[0].blobs.kernelInfo.begin(), programToEncode.kernels[0].blobs.kernelInfo.end());
+    programToEncode.headerMutable->NumberOfKernels = 2;
+    programToEncode.storage.insert(programToEncode.storage.end(), kernelBlob.begin(), kernelBlob.end() - 1);
+
+    NEO::PatchTokenBinary::ProgramFromPatchtokens decodedProgram;
+    bool decodeSuccess = NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(programToEncode.storage, decodedProgram);
+    EXPECT_FALSE(decodeSuccess);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, decodedProgram.decodeStatus);
+    ASSERT_EQ(2U, decodedProgram.kernels.size());
+    EXPECT_EQ(NEO::DecodeError::Success, decodedProgram.kernels[0].decodeStatus);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, decodedProgram.kernels[1].decodeStatus);
+}
+
+TEST(ProgramDecoder, WhenGettingKernelsDecodeWorkersCountThenSmallProgramsAreDecodedOnCallingThread) {
+    DebugManagerStateRestore restore;
+    EXPECT_EQ(1U, NEO::PatchTokenBinary::getKernelsDecodeWorkersCount(0U));
+    EXPECT_EQ(1U, NEO::PatchTokenBinary::getKernelsDecodeWorkersCount(1U));
+    EXPECT_EQ(1U, NEO::PatchTokenBinary::getKernelsDecodeWorkersCount(63U));
+    EXPECT_LE(NEO::PatchTokenBinary::getKernelsDecodeWorkersCount(1000U), 8U);
+    EXPECT_LE(1U, NEO::PatchTokenBinary::getKernelsDecodeWorkersCount(1000U));
+
+    NEO::DebugManager.flags.PatchtokensDecodeWorkersCount.set(0);
+    EXPECT_EQ(1U, NEO::PatchTokenBinary::getKernelsDecodeWorkersCount(1000U));
+    NEO::DebugManager.flags.PatchtokensDecodeWorkersCount.set(3);
+    EXPECT_EQ(3U, NEO::PatchTokenBinary::getKernelsDecodeWorkersCount(1U));
+}
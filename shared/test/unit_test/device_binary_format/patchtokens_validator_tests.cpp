@@ -8,6 +8,7 @@
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/device_binary_format/patchtokens_validator.h"
 #include "shared/test/unit_test/device_binary_format/patchtokens_tests.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -339,6 +340,26 @@ TEST(PatchtokensValidator, GivenProgramWithKernelWhenKernelHasInvalidChecksumThe
     EXPECT_TRUE(warning.empty());
 }
 
+TEST(PatchtokensValidator, GivenProgramWithManyKernelsWhenValidatedByMultipleWorkersThenFirstKernelWithInvalidChecksumFailsValidation) {
+    DebugManagerStateRestore restore;
+    NEO::DebugManager.flags.PatchtokensDecodeWorkersCount.set(4);
+
+    PatchTokensTestData::ValidProgramWithKernel prog;
+    std::string error, warning;
+    for (uint32_t i = 1; i < 64; i++) {
+        prog.kernels.push_back(prog.kernels[0]);
+    }
+    EXPECT_EQ(NEO::DecodeError::Success, NEO::PatchTokenBinary::validate(prog, error, warning));
+    EXPECT_TRUE(error.empty());
+
+    std::vector<uint8_t> invalidKernelBlob(prog.kernels[0].blobs.kernelInfo.begin(), prog.kernels[0].blobs.kernelInfo.end());
+    invalidKernelBlob.back() += 1;
+    prog.kernels[40].blobs.kernelInfo = ArrayRef<const uint8_t>(invalidKernelBlob.data(), invalidKernelBlob.size());
+    EXPECT_EQ(NEO::DecodeError::UnhandledBinary, NEO::PatchTokenBinary::validate(prog, error, warning));
+    EXPECT_STREQ("KernelFromPatchtokens has invalid checksum", error.c_str());
+    EXPECT_TRUE(warning.empty());
+}
+
 TEST(PatchtokensValidator, GivenValidProgramWithKernelUsingSlmThenValidationSucceeds) {
     PatchTokensTestData::ValidProgramWithKernelUsingSlm prog;
     std::string error, warning;
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash128.h"
+#include "shared/source/utilities/cpu_info.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::vector<char> getHashTestData(size_t size) {
+    std::vector<char> data(size);
+    uint32_t state = 0x12345678U;
+    for (auto &c : data) {
+        state = state * 1103515245U + 12345U;
+        c = static_cast<char>(state >> 24);
+    }
+    return data;
+}
+
+struct AccumulateStripesRestorer {
+    ~AccumulateStripesRestorer() {
+        Hash128::accumulateStripes = saved;
+    }
+    Hash128::AccumulateStripesFunc saved = Hash128::accumulateStripes;
+};
+} // namespace
+
+TEST(Hash128Tests, givenSameInputWhenHashIsCalculatedThenSameValueIsReturned) {
+    auto data = getHashTestData(1000);
+    auto hash1 = Hash128::hash(data.data(), data.size());
+    auto hash2 = Hash128::hash(data.data(), data.size());
+    EXPECT_EQ(hash1, hash2);
+}
+
+TEST(Hash128Tests, givenEmptyInputWhenHashIsCalculatedThenNullAndZeroSizedInputsGiveSameValue) {
+    char c = 'a';
+    EXPECT_EQ(Hash128::hash(nullptr, 0), Hash128::hash(&c, 0));
+    EXPECT_NE(Hash128::hash(nullptr, 0), Hash128::hash(&c, 1));
+}
+
+TEST(Hash128Tests, givenInputSplitIntoChunksWhenHashIsUpdatedThenResultMatchesSingleUpdate) {
+    auto data = getHashTestData(5 * Hash128::stripeSize * Hash128::stripesPerBlock + 17);
+    auto expected = Hash128::hash(data.data(), data.size());
+
+    for (size_t chunkSize : {1U, 7U, 63U, 64U, 65U, 1000U, 1024U, 4096U}) {
+        Hash128 hash;
+        for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+            hash.update(data.data() + offset, std::min(chunkSize, data.size() - offset));
+        }
+        EXPECT_EQ(expected, hash.finish()) << chunkSize;
+    }
+}
+
+TEST(Hash128Tests, givenHashWhenFinishIsCalledThenStateIsNotModifiedAndMoreDataCanBeAppended) {
+    auto data = getHashTestData(300);
+    Hash128 hash;
+    hash.update(data.data(), 100);
+    auto partial = hash.finish();
+    EXPECT_EQ(partial, hash.finish());
+    EXPECT_EQ(partial, Hash128::hash(data.data(), 100));
+
+    hash.update(data.data() + 100, 200);
+    EXPECT_EQ(Hash128::hash(data.data(), 300), hash.finish());
+
+    hash.reset();
+    EXPECT_EQ(Hash128::hash(nullptr, 0), hash.finish());
+}
+
+TEST(Hash128Tests, givenInputsDifferingInLengthOrSingleBitWhenHashIsCalculatedThenValuesAreUnique) {
+    auto data = getHashTestData(3 * Hash128::stripeSize * Hash128::stripesPerBlock);
+    std::set<std::pair<uint64_t, uint64_t>> hashes;
+
+    for (size_t size = 0; size <= data.size(); size += 13) {
+        auto hash = Hash128::hash(data.data(), size);
+        EXPECT_TRUE(hashes.insert({hash.low, hash.high}).second) << size;
+    }
+
+    std::vector<char> zeros(256, 0);
+    for (size_t size = 1; size <= zeros.size(); size++) {
+        auto hash = Hash128::hash(zeros.data(), size);
+        EXPECT_TRUE(hashes.insert({hash.low, hash.high}).second) << size;
+    }
+
+    for (size_t bit = 0; bit < 8 * 200; bit += 3) {
+        auto modified = data;
+        modified[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+        auto hash = Hash128::hash(modified.data(), modified.size());
+        EXPECT_TRUE(hashes.insert({hash.low, hash.high}).second) << bit;
+    }
+}
+
+TEST(Hash128Tests, givenHashValueWhenConvertedToStringThenHighAndLowPartsArePrintedAsHex) {
+    Hash128Value value;
+    value.high = 0x0123456789abcdefULL;
+    value.low = 0xfULL;
+    EXPECT_STREQ("0123456789abcdef000000000000000f", value.toString().c_str());
+}
+
+TEST(Hash128Tests, givenCpuSupportingVectorExtensionsWhenHashIsCalculatedThenResultMatchesScalarImplementation) {
+    AccumulateStripesRestorer restorer;
+    auto data = getHashTestData(7 * Hash128::stripeSize * Hash128::stripesPerBlock + 33);
+
+    Hash128::accumulateStripes = Hash128Accumulate::accumulateStripesScalar;
+    auto expected = Hash128::hash(data.data(), data.size());
+
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureSsE42)) {
+        Hash128::accumulateStripes = Hash128Accumulate::accumulateStripesSse4;
+        EXPECT_EQ(expected, Hash128::hash(data.data(), data.size()));
+    }
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        Hash128::accumulateStripes = Hash128Accumulate::accumulateStripesAvx2;
+        EXPECT_EQ(expected, Hash128::hash(data.data(), data.size()));
+    }
+}
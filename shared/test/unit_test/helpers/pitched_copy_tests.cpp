@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/pitched_copy.h"
+#include "shared/source/utilities/cpu_info.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+struct PitchedCopyTestSurfaces {
+    PitchedCopyTestSurfaces(size_t rowSize, size_t rowsCount, size_t slicesCount, size_t srcRowPitch, size_t dstRowPitch)
+        : rowSize(rowSize), rowsCount(rowsCount), slicesCount(slicesCount),
+          srcRowPitch(srcRowPitch), srcSlicePitch(srcRowPitch * rowsCount),
+          dstRowPitch(dstRowPitch), dstSlicePitch(dstRowPitch * rowsCount),
+          src(srcSlicePitch * slicesCount + 1), dst(dstSlicePitch * slicesCount + 1, 0xCD) {
+        uint32_t state = 0x12345678U;
+        for (auto &byte : src) {
+            state = state * 1103515245U + 12345U;
+            byte = static_cast<uint8_t>(state >> 24);
+        }
+    }
+
+    // destination starts at odd address, so that head and tail of each row are not aligned
+    void copy(PitchedCopy::CopyRowsFunc copyRows) {
+        for (size_t slice = 0; slice < slicesCount; slice++) {
+            copyRows(dst.data() + 1 + slice * dstSlicePitch, dstRowPitch, src.data() + slice * srcSlicePitch, srcRowPitch, rowSize, rowsCount);
+        }
+    }
+
+    void copy() {
+        PitchedCopy::copy(dst.data() + 1, dstRowPitch, dstSlicePitch, src.data(), srcRowPitch, srcSlicePitch, rowSize, rowsCount, slicesCount);
+    }
+
+    void verify() {
+        for (size_t slice = 0; slice < slicesCount; slice++) {
+            for (size_t row = 0; row < rowsCount; row++) {
+                auto dstRow = dst.data() + 1 + slice * dstSlicePitch + row * dstRowPitch;
+                auto srcRow = src.data() + slice * srcSlicePitch + row * srcRowPitch;
+                ASSERT_EQ(0, memcmp(dstRow, srcRow, rowSize)) << "slice " << slice << " row " << row;
+                for (size_t padding = rowSize; padding < dstRowPitch && (row + 1 < rowsCount || slice + 1 < slicesCount); padding++) {
+                    ASSERT_EQ(0xCD, dstRow[padding]) << "slice " << slice << " row " << row;
+                }
+            }
+        }
+        EXPECT_EQ(0xCD, dst[0]);
+    }
+
+    size_t rowSize, rowsCount, slicesCount;
+    size_t srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch;
+    std::vector<uint8_t> src;
+    std::vector<uint8_t> dst;
+};
+
+std::vector<PitchedCopy::CopyRowsFunc> getSupportedCopyRowsFuncs() {
+    std::vector<PitchedCopy::CopyRowsFunc> funcs = {PitchedCopyRows::copyRowsScalar};
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureSsE42)) {
+        funcs.push_back(PitchedCopyRows::copyRowsSse4);
+    }
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        funcs.push_back(PitchedCopyRows::copyRowsAvx2);
+    }
+    return funcs;
+}
+} // namespace
+
+TEST(PitchedCopyTests, givenRowSizesAroundVectorSizesWhenCopyingRowsThenAllVariantsCopyOnlyRowsContent) {
+    for (auto copyRows : getSupportedCopyRowsFuncs()) {
+        for (size_t rowSize : {1U, 15U, 16U, 17U, 31U, 32U, 33U, 127U, 128U, 129U, 1000U}) {
+            PitchedCopyTestSurfaces surfaces(rowSize, 5, 2, rowSize + 3, rowSize + 64);
+            surfaces.copy(copyRows);
+            surfaces.verify();
+        }
+    }
+}
+
+TEST(PitchedCopyTests, givenTightPitchesWhenCopyingThenSurfaceIsCopied) {
+    PitchedCopyTestSurfaces surfaces(4 * 33, 7, 3, 4 * 33, 4 * 33);
+    surfaces.copy();
+    surfaces.verify();
+}
+
+TEST(PitchedCopyTests, givenBigCopyWhenCopyingWithMultipleWorkersThenRowsOfAllSlicesAreCopied) {
+    DebugManagerStateRestore restore;
+    size_t rowSize = 4100;
+    size_t rowsCount = 200;
+    size_t slicesCount = 3;
+    ASSERT_LE(PitchedCopy::nonTemporalCopyMinSize, rowSize * rowsCount * slicesCount);
+
+    for (int32_t workersCount : {1, 2, 4, 5}) {
+        DebugManager.flags.PitchedCopyWorkersCount.set(workersCount);
+        PitchedCopyTestSurfaces surfaces(rowSize, rowsCount, slicesCount, rowSize + 60, rowSize + 124);
+        surfaces.copy();
+        surfaces.verify();
+    }
+}
+
+TEST(PitchedCopyTests, givenEmptyRegionWhenCopyingThenNothingIsCopied) {
+    PitchedCopyTestSurfaces surfaces(16, 2, 1, 16, 16);
+    PitchedCopy::copy(surfaces.dst.data(), 16, 32, surfaces.src.data(), 16, 32, 0, 2, 1);
+    PitchedCopy::copy(surfaces.dst.data(), 16, 32, surfaces.src.data(), 16, 32, 16, 0, 1);
+    PitchedCopy::copy(surfaces.dst.data(), 16, 32, surfaces.src.data(), 16, 32, 16, 2, 0);
+    for (auto byte : surfaces.dst) {
+        EXPECT_EQ(0xCD, byte);
+    }
+}
+
+TEST(PitchedCopyTests, whenGettingWorkersCountThenSmallCopiesAreDoneOnCallingThread) {
+    DebugManagerStateRestore restore;
+    EXPECT_EQ(1U, PitchedCopy::getWorkersCount(0U));
+    EXPECT_EQ(1U, PitchedCopy::getWorkersCount(PitchedCopy::minCopySizePerWorker * 2 - 1));
+    EXPECT_LE(PitchedCopy::getWorkersCount(64 * PitchedCopy::minCopySizePerWorker), PitchedCopy::maxWorkersCount);
+    EXPECT_LE(1U, PitchedCopy::getWorkersCount(64 * PitchedCopy::minCopySizePerWorker));
+
+    DebugManager.flags.PitchedCopyWorkersCount.set(0);
+    EXPECT_EQ(1U, PitchedCopy::getWorkersCount(64 * PitchedCopy::minCopySizePerWorker));
+    DebugManager.flags.PitchedCopyWorkersCount.set(3);
+    EXPECT_EQ(3U, PitchedCopy::getWorkersCount(1U));
+}
@@ -5,9 +5,12 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/memory_constants.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/page_fault_manager/cpu_page_fault_manager_tests_fixture.h"
 
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
@@ -187,12 +190,13 @@ TEST_F(PageFaultManagerTest, givenTrackedPageFaultAddressWhenVerifyingThenProper
     EXPECT_EQ(pageFaultManager->transferToCpuCalled, 2);
     EXPECT_EQ(pageFaultManager->memoryData.size(), 2u);
 
+    pageFaultManager->moveAllocationToGpuDomain(alloc1);
     pageFaultManager->verifyPageFault(alloc1);
 
     EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
-    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 0);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 1);
     EXPECT_EQ(pageFaultManager->transferToCpuCalled, 3);
-    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 1);
 
     EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc1);
     EXPECT_EQ(pageFaultManager->accessAllowedSize, 10u);
@@ -219,3 +223,120 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSetAubWritableIsCalledTh
 
     unifiedMemoryManager->freeSVMAlloc(alloc1);
 }
+
+TEST_F(PageFaultManagerTest, givenManyTrackedAllocationsWhenVerifyingAddressInsideAllocationThenOwningAllocIsTransferredToCpuDomain) {
+    constexpr size_t numAllocs = 1000;
+    constexpr size_t allocSize = 0x100;
+    constexpr uintptr_t allocStride = 0x1000;
+    for (size_t i = 0; i < numAllocs; i++) {
+        auto alloc = reinterpret_cast<void *>(allocStride * (i + 1));
+        pageFaultManager->insertAllocation(alloc, allocSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr);
+        pageFaultManager->moveAllocationToGpuDomain(alloc);
+    }
+    EXPECT_EQ(pageFaultManager->memoryData.size(), numAllocs);
+
+    for (size_t i : {size_t{0}, numAllocs / 2, numAllocs - 1}) {
+        auto alloc = reinterpret_cast<void *>(allocStride * (i + 1));
+        EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, allocSize - 1)));
+        EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc);
+        EXPECT_EQ(pageFaultManager->transferToCpuAddress, alloc);
+        EXPECT_FALSE(pageFaultManager->memoryData.at(alloc).isInGpuDomain);
+    }
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 3);
+}
+
+TEST_F(PageFaultManagerTest, givenTrackedAllocationsWhenVerifyingAddressOutsideOfAllocationsThenFalseIsReturned) {
+    void *alloc1 = reinterpret_cast<void *>(0x1000);
+    void *alloc2 = reinterpret_cast<void *>(0x3000);
+
+    pageFaultManager->insertAllocation(alloc1, 0x100, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr);
+    pageFaultManager->insertAllocation(alloc2, 0x100, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr);
+    pageFaultManager->moveAllocationToGpuDomain(alloc2);
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0xfff)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(ptrOffset(alloc1, 0x100)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x2fff)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(ptrOffset(alloc2, 0x100)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 0);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc2));
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc2);
+}
+
+TEST_F(PageFaultManagerTest, givenAllocationLargerThanMigrationGranularityWhenPageFaultOccursThenOnlyFaultedChunkIsTransferredToCpu) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(2 * MemoryConstants::megaByte);
+    size_t granularity = pageFaultManager->migrationGranularity;
+    size_t allocSize = 2 * granularity + MemoryConstants::pageSize;
+
+    pageFaultManager->insertAllocation(alloc, allocSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->protectedSize, allocSize);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, granularity + 1)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, ptrOffset(alloc, granularity));
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, granularity);
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, ptrOffset(alloc, granularity));
+    EXPECT_EQ(pageFaultManager->transferToCpuSize, granularity);
+    EXPECT_FALSE(pageFaultManager->memoryData.at(alloc).isInGpuDomain);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, allocSize - 1)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 2);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, ptrOffset(alloc, 2 * granularity));
+    EXPECT_EQ(pageFaultManager->transferToCpuSize, MemoryConstants::pageSize);
+
+    auto statistics = pageFaultManager->getMigrationStatistics();
+    EXPECT_EQ(statistics.pageFaultsHandled, 2u);
+    EXPECT_EQ(statistics.bytesTransferredToCpu, allocSize + granularity + MemoryConstants::pageSize);
+    EXPECT_EQ(statistics.bytesTransferredToGpu, allocSize);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 3);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 3);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, ptrOffset(alloc, 2 * granularity));
+    EXPECT_EQ(pageFaultManager->protectedMemoryAccessAddress, ptrOffset(alloc, 2 * granularity));
+    EXPECT_EQ(pageFaultManager->protectedSize, MemoryConstants::pageSize);
+    EXPECT_TRUE(pageFaultManager->memoryData.at(alloc).isInGpuDomain);
+
+    statistics = pageFaultManager->getMigrationStatistics();
+    EXPECT_EQ(statistics.bytesTransferredToGpu, allocSize + granularity + MemoryConstants::pageSize);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkAlreadyTransferredToCpuWhenPageFaultOccursInItThenNothingIsTransferred) {
+    void *alloc = reinterpret_cast<void *>(2 * MemoryConstants::megaByte);
+    size_t allocSize = 2 * pageFaultManager->migrationGranularity;
+
+    pageFaultManager->insertAllocation(alloc, allocSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc));
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 1)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 2);
+    EXPECT_EQ(pageFaultManager->getMigrationStatistics().pageFaultsHandled, 1u);
+}
+
+TEST_F(PageFaultManagerTest, givenPartiallyMigratedAllocationWhenRemovingItThenWholeAllocationIsMadeAccessible) {
+    void *alloc = reinterpret_cast<void *>(2 * MemoryConstants::megaByte);
+    size_t allocSize = 2 * pageFaultManager->migrationGranularity;
+
+    pageFaultManager->insertAllocation(alloc, allocSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->verifyPageFault(alloc);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 2);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc);
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, allocSize);
+}
+
+TEST(PageFaultManagerMigrationGranularityTest, givenDebugFlagSetWhenPageFaultManagerIsCreatedThenMigrationGranularityIsAlignedToPageSize) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(2 * MemoryConstants::megaByte, MockPageFaultManager().migrationGranularity);
+
+    DebugManager.flags.UnifiedMemoryMigrationGranularity.set(static_cast<int32_t>(MemoryConstants::pageSize + 1));
+    EXPECT_EQ(2 * MemoryConstants::pageSize, MockPageFaultManager().migrationGranularity);
+}
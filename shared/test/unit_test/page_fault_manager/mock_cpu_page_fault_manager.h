@@ -14,6 +14,7 @@ using namespace NEO;
 class MockPageFaultManager : public PageFaultManager {
   public:
     using PageFaultManager::memoryData;
+    using PageFaultManager::migrationGranularity;
     using PageFaultManager::PageFaultData;
     using PageFaultManager::PageFaultManager;
     using PageFaultManager::verifyPageFault;
@@ -11,6 +11,7 @@
 #include "shared/source/program/program_info_from_patchtokens.h"
 #include "shared/test/unit_test/compiler_interface/linker_mock.h"
 #include "shared/test/unit_test/device_binary_format/patchtokens_tests.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/source/program/kernel_info.h"
 
@@ -194,6 +195,30 @@ TEST(PopulateProgramInfoFromPatchtokensTests, GivenProgramWithKernelsThenKernelI
     EXPECT_EQ(programFromTokens.header->GPUPointerSizeInBytes, programInfo.kernelInfos[2]->gpuPointerSize);
 }
 
+TEST(PopulateProgramInfoFromPatchtokensTests, GivenProgramWithManyKernelsWhenPopulatedByMultipleWorkersThenKernelInfosAreInKernelsOrder) {
+    DebugManagerStateRestore restore;
+    NEO::DebugManager.flags.PatchtokensDecodeWorkersCount.set(4);
+
+    PatchTokensTestData::ValidProgramWithKernel programFromTokens;
+    std::vector<std::string> kernelNames;
+    for (uint32_t i = 0; i < 64; i++) {
+        kernelNames.push_back("kernel" + std::to_string(i));
+    }
+    programFromTokens.kernels.resize(kernelNames.size(), programFromTokens.kernels[0]);
+    for (size_t i = 0; i < kernelNames.size(); i++) {
+        programFromTokens.kernels[i].name = ArrayRef<const char>(kernelNames[i].data(), kernelNames[i].size());
+    }
+
+    NEO::ProgramInfo programInfo = {};
+    NEO::populateProgramInfo(programInfo, programFromTokens);
+    ASSERT_EQ(kernelNames.size(), programInfo.kernelInfos.size());
+    for (size_t i = 0; i < kernelNames.size(); i++) {
+        ASSERT_NE(nullptr, programInfo.kernelInfos[i]);
+        EXPECT_EQ(kernelNames[i], programInfo.kernelInfos[i]->name);
+        EXPECT_EQ(programFromTokens.header->GPUPointerSizeInBytes, programInfo.kernelInfos[i]->gpuPointerSize);
+    }
+}
+
 TEST(PopulateProgramInfoFromPatchtokensTests, GivenProgramWithKernelsWhenKernelHasSymbolTableThenLinkerIsUpdatedWithAdditionalSymbolInfo) {
     NEO::ProgramInfo programInfo = {};
     Mock<NEO::LinkerInput> *mockLinkerInput = new Mock<NEO::LinkerInput>;
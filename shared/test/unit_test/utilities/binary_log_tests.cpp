@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/utilities/binary_log.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::vector<uint8_t> loadBinaryLog(const std::string &fileName) {
+    size_t size = 0u;
+    auto data = loadDataFromFile(fileName.c_str(), size);
+    auto begin = reinterpret_cast<uint8_t *>(data.get());
+    return std::vector<uint8_t>(begin, begin + size);
+}
+
+void writeText(BinaryLogWriter &writer, const std::string &text) {
+    writer.write(BinaryLog::RecordType::Text, 0, text.c_str(), text.size());
+}
+} // namespace
+
+struct MockBinaryLogWriter : public BinaryLogWriter {
+    using BinaryLogWriter::BinaryLogWriter;
+    using BinaryLogWriter::rings;
+};
+
+struct BinaryLogWriterTest : public ::testing::Test {
+    void TearDown() override {
+        std::remove(fileName.c_str());
+    }
+
+    std::string fileName = "binary_log_test.bin";
+};
+
+TEST_F(BinaryLogWriterTest, givenRecordsWrittenWhenWriterIsDestroyedThenLogIsDecodedInOrder) {
+    {
+        BinaryLogWriter writer(fileName);
+        ASSERT_TRUE(writer.isOpened());
+        writer.write(BinaryLog::RecordType::ApiEnter, 0, "clCreateBuffer", strlen("clCreateBuffer"));
+        writeText(writer, "inputs\n");
+        writer.write(BinaryLog::RecordType::ApiLeave, -30, "clCreateBuffer", strlen("clCreateBuffer"));
+    }
+
+    auto binaryLog = loadBinaryLog(fileName);
+    std::string text;
+    ASSERT_TRUE(BinaryLog::decode(ArrayRef<const uint8_t>(binaryLog.data(), binaryLog.size()), text));
+
+    auto enterPos = text.find("Function Enter: clCreateBuffer\n");
+    auto inputsPos = text.find("inputs\n");
+    auto leavePos = text.find("Function Leave (-30): clCreateBuffer\n");
+    EXPECT_NE(std::string::npos, enterPos);
+    EXPECT_NE(std::string::npos, inputsPos);
+    EXPECT_NE(std::string::npos, leavePos);
+    EXPECT_LT(enterPos, inputsPos);
+    EXPECT_LT(inputsPos, leavePos);
+}
+
+TEST_F(BinaryLogWriterTest, givenRecordsLargerThanRingBufferWhenWrittenThenWriterWaitsForFlusherAndKeepsAllRecords) {
+    constexpr size_t numRecords = 1000;
+    {
+        BinaryLogWriter writer(fileName, 1024);
+        for (size_t i = 0; i < numRecords; i++) {
+            writeText(writer, "record " + std::to_string(i) + "\n");
+        }
+        EXPECT_EQ(0u, writer.getTruncatedRecords());
+    }
+
+    auto binaryLog = loadBinaryLog(fileName);
+    std::string text;
+    ASSERT_TRUE(BinaryLog::decode(ArrayRef<const uint8_t>(binaryLog.data(), binaryLog.size()), text));
+
+    size_t position = 0u;
+    for (size_t i = 0; i < numRecords; i++) {
+        position = text.find("record " + std::to_string(i) + "\n", position);
+        ASSERT_NE(std::string::npos, position);
+    }
+}
+
+TEST_F(BinaryLogWriterTest, givenRecordsFromMultipleThreadsWhenFlushedThenAllRecordsAreLogged) {
+    constexpr size_t numThreads = 4;
+    constexpr size_t numRecordsPerThread = 200;
+    {
+        BinaryLogWriter writer(fileName, 2048);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < numThreads; t++) {
+            threads.emplace_back([&writer, t]() {
+                for (size_t i = 0; i < numRecordsPerThread; i++) {
+                    writeText(writer, "thread " + std::to_string(t) + " record " + std::to_string(i) + "\n");
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        writer.flush();
+
+        auto binaryLog = loadBinaryLog(fileName);
+        std::string text;
+        ASSERT_TRUE(BinaryLog::decode(ArrayRef<const uint8_t>(binaryLog.data(), binaryLog.size()), text));
+        for (size_t t = 0; t < numThreads; t++) {
+            size_t position = 0u;
+            for (size_t i = 0; i < numRecordsPerThread; i++) {
+                position = text.find("thread " + std::to_string(t) + " record " + std::to_string(i) + "\n", position);
+                ASSERT_NE(std::string::npos, position);
+            }
+        }
+    }
+}
+
+TEST_F(BinaryLogWriterTest, givenThreadsWhichWroteRecordsWhenThreadsExitThenTheirRingBuffersAreDrainedAndFreed) {
+    constexpr size_t numThreads = 32;
+    {
+        MockBinaryLogWriter writer(fileName, 1024);
+        writeText(writer, "main thread\n");
+        for (size_t i = 0; i < numThreads; i++) {
+            std::thread([&writer, i]() {
+                writeText(writer, "thread " + std::to_string(i) + "\n");
+            }).join();
+        }
+        writer.flush();
+        EXPECT_EQ(1u, writer.rings.size());
+
+        writeText(writer, "main thread again\n");
+        EXPECT_EQ(1u, writer.rings.size());
+    }
+
+    auto binaryLog = loadBinaryLog(fileName);
+    std::string text;
+    ASSERT_TRUE(BinaryLog::decode(ArrayRef<const uint8_t>(binaryLog.data(), binaryLog.size()), text));
+    EXPECT_NE(std::string::npos, text.find("main thread\n"));
+    EXPECT_NE(std::string::npos, text.find("main thread again\n"));
+    for (size_t i = 0; i < numThreads; i++) {
+        EXPECT_NE(std::string::npos, text.find("thread " + std::to_string(i) + "\n"));
+    }
+}
+
+TEST_F(BinaryLogWriterTest, givenThreadLocalDestroyedAfterRingBuffersOfThreadWhenItLogsThenRecordIsWrittenToFile) {
+    struct LogOnThreadExit {
+        ~LogOnThreadExit() {
+            if (writer) {
+                // drains and frees ring buffer of the exited thread
+                writer->flush();
+                writeText(*writer, "thread exit\n");
+            }
+        }
+        BinaryLogWriter *writer = nullptr;
+    };
+
+    {
+        MockBinaryLogWriter writer(fileName, 1024);
+        std::thread([&writer]() {
+            // constructed before ring buffers of the thread, so it is destroyed after them
+            static thread_local LogOnThreadExit logOnThreadExit;
+            logOnThreadExit.writer = &writer;
+            writeText(writer, "thread record\n");
+        }).join();
+        writer.flush();
+        EXPECT_EQ(0u, writer.rings.size());
+    }
+
+    auto binaryLog = loadBinaryLog(fileName);
+    std::string text;
+    ASSERT_TRUE(BinaryLog::decode(ArrayRef<const uint8_t>(binaryLog.data(), binaryLog.size()), text));
+    auto recordPos = text.find("thread record\n");
+    auto exitPos = text.find("thread exit\n");
+    EXPECT_NE(std::string::npos, recordPos);
+    EXPECT_NE(std::string::npos, exitPos);
+    EXPECT_LT(recordPos, exitPos);
+}
+
+TEST_F(BinaryLogWriterTest, givenPayloadLargerThanHalfOfRingBufferWhenWrittenThenPayloadIsTruncated) {
+    std::string payload(1024, 'x');
+    {
+        BinaryLogWriter writer(fileName, 256);
+        writeText(writer, payload);
+        EXPECT_EQ(1u, writer.getTruncatedRecords());
+    }
+
+    auto binaryLog = loadBinaryLog(fileName);
+    std::string text;
+    ASSERT_TRUE(BinaryLog::decode(ArrayRef<const uint8_t>(binaryLog.data(), binaryLog.size()), text));
+    EXPECT_EQ(256 / 2 - sizeof(BinaryLog::RecordHeader), text.size());
+}
+
+TEST_F(BinaryLogWriterTest, givenFileWhichCanNotBeCreatedWhenWritingThenRecordsAreIgnored) {
+    BinaryLogWriter writer("non_existing_dir/binary_log_test.bin");
+    EXPECT_FALSE(writer.isOpened());
+    writeText(writer, "text");
+    writer.flush();
+}
+
+TEST(BinaryLogDecoderTest, givenInvalidLogWhenDecodingThenFalseIsReturned) {
+    std::string text;
+    std::vector<uint8_t> binaryLog(sizeof(BinaryLog::FileHeader) - 1);
+    EXPECT_FALSE(BinaryLog::decode(ArrayRef<const uint8_t>(binaryLog.data(), binaryLog.size()), text));
+
+    BinaryLog::FileHeader header = {BinaryLog::magic, BinaryLog::version + 1};
+    binaryLog.resize(sizeof(header));
+    memcpy(binaryLog.data(), &header, sizeof(header));
+    EXPECT_FALSE(BinaryLog::decode(ArrayRef<const uint8_t>(binaryLog.data(), binaryLog.size()), text));
+
+    header.version = BinaryLog::version;
+    memcpy(binaryLog.data(), &header, sizeof(header));
+    EXPECT_TRUE(BinaryLog::decode(ArrayRef<const uint8_t>(binaryLog.data(), binaryLog.size()), text));
+    EXPECT_TRUE(text.empty());
+
+    BinaryLog::RecordHeader record = {};
+    record.type = static_cast<uint16_t>(BinaryLog::RecordType::Text);
+    record.payloadSize = 16;
+    binaryLog.resize(sizeof(header) + sizeof(record));
+    memcpy(binaryLog.data() + sizeof(header), &record, sizeof(record));
+    EXPECT_FALSE(BinaryLog::decode(ArrayRef<const uint8_t>(binaryLog.data(), binaryLog.size()), text));
+
+    record.payloadSize = 0;
+    record.type = 0;
+    memcpy(binaryLog.data() + sizeof(header), &record, sizeof(record));
+    EXPECT_FALSE(BinaryLog::decode(ArrayRef<const uint8_t>(binaryLog.data(), binaryLog.size()), text));
+}
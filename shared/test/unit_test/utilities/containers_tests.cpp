@@ -261,6 +261,24 @@ TEST(IFList, detachNodesNonThreadSafe) {
     iFListTestDetachNodes<false>();
 }
 
+TEST(IFList, removeFrontOneNonThreadSafe) {
+    IFList<DummyFNode, false, false> list;
+    EXPECT_EQ(nullptr, list.removeFrontOne());
+
+    DummyFNode node1;
+    DummyFNode node2;
+    list.pushFrontOne(node1);
+    list.pushFrontOne(node2);
+
+    EXPECT_EQ(&node2, list.removeFrontOne());
+    EXPECT_EQ(nullptr, node2.next);
+    EXPECT_EQ(&node1, list.peekHead());
+
+    EXPECT_EQ(&node1, list.removeFrontOne());
+    EXPECT_TRUE(list.peekIsEmpty());
+    EXPECT_EQ(nullptr, list.removeFrontOne());
+}
+
 TEST(IFList, compareExchangeHead) {
     struct DummyList : IFList<DummyFNode, true, false> {
         void testCompareExchangeHead(DummyFNode *preSet, DummyFNode *&expected, DummyFNode *desired) {
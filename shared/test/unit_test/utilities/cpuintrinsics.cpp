@@ -13,6 +13,7 @@
 //std::atomic is used for sake of sanitation in MT tests
 std::atomic<uintptr_t> lastClFlushedPtr(0u);
 std::atomic<uint32_t> pauseCounter(0u);
+std::atomic<uint64_t> rdtscCounter(0u);
 
 namespace NEO {
 namespace CpuIntrinsics {
@@ -25,5 +26,9 @@ void pause() {
     pauseCounter++;
 }
 
+uint64_t rdtsc() {
+    return ++rdtscCounter;
+}
+
 } // namespace CpuIntrinsics
 } // namespace NEO
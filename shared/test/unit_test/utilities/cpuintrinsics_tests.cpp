@@ -14,6 +14,7 @@
 
 extern std::atomic<uintptr_t> lastClFlushedPtr;
 extern std::atomic<uint32_t> pauseCounter;
+extern std::atomic<uint64_t> rdtscCounter;
 
 TEST(CpuIntrinsicsTest, whenClFlushIsCalledThenExpectToPassPtrToSystemCall) {
     uintptr_t flushAddr = 0x1234;
@@ -27,3 +28,9 @@ TEST(CpuIntrinsicsTest, whenPauseCalledThenExpectToIncreaseCounter) {
     NEO::CpuIntrinsics::pause();
     EXPECT_EQ(oldCount + 1, pauseCounter);
 }
+
+TEST(CpuIntrinsicsTest, whenRdtscCalledThenExpectToIncreaseCounter) {
+    uint64_t oldCount = rdtscCounter.load();
+    EXPECT_EQ(oldCount + 1, NEO::CpuIntrinsics::rdtsc());
+    EXPECT_EQ(oldCount + 1, rdtscCounter);
+}
@@ -11,8 +11,11 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <iostream>
 #include <random>
+#include <utility>
+#include <vector>
 
 using namespace NEO;
 using namespace std;
@@ -28,16 +31,9 @@ class HeapAllocatorUnderTest : public HeapAllocator {
     uint64_t getRightBound() const { return this->pRightBound; }
     uint64_t getavailableSize() const { return this->availableSize; }
     size_t getThresholdSize() const { return this->sizeThreshold; }
-    using HeapAllocator::defragment;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &vec) {
-        size_t sizeOfFreedChunk;
-        return HeapAllocator::getFromFreedChunks(size, vec, sizeOfFreedChunk);
-    }
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &vec) { return HeapAllocator::storeInFreedChunks(ptr, size, vec); }
-
-    std::vector<HeapChunk> &getFreedChunksSmall() { return this->freedChunksSmall; };
-    std::vector<HeapChunk> &getFreedChunksBig() { return this->freedChunksBig; };
+    HeapChunkBins &getFreedChunksSmall() { return this->freedChunksSmall; };
+    HeapChunkBins &getFreedChunksBig() { return this->freedChunksBig; };
 
     using HeapAllocator::allocationAlignment;
 };
@@ -77,207 +73,224 @@ TEST(HeapAllocatorTest, StatisticsMethods) {
     heapAllocator->free(ptr, ptrSize);
 }
 
-TEST(HeapAllocatorTest, GivenExactSizeChunkInFreedChunksWhenGetIsCalledThenChunkIsReturned) {
-    uint64_t ptrBase = 0x100000llu;
-    size_t size = 1024 * 4096;
-    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
-
-    std::vector<HeapChunk> freedChunks;
+TEST(HeapChunkBinsTest, GivenExactSizeChunkInFreedChunksWhenTakeIsCalledThenChunkIsReturned) {
+    HeapChunkBins freedChunks;
     uint64_t ptrFreed = 0x101000llu;
     size_t sizeFreed = MemoryConstants::pageSize * 2;
-    freedChunks.emplace_back(ptrFreed, sizeFreed);
+    freedChunks.store(ptrFreed, sizeFreed);
 
-    auto ptrReturned = heapAllocator->getFromFreedChunks(sizeFreed, freedChunks);
+    size_t sizeOfFreedChunk = 0;
+    auto ptrReturned = freedChunks.take(sizeFreed, sizeOfFreedChunk);
 
     EXPECT_EQ(ptrFreed, ptrReturned);  // ptr returned is the one that was stored
+    EXPECT_EQ(sizeFreed, sizeOfFreedChunk);
     EXPECT_EQ(0u, freedChunks.size()); // entry in freed container is removed
 }
 
-TEST(HeapAllocatorTest, GivenOnlySmallerSizeChunksInFreedChunksWhenGetIsCalledThenNullptrIsReturned) {
-    uint64_t ptrBase = 0x100000llu;
-    size_t size = 1024 * 4096;
-    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
-
-    std::vector<HeapChunk> freedChunks;
+TEST(HeapChunkBinsTest, GivenOnlySmallerSizeChunksInFreedChunksWhenTakeIsCalledThenNullptrIsReturned) {
+    HeapChunkBins freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x101000llu, 4096);
-    freedChunks.emplace_back(0x105000llu, 4096);
-    freedChunks.emplace_back(0x104000llu, 4096);
-    freedChunks.emplace_back(0x102000llu, 8192);
-    freedChunks.emplace_back(0x109000llu, 8192);
-    freedChunks.emplace_back(0x107000llu, 4096);
+    freedChunks.store(0x100000llu, 4096);
+    freedChunks.store(0x102000llu, 4096);
+    freedChunks.store(0x104000llu, 8192);
+    freedChunks.store(0x107000llu, 4096);
+    freedChunks.store(0x109000llu, 8192);
 
-    EXPECT_EQ(7u, freedChunks.size());
+    EXPECT_EQ(5u, freedChunks.size());
 
-    auto ptrReturned = heapAllocator->getFromFreedChunks(4 * 4096, freedChunks);
+    size_t sizeOfFreedChunk = 0;
+    auto ptrReturned = freedChunks.take(4 * 4096, sizeOfFreedChunk);
 
     EXPECT_EQ(0llu, ptrReturned);
-    EXPECT_EQ(7u, freedChunks.size());
+    EXPECT_EQ(0u, sizeOfFreedChunk);
+    EXPECT_EQ(5u, freedChunks.size());
 }
 
-TEST(HeapAllocatorTest, GivenOnlyBiggerSizeChunksInFreedChunksWhenGetIsCalledThenBestFitChunkIsReturned) {
-    uint64_t ptrBase = 0x100000llu;
-    size_t size = 1024 * 4096;
-    auto pUpperBound = ptrBase + size;
-
-    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
+TEST(HeapChunkBinsTest, GivenOnlyBiggerSizeChunksInFreedChunksWhenTakeIsCalledThenChunkFromSmallestFittingSizeClassIsReturned) {
+    HeapChunkBins freedChunks;
+    uint64_t ptr = 0x100000llu;
 
-    std::vector<HeapChunk> freedChunks;
-    uint64_t ptrExpected = 0llu;
+    freedChunks.store(ptr, 7 * 4096);
+    ptr += 8 * 4096;
+    freedChunks.store(ptr, 5 * 4096);
+    ptr += 6 * 4096;
+    uint64_t ptrExpected = ptr;
+    freedChunks.store(ptr, 4 * 4096);
+    ptr += 5 * 4096;
+    freedChunks.store(ptr, 16 * 4096);
 
-    pUpperBound -= 4096;
-    freedChunks.emplace_back(pUpperBound, 4096);
-    pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
-    pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
-    ptrExpected = pUpperBound;
-
-    pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
-    pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
-
-    EXPECT_EQ(5u, freedChunks.size());
+    EXPECT_EQ(4u, freedChunks.size());
 
-    auto ptrReturned = heapAllocator->getFromFreedChunks(3 * 4096, freedChunks);
+    size_t sizeOfFreedChunk = 0;
+    auto ptrReturned = freedChunks.take(3 * 4096, sizeOfFreedChunk);
 
     EXPECT_EQ(ptrExpected, ptrReturned);
-    EXPECT_EQ(4u, freedChunks.size());
+    EXPECT_EQ(4u * 4096, sizeOfFreedChunk);
+    EXPECT_EQ(3u, freedChunks.size());
 }
 
-TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenGetIsCalledThenSplittedChunkIsReturned) {
-    uint64_t ptrBase = 0x100000llu;
-    size_t size = 1024 * 4096;
-    auto pLowerBound = ptrBase;
-
-    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
-
-    std::vector<HeapChunk> freedChunks;
-    uint64_t ptrExpected = 0llu;
+TEST(HeapChunkBinsTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenTakeIsCalledThenSplittedChunkIsReturned) {
+    HeapChunkBins freedChunks;
+    uint64_t ptr = 0x100000llu;
     size_t requestedSize = 3 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
-    pLowerBound += 9 * 4096;
-    freedChunks.emplace_back(pLowerBound, 7 * 4096);
+    freedChunks.store(ptr, 4096);
+    ptr += 2 * 4096;
+    freedChunks.store(ptr, 9 * 4096);
+    ptr += 10 * 4096;
+    uint64_t splitChunkPtr = ptr;
+    freedChunks.store(ptr, 7 * 4096);
 
     size_t deltaSize = 7 * 4096 - requestedSize;
-    ptrExpected = pLowerBound + deltaSize;
+    uint64_t ptrExpected = splitChunkPtr + deltaSize;
 
     EXPECT_EQ(3u, freedChunks.size());
 
-    auto ptrReturned = heapAllocator->getFromFreedChunks(requestedSize, freedChunks);
+    size_t sizeOfFreedChunk = 0;
+    auto ptrReturned = freedChunks.take(requestedSize, sizeOfFreedChunk);
 
     EXPECT_EQ(ptrExpected, ptrReturned);
-    EXPECT_EQ(3u, freedChunks.size());
+    EXPECT_EQ(0u, sizeOfFreedChunk);
+    ASSERT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(pLowerBound, freedChunks[2].ptr);
-    EXPECT_EQ(deltaSize, freedChunks[2].size);
+    auto chunks = freedChunks.getChunks();
+    EXPECT_EQ(splitChunkPtr, chunks[2].ptr);
+    EXPECT_EQ(deltaSize, chunks[2].size);
 }
 
-TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
-    uint64_t ptrBase = 0x100000llu;
-    size_t size = 1024 * 4096;
-    auto pLowerBound = ptrBase;
-
-    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
+TEST(HeapChunkBinsTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
+    HeapChunkBins freedChunks;
+    uint64_t ptr = 0x100000llu;
 
-    std::vector<HeapChunk> freedChunks;
-    uint64_t ptrExpected = 0llu;
-    size_t expectedSize = 9 * 4096;
+    freedChunks.store(ptr, 4096);
+    ptr += 2 * 4096;
+    uint64_t ptrExpected = ptr;
+    freedChunks.store(ptr, 9 * 4096);
+    ptr += 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
-    ptrExpected = pLowerBound;
-    pLowerBound += 9 * 4096;
+    EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    freedChunks.store(ptr, 2 * 4096);
 
-    EXPECT_EQ(2u, freedChunks.size());
+    ASSERT_EQ(2u, freedChunks.size());
+    auto chunks = freedChunks.getChunks();
+    EXPECT_EQ(ptrExpected, chunks[1].ptr);
+    EXPECT_EQ(11u * 4096, chunks[1].size);
+}
 
-    auto ptrToStore = pLowerBound;
-    size_t sizeToStore = 2 * 4096;
+TEST(HeapChunkBinsTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
+    HeapChunkBins freedChunks;
+    uint64_t ptr = 0x100000llu;
 
-    expectedSize += sizeToStore;
+    freedChunks.store(ptr, 4096);
+    ptr += 2 * 4096; // space between stored chunk and chunk to store
 
-    heapAllocator->storeInFreedChunks(ptrToStore, sizeToStore, freedChunks);
+    auto ptrToStore = ptr;
+    size_t sizeToStore = 2 * 4096;
+    ptr += sizeToStore;
+    freedChunks.store(ptr, 9 * 4096);
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    freedChunks.store(ptrToStore, sizeToStore);
+
+    ASSERT_EQ(2u, freedChunks.size());
+    auto chunks = freedChunks.getChunks();
+    EXPECT_EQ(ptrToStore, chunks[1].ptr);
+    EXPECT_EQ(11u * 4096, chunks[1].size);
 }
 
-TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
-    uint64_t ptrBase = 0x100000llu;
-    size_t size = 1024 * 4096;
-    auto pLowerBound = ptrBase;
+TEST(HeapChunkBinsTest, GivenStoredChunksAdjacentToBothBoundariesOfIncomingChunkWhenStoreIsCalledThenAllChunksAreMerged) {
+    HeapChunkBins freedChunks;
+    uint64_t ptr = 0x100000llu;
 
-    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
+    freedChunks.store(ptr, 4096);
+    freedChunks.store(ptr + 3 * 4096, 9 * 4096);
 
-    std::vector<HeapChunk> freedChunks;
-    uint64_t ptrExpected = 0llu;
-    size_t expectedSize = 9 * 4096;
+    EXPECT_EQ(2u, freedChunks.size());
 
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    pLowerBound += 4096; // space between stored chunk and chunk to store
+    freedChunks.store(ptr + 4096, 2 * 4096);
 
-    auto ptrToStore = pLowerBound;
-    size_t sizeToStore = 2 * 4096;
-    pLowerBound += sizeToStore;
+    ASSERT_EQ(1u, freedChunks.size());
+    auto chunks = freedChunks.getChunks();
+    EXPECT_EQ(ptr, chunks[0].ptr);
+    EXPECT_EQ(12u * 4096, chunks[0].size);
+    EXPECT_EQ(12u * 4096, freedChunks.getLargestChunkSize());
+}
 
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
-    ptrExpected = pLowerBound;
+TEST(HeapChunkBinsTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCalledThenNewFreeChunkIsCreated) {
+    HeapChunkBins freedChunks;
+    uint64_t ptr = 0x100000llu;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    freedChunks.store(ptr, 4096);
+    ptr += 2 * 4096;
+    freedChunks.store(ptr, 9 * 4096);
+    ptr += 18 * 4096;
 
-    EXPECT_EQ(2u, freedChunks.size());
+    uint64_t ptrToStore = ptr;
+    size_t sizeToStore = 4096;
 
-    expectedSize += sizeToStore;
-    ptrExpected = ptrToStore;
+    EXPECT_EQ(2u, freedChunks.size());
 
-    heapAllocator->storeInFreedChunks(ptrToStore, sizeToStore, freedChunks);
+    freedChunks.store(ptrToStore, sizeToStore);
 
-    EXPECT_EQ(2u, freedChunks.size());
+    ASSERT_EQ(3u, freedChunks.size());
+    auto chunks = freedChunks.getChunks();
+    EXPECT_EQ(ptrToStore, chunks[2].ptr);
+    EXPECT_EQ(sizeToStore, chunks[2].size);
+}
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+TEST(HeapChunkBinsTest, GivenGrowingSizesWhenGettingBinIndexThenBinIndexNeverDecreases) {
+    uint32_t previousBin = 0u;
+    for (size_t size = 1; size < 64 * 4096; size++) {
+        auto bin = HeapChunkBins::getBinIndex(size);
+        EXPECT_LE(previousBin, bin);
+        EXPECT_GT(HeapChunkBins::numBins, bin);
+        previousBin = bin;
+    }
 }
 
-TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCalledThenNewFreeChunkIsCreated) {
-    uint64_t ptrBase = 0x100000llu;
-    size_t size = 1024 * 4096;
-    auto pLowerBound = ptrBase;
+TEST(HeapChunkBinsTest, GivenFittingChunkInSizeClassOfRequestWhenTakingThenBestFittingChunkFromThatClassIsUsed) {
+    HeapChunkBins freedChunks;
+    size_t requestSize = 16 * 4096;
+    ASSERT_EQ(HeapChunkBins::getBinIndex(requestSize), HeapChunkBins::getBinIndex(requestSize + 4096));
 
-    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
+    freedChunks.store(0x100000llu, 2 * requestSize);
+    freedChunks.store(0x200000llu, requestSize + 4096);
+    freedChunks.store(0x300000llu, requestSize);
+    freedChunks.store(0x400000llu, 4096);
 
-    std::vector<HeapChunk> freedChunks;
+    size_t sizeOfFreedChunk = 0;
+    EXPECT_EQ(0x300000llu, freedChunks.take(requestSize, sizeOfFreedChunk));
+    EXPECT_EQ(requestSize, sizeOfFreedChunk);
 
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
-    pLowerBound += 9 * 4096;
+    EXPECT_EQ(0x200000llu, freedChunks.take(requestSize, sizeOfFreedChunk));
+    EXPECT_EQ(requestSize + 4096, sizeOfFreedChunk);
 
-    pLowerBound += 9 * 4096;
+    EXPECT_EQ(0x100000llu + requestSize, freedChunks.take(requestSize, sizeOfFreedChunk));
+    EXPECT_EQ(0u, sizeOfFreedChunk);
+    EXPECT_EQ(2u, freedChunks.size());
+}
 
-    uint64_t ptrToStore = pLowerBound;
-    size_t sizeToStore = 4096;
+TEST(HeapChunkBinsTest, GivenChunkTakenAtAddressWhenTakingThenOnlyChunkBorderingAddressIsRemoved) {
+    HeapChunkBins freedChunks;
+    freedChunks.store(0x100000llu, 4096);
+    freedChunks.store(0x110000llu, 2 * 4096);
 
+    size_t chunkSize = 0;
+    uint64_t chunkPtr = 0;
+    EXPECT_FALSE(freedChunks.takeChunkStartingAt(0x101000llu, chunkSize));
+    EXPECT_FALSE(freedChunks.takeChunkEndingAt(0x110000llu, chunkPtr, chunkSize));
     EXPECT_EQ(2u, freedChunks.size());
 
-    heapAllocator->storeInFreedChunks(ptrToStore, sizeToStore, freedChunks);
-
-    EXPECT_EQ(3u, freedChunks.size());
+    EXPECT_TRUE(freedChunks.takeChunkEndingAt(0x112000llu, chunkPtr, chunkSize));
+    EXPECT_EQ(0x110000llu, chunkPtr);
+    EXPECT_EQ(2u * 4096, chunkSize);
 
-    EXPECT_EQ(ptrToStore, freedChunks[2].ptr);
-    EXPECT_EQ(sizeToStore, freedChunks[2].size);
+    EXPECT_TRUE(freedChunks.takeChunkStartingAt(0x100000llu, chunkSize));
+    EXPECT_EQ(4096u, chunkSize);
+    EXPECT_EQ(0u, freedChunks.size());
+    EXPECT_EQ(0u, freedChunks.getLargestChunkSize());
 }
 
 TEST(HeapAllocatorTest, AllocateReturnsPointerAndAddsEntryToMap) {
@@ -734,7 +747,7 @@ TEST(HeapAllocatorTest, AllocationsDoNotOverlap) {
     alignedFree(pBasePtr);
 }
 
-TEST(HeapAllocatorTest, defragmentBig) {
+TEST(HeapAllocatorTest, GivenBigAllocationsFreedOutOfOrderWhenFreeingThenAdjacentChunksAreCoalescedImmediately) {
     uint64_t ptrBase = 0x100000llu;
     uint64_t basePtr = 0x100000llu;
     size_t size = 1024 * 4096;
@@ -746,7 +759,7 @@ TEST(HeapAllocatorTest, defragmentBig) {
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksBig();
+    HeapChunkBins &freedChunks = heapAllocator->getFreedChunksBig();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -769,28 +782,24 @@ TEST(HeapAllocatorTest, defragmentBig) {
     heapAllocator->free(ptrs[10], allocSize);
     heapAllocator->free(ptrs[2], allocSize);
     heapAllocator->free(ptrs[6], allocSize);
-    heapAllocator->free(ptrs[1], allocSize);
-    heapAllocator->free(ptrs[7], allocSize);
-    heapAllocator->free(ptrs[8], doubleallocSize);
-
-    // 0,1  merged on free,
-    // 2
-    // 6,7 - merged on free
-    // 8, 10 - merged on free
     EXPECT_EQ(4u, freedChunks.size());
 
-    heapAllocator->defragment();
+    heapAllocator->free(ptrs[1], allocSize);
+    heapAllocator->free(ptrs[7], allocSize);
+    EXPECT_EQ(3u, freedChunks.size());
 
+    heapAllocator->free(ptrs[8], doubleallocSize);
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(basePtr, freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    auto chunks = freedChunks.getChunks();
+    EXPECT_EQ(basePtr, chunks[0].ptr);
+    EXPECT_EQ(3 * allocSize, chunks[0].size);
 
-    EXPECT_EQ((basePtr + 6 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ((basePtr + 6 * allocSize), chunks[1].ptr);
+    EXPECT_EQ(5 * allocSize, chunks[1].size);
 }
 
-TEST(HeapAllocatorTest, defragmentSmall) {
+TEST(HeapAllocatorTest, GivenSmallAllocationsFreedOutOfOrderWhenFreeingThenAdjacentChunksAreCoalescedImmediately) {
     uint64_t ptrBase = 0x100000llu;
     uint64_t basePtr = 0x100000;
 
@@ -803,7 +812,7 @@ TEST(HeapAllocatorTest, defragmentSmall) {
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    HeapChunkBins &freedChunks = heapAllocator->getFreedChunksSmall();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -825,26 +834,20 @@ TEST(HeapAllocatorTest, defragmentSmall) {
     heapAllocator->free(ptrs[0], allocSize);
     heapAllocator->free(ptrs[2], allocSize);
     heapAllocator->free(ptrs[8], doubleallocSize);
+    EXPECT_EQ(3u, freedChunks.size());
+
     heapAllocator->free(ptrs[1], allocSize);
     heapAllocator->free(ptrs[6], allocSize);
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[10], allocSize);
-
-    // 0,1  merged on free,
-    // 2
-    // 6, - merged on free
-    // 7, 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
-
-    heapAllocator->defragment();
-
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ((upperLimitPtr - 3 * allocSize), freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    auto chunks = freedChunks.getChunks();
+    EXPECT_EQ((upperLimitPtr - 10 * allocSize), chunks[0].ptr);
+    EXPECT_EQ(5 * allocSize, chunks[0].size);
 
-    EXPECT_EQ((upperLimitPtr - 10 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ((upperLimitPtr - 3 * allocSize), chunks[1].ptr);
+    EXPECT_EQ(3 * allocSize, chunks[1].size);
 }
 
 TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastChunkFreedReturnsWholeSpaceToFreeRange) {
@@ -854,7 +857,7 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastCh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    HeapChunkBins &freedChunks = heapAllocator->getFreedChunksSmall();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -890,8 +893,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallSp
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    HeapChunkBins &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    HeapChunkBins &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -951,8 +954,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallNo
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    HeapChunkBins &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    HeapChunkBins &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -1003,3 +1006,88 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallNo
     EXPECT_EQ(0u, freedChunksSmall.size());
     EXPECT_EQ(0u, freedChunksBig.size());
 }
+
+TEST(HeapAllocatorTest, GivenFragmentedHeapWhenGettingStatisticsThenFreeBlocksAndFragmentationAreReported) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 16 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
+
+    auto statistics = heapAllocator->getStatistics();
+    EXPECT_EQ(size, statistics.size);
+    EXPECT_EQ(0u, statistics.usedSize);
+    EXPECT_EQ(size, statistics.freeSize);
+    EXPECT_EQ(0u, statistics.freedChunksCount);
+    EXPECT_EQ(size, statistics.largestFreeBlock);
+    EXPECT_EQ(0.0, statistics.fragmentation);
+
+    uint64_t ptrs[16];
+    for (auto &ptr : ptrs) {
+        size_t allocSize = 4096;
+        ptr = heapAllocator->allocate(allocSize);
+        EXPECT_NE(0llu, ptr);
+    }
+    statistics = heapAllocator->getStatistics();
+    EXPECT_EQ(size, statistics.usedSize);
+    EXPECT_EQ(0u, statistics.largestFreeBlock);
+    EXPECT_EQ(0.0, statistics.fragmentation);
+
+    // free every other page, so no two free pages are adjacent
+    for (uint32_t i = 0; i < 16; i += 2) {
+        heapAllocator->free(ptrs[i], 4096);
+    }
+    statistics = heapAllocator->getStatistics();
+    EXPECT_EQ(8u * 4096, statistics.freeSize);
+    EXPECT_EQ(8u, statistics.freedChunksCount);
+    EXPECT_EQ(4096u, statistics.largestFreeBlock);
+    EXPECT_DOUBLE_EQ(1.0 - 1.0 / 8.0, statistics.fragmentation);
+
+    size_t twoPages = 2 * 4096;
+    EXPECT_EQ(0llu, heapAllocator->allocate(twoPages));
+
+    for (uint32_t i = 1; i < 16; i += 2) {
+        heapAllocator->free(ptrs[i], 4096);
+    }
+    statistics = heapAllocator->getStatistics();
+    EXPECT_EQ(0u, statistics.freedChunksCount);
+    EXPECT_EQ(size, statistics.largestFreeBlock);
+    EXPECT_EQ(0.0, statistics.fragmentation);
+    EXPECT_EQ(ptrBase, heapAllocator->getLeftBound());
+    EXPECT_EQ(ptrBase + size, heapAllocator->getRightBound());
+}
+
+TEST(HeapAllocatorTest, GivenManyAllocationsFreedInRandomOrderWhenAllAreFreedThenWholeHeapIsReclaimed) {
+    std::mt19937 generator(1);
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 512 * MemoryConstants::megaByte;
+    size_t threshold = 16 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
+
+    std::vector<std::pair<uint64_t, size_t>> allocations;
+    for (uint32_t i = 0; i < 4096; i++) {
+        size_t allocSize = (generator() % 32 + 1) * 4096;
+        auto ptr = heapAllocator->allocate(allocSize);
+        ASSERT_NE(0llu, ptr);
+        allocations.emplace_back(ptr, allocSize);
+    }
+
+    std::shuffle(allocations.begin(), allocations.end(), generator);
+    // free half, reallocate with different sizes to churn the free lists
+    for (uint32_t i = 0; i < 2048; i++) {
+        heapAllocator->free(allocations[i].first, allocations[i].second);
+        size_t allocSize = (generator() % 32 + 1) * 4096;
+        auto ptr = heapAllocator->allocate(allocSize);
+        ASSERT_NE(0llu, ptr);
+        allocations[i] = {ptr, allocSize};
+    }
+
+    std::shuffle(allocations.begin(), allocations.end(), generator);
+    for (auto &allocation : allocations) {
+        heapAllocator->free(allocation.first, allocation.second);
+    }
+
+    EXPECT_EQ(size, heapAllocator->getLeftSize());
+    EXPECT_EQ(0u, heapAllocator->getFreedChunksSmall().size());
+    EXPECT_EQ(0u, heapAllocator->getFreedChunksBig().size());
+    EXPECT_EQ(ptrBase, heapAllocator->getLeftBound());
+    EXPECT_EQ(ptrBase + size, heapAllocator->getRightBound());
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(ParallelForTest, givenMultipleWorkersWhenRunningParallelForThenFunctionIsCalledOnceForEachIndex) {
+    for (size_t workersCount : {0u, 1u, 2u, 4u, 16u}) {
+        std::vector<std::atomic<uint32_t>> calls(1000);
+        for (auto &callsCount : calls) {
+            callsCount = 0u;
+        }
+        parallelFor(calls.size(), workersCount, [&](size_t index) {
+            calls[index]++;
+        });
+        for (auto &callsCount : calls) {
+            EXPECT_EQ(1u, callsCount.load());
+        }
+    }
+}
+
+TEST(ParallelForTest, givenSingleWorkerWhenRunningParallelForThenIndicesAreProcessedInOrderOnCallingThread) {
+    std::vector<size_t> indices;
+    auto callingThreadId = std::this_thread::get_id();
+    parallelFor(10u, 1u, [&](size_t index) {
+        EXPECT_EQ(callingThreadId, std::this_thread::get_id());
+        indices.push_back(index);
+    });
+    ASSERT_EQ(10u, indices.size());
+    for (size_t i = 0; i < indices.size(); i++) {
+        EXPECT_EQ(i, indices[i]);
+    }
+}
+
+TEST(ParallelForTest, givenNoIndicesWhenRunningParallelForThenFunctionIsNotCalled) {
+    uint32_t callsCount = 0u;
+    parallelFor(0u, 4u, [&](size_t) {
+        callsCount++;
+    });
+    EXPECT_EQ(0u, callsCount);
+}
+
+TEST(ParallelForTest, givenWorkersWhenRunningParallelForMultipleTimesThenThreadsAreStartedOnceAndReused) {
+    ParallelForWorkers workers;
+    EXPECT_EQ(0u, workers.getThreadsCount());
+
+    std::set<std::thread::id> threadIds;
+    std::mutex threadIdsMtx;
+    for (int run = 0; run < 3; run++) {
+        std::vector<std::atomic<uint32_t>> calls(1000);
+        for (auto &callsCount : calls) {
+            callsCount = 0u;
+        }
+        parallelFor(workers, calls.size(), 4u, [&](size_t index) {
+            calls[index]++;
+            std::lock_guard<std::mutex> lock(threadIdsMtx);
+            threadIds.insert(std::this_thread::get_id());
+        });
+        EXPECT_EQ(3u, workers.getThreadsCount());
+        for (auto &callsCount : calls) {
+            EXPECT_EQ(1u, callsCount.load());
+        }
+    }
+    EXPECT_LE(threadIds.size(), 4u);
+}
+
+TEST(ParallelForTest, givenWorkersStartedForBiggerJobWhenRunningSmallerJobThenNoThreadsAreAddedAndAllIndicesAreProcessed) {
+    ParallelForWorkers workers;
+    parallelFor(workers, 100u, 8u, [](size_t) {});
+    EXPECT_EQ(7u, workers.getThreadsCount());
+
+    std::vector<std::atomic<uint32_t>> calls(3);
+    for (auto &callsCount : calls) {
+        callsCount = 0u;
+    }
+    parallelFor(workers, calls.size(), 8u, [&](size_t index) {
+        calls[index]++;
+    });
+    EXPECT_EQ(7u, workers.getThreadsCount());
+    for (auto &callsCount : calls) {
+        EXPECT_EQ(1u, callsCount.load());
+    }
+}
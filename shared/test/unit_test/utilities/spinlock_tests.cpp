@@ -12,6 +12,7 @@
 #include <atomic>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -67,3 +68,79 @@ TEST(SpinLockTest, givenSpinLockThenAttemptedLockingWorks) {
     std::thread workerThread2(workerThreadFunction, true);
     workerThread2.join();
 }
+
+TEST(SpinLockTest, givenSpinLockWhenInitializedInConstantExpressionThenItIsCreatedUnlocked) {
+    // as std::mutex, SpinLock is constant initialized when defined with static storage duration
+    constexpr SpinLock constantInitializedSpinLock{};
+    EXPECT_EQ(0u, constantInitializedSpinLock.getStatistics().contendedLocks);
+
+    static SpinLock spinLock;
+    EXPECT_TRUE(spinLock.try_lock());
+    spinLock.unlock();
+}
+
+TEST(SpinLockTest, givenUncontendedSpinLockWhenLockingThenNoContentionIsReported) {
+    SpinLock spinLock;
+    for (int i = 0; i < 10; i++) {
+        std::lock_guard<SpinLock> lock{spinLock};
+    }
+
+    auto statistics = spinLock.getStatistics();
+    EXPECT_EQ(0u, statistics.contendedLocks);
+    EXPECT_EQ(0u, statistics.parkedWaits);
+}
+
+TEST(SpinLockTest, givenSpinLockHeldLongerThanSpinBudgetWhenOtherThreadLocksThenItParksAndIsWokenOnUnlock) {
+    std::atomic<bool> threadStarted(false);
+    std::atomic<bool> lockAcquired(false);
+    SpinLock spinLock;
+
+    std::unique_lock<SpinLock> lock1{spinLock};
+    std::thread workerThread([&]() {
+        threadStarted = true;
+        std::unique_lock<SpinLock> lock2{spinLock};
+        lockAcquired = true;
+    });
+
+    while (!threadStarted)
+        ;
+    // wait till worker thread gives up spinning
+    while (spinLock.getStatistics().parkedWaits == 0u) {
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(lockAcquired);
+
+    lock1.unlock();
+    workerThread.join();
+
+    EXPECT_TRUE(lockAcquired);
+    auto statistics = spinLock.getStatistics();
+    EXPECT_EQ(1u, statistics.contendedLocks);
+    EXPECT_LE(1u, statistics.parkedWaits);
+    EXPECT_TRUE(spinLock.try_lock());
+    spinLock.unlock();
+}
+
+TEST(SpinLockTest, givenMultipleThreadsWhenIncrementingUnderSpinLockThenNoUpdateIsLost) {
+    constexpr int numThreads = 8;
+    constexpr int incrementsPerThread = 10000;
+    SpinLock spinLock;
+    int sharedCount = 0;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; i++) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < incrementsPerThread; j++) {
+                std::lock_guard<SpinLock> lock{spinLock};
+                sharedCount++;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numThreads * incrementsPerThread, sharedCount);
+    EXPECT_TRUE(spinLock.try_lock());
+    spinLock.unlock();
+}